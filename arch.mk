@@ -32,6 +32,24 @@ ifeq ($(ARCH),x86_64+nosse)
 	LDLIBS += -lrt
 endif
 
+# x86-64 with AVX
+ifeq ($(ARCH),x86_64+avx)
+	CROSS_COMPILE = 
+	CFLAGS += -fopenmp -fPIC
+	CFLAGS += -mavx
+	LDFLAGS += -fopenmp
+	LDLIBS += -lrt
+endif
+
+# x86-64 with AVX-512
+ifeq ($(ARCH),x86_64+avx512)
+	CROSS_COMPILE = 
+	CFLAGS += -fopenmp -fPIC
+	CFLAGS += -mavx512f
+	LDFLAGS += -fopenmp
+	LDLIBS += -lrt
+endif
+
 ifeq ($(ARCH),armv6l)
 	CROSS_COMPILE = 
 	CFLAGS += -fopenmp -fPIC
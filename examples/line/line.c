@@ -0,0 +1,112 @@
+/**
+ * @file
+ * @author David Barina <ibarina@fit.vutbr.cz>
+ * @brief Example application checking the line-based transform against dwt_cdf97_2f_s.
+ */
+
+#include "libdwt.h"
+
+#include <stdlib.h>
+
+/**
+ * @brief Transform the test image of the size of @p x times @p y using both interfaces and compare them.
+ *
+ * @returns non-zero if the results differ
+ */
+static
+int check(
+	int x,
+	int y,
+	int j)
+{
+	// compute optimal stride
+	const int stride_x = dwt_util_get_opt_stride(x * sizeof(float));
+	const int stride_y = sizeof(float);
+
+	// image data
+	void *data1, *data2;
+
+	dwt_util_alloc_image(&data1, stride_x, stride_y, x, y);
+	dwt_util_test_image_fill_s(data1, stride_x, stride_y, x, y, 0);
+	dwt_util_alloc_image(&data2, stride_x, stride_y, x, y);
+	dwt_util_test_image_zero_s(data2, stride_x, stride_y, x, y);
+
+	// the line-based transform equals to the single-loop strategy
+	dwt_util_set_vert(DWT_VERT_SINGLE);
+
+	int j1 = j;
+	int j2 = j;
+
+	// the reference transform into the first image
+	dwt_cdf97_2f_s(data1, stride_x, stride_y, x, y, x, y, &j1, 0, 0);
+
+	// the same test image pushed row by row
+	struct dwt_cdf97_2f_line_s *line = dwt_cdf97_2f_line_init_s(x, y, &j2, 0);
+
+	float *src = malloc(sizeof(float) * x);
+	float *row = malloc(sizeof(float) * x);
+
+	if( NULL == src || NULL == row )
+	{
+		dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+		dwt_util_abort();
+	}
+
+	void *test;
+	dwt_util_alloc_image(&test, stride_x, stride_y, x, y);
+	dwt_util_test_image_fill_s(test, stride_x, stride_y, x, y, 0);
+
+	for(int r = 0; r < y; r++)
+	{
+		for(int c = 0; c < x; c++)
+			src[c] = *dwt_util_addr_coeff_s(test, r, c, stride_x, stride_y);
+
+		dwt_cdf97_2f_line_push_row_s(line, src);
+
+		// store the finished coefficients into the second image
+		int n, row_y, row_x;
+		while( (n = dwt_cdf97_2f_line_pull_rows_s(line, row, &row_y, &row_x)) )
+		{
+			for(int c = 0; c < n; c++)
+				*dwt_util_addr_coeff_s(data2, row_y, row_x + c, stride_x, stride_y) = row[c];
+		}
+	}
+
+	dwt_cdf97_2f_line_finish_s(line);
+
+	const int differs = j1 != j2 || dwt_util_compare_s(data1, data2, stride_x, stride_y, x, y);
+
+	dwt_util_log(LOG_INFO, "%ix%i with %i levels: %s\n", x, y, j1, differs ? "images differs" : "success");
+
+	// free allocated memory
+	free(src);
+	free(row);
+	dwt_util_free_image(&test);
+	dwt_util_free_image(&data1);
+	dwt_util_free_image(&data2);
+
+	return differs;
+}
+
+int main()
+{
+	// init platform
+	dwt_util_init();
+
+	dwt_util_log(LOG_INFO, "We are running on \"%s\" architecture.\n", dwt_util_arch());
+
+	int differs = 0;
+
+	// full decomposition unless stated otherwise
+	differs |= check(2, 2, 1);
+	differs |= check(1, 1, -1);
+	differs |= check(64, 64, -1);
+	differs |= check(513, 70, -1);
+	differs |= check(70, 513, -1);
+	differs |= check(512, 512, 3);
+
+	// release platform resources
+	dwt_util_finish();
+
+	return differs;
+}
@@ -105,6 +105,52 @@ void cv_dwt_cdf97_2f(
 	}
 }
 
+static
+void cv_dwt_cdf97_2f_ex(
+	const Mat &src,
+	Mat &dst,
+	const int &channel,
+	const Size &size,
+	int &j,
+	const int &flags)
+{
+	switch(src.depth())
+	{
+		case CV_64F:
+			dwt_cdf97_2f_ex_d(
+				src.data+src.elemSize1()*channel,
+				src.step,
+				dst.data+dst.elemSize1()*channel,
+				dst.step,
+				dst.elemSize(),
+				dst.size().width,
+				dst.size().height,
+				size.width,
+				size.height,
+				&j,
+				is_set(flags, DWT_EXTREME),
+				is_set(flags, DWT_PADDING));
+			break;
+		case CV_32F:
+			dwt_cdf97_2f_ex_s(
+				src.data+src.elemSize1()*channel,
+				src.step,
+				dst.data+dst.elemSize1()*channel,
+				dst.step,
+				dst.elemSize(),
+				dst.size().width,
+				dst.size().height,
+				size.width,
+				size.height,
+				&j,
+				is_set(flags, DWT_EXTREME),
+				is_set(flags, DWT_PADDING));
+			break;	
+		default:
+			CV_Error(CV_StsOutOfRange, "The matrix element depth value is out of range.");
+	}
+}
+
 static
 void cv_dwt_cdf97_2i(
 	Mat &img,
@@ -187,6 +233,29 @@ void dwt::transform(
 	int &j,
 	int flags)
 {
+	// the forward transform reads the source directly, the simple image DWT needs the padded image
+	if( src.data != dst.data && is_set(flags, DWT_FORWARD) && !is_set(flags, DWT_SIMPLE) )
+	{
+		CV_Assert( src.depth() == CV_64F || src.depth() == CV_32F );
+		CV_Assert( 0 == is_set(flags, DWT_INVERSE) );
+		CV_Assert( 1 == is_set(flags, DWT_SPARSE) + is_set(flags, DWT_PACKED) );
+
+		if( is_set(flags, DWT_SPARSE) )
+		{
+			dst.create(dwt_util_pow2_ceil_log2(src.rows), dwt_util_pow2_ceil_log2(src.cols), src.type());
+		}
+		else
+		{
+			dst.create(src.size(), src.type());
+			size = src.size();
+		}
+
+		for(int c = 0; c < src.channels(); c++)
+			cv_dwt_cdf97_2f_ex(src, dst, c, size, j, flags);
+
+		return;
+	}
+
 	if(src.data == dst.data)
 		dst = src; // no data is copied
 	else
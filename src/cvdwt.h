@@ -93,6 +93,7 @@ void transform(
  * @brief Perform forward or inverse discrete wavelet transform of given image.
  * 
  * @note This function can operate OUT-OF-PLACE (src != dst) or IN-PLACE (src == dst).
+ * @note The forward transform of sparse and packed images reads @p src directly, without copying it into @p dst first.
  * @note This function uses CDF 9/7 wavelet.
   */
 void transform(
@@ -371,6 +371,7 @@ int is_valid_data_step_s(const float *data_step)
 #include <string.h> // memcpy
 #include <stdarg.h> // va_start, va_end
 #include <malloc.h> // memalign
+#include <unistd.h> // sysconf
 
 // non-SSE workaround
 #include <float.h>
@@ -383,6 +384,52 @@ int is_valid_data_step_s(const float *data_step)
 	#include <xmmintrin.h>
 #endif
 
+/** SSE2 intrinsics */
+#ifdef __SSE2__
+	#warning INFO: Using SSE2
+	#include <emmintrin.h>
+#endif
+
+/** AVX intrinsics */
+#ifdef __AVX__
+	#warning INFO: Using AVX
+	#include <immintrin.h>
+#endif
+
+/** AVX-512 intrinsics */
+#ifdef __AVX512F__
+	#warning INFO: Using AVX-512
+	#include <immintrin.h>
+#endif
+
+/** AVX and AVX-512 kernels selected at run time according to CPUID, only along with SSE and SSE2 kernels of the same ABI */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE__) && defined(__SSE2__) && (defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+	#warning INFO: Using run-time CPU dispatch
+	#define USE_CPU_DISPATCH
+	#include <immintrin.h>
+#endif
+
+#if defined(__AVX__) || defined(USE_CPU_DISPATCH)
+	#define USE_AVX
+#endif
+
+#if defined(__AVX512F__) || defined(USE_CPU_DISPATCH)
+	#define USE_AVX512F
+#endif
+
+/** compile a kernel for the instruction set even if it is not enabled on command line */
+#ifdef __AVX__
+	#define TARGET_AVX
+#else
+	#define TARGET_AVX __attribute__ ((target ("avx")))
+#endif
+
+#ifdef __AVX512F__
+	#define TARGET_AVX512F
+#else
+	#define TARGET_AVX512F __attribute__ ((target ("avx512f")))
+#endif
+
 /** OpenMP header when used */
 #ifdef _OPENMP
 	#warning INFO: Using OpenMP
@@ -519,11 +566,24 @@ const char *dwt_util_arch()
 	return QUOTE(ARCH);
 }
 
+/** the automatic acceleration, the best kernels of the running CPU (see dwt_util_set_accel) */
+#define ACCEL_AUTO 14
+
+/** the number of acceleration types, the automatic one is the last */
+#define ACCEL_TYPES (ACCEL_AUTO+1)
+
 int dwt_util_global_accel_type = 0;
 
 static
 void set_accel_type(int accel_type)
 {
+	if( accel_type < 0 || accel_type >= ACCEL_TYPES )
+	{
+		dwt_util_log(LOG_ERR, "Unsupported value of acceleration.\n");
+
+		dwt_util_abort();
+	}
+
 	dwt_util_global_accel_type = accel_type;
 }
 
@@ -533,6 +593,130 @@ int get_accel_type()
 	return dwt_util_global_accel_type;
 }
 
+enum dwt_vert dwt_util_global_vert_type = DWT_VERT_AUTO;
+
+/**
+ * @brief Vertical strategy used for columns @p stride_y bytes apart.
+ */
+static
+enum dwt_vert get_vert_type(
+	int stride_y)
+{
+#ifdef microblaze
+	UNUSED(stride_y);
+
+	return DWT_VERT_COLUMN;
+#else
+	// both block and row strategies need contiguous columns
+	if( (int)sizeof(float) != stride_y )
+		return DWT_VERT_COLUMN;
+
+	if( DWT_VERT_AUTO == dwt_util_global_vert_type )
+		return ACCEL_AUTO == get_accel_type() ? DWT_VERT_BLOCK : DWT_VERT_COLUMN;
+
+	return dwt_util_global_vert_type;
+#endif
+}
+
+#ifndef microblaze
+/**
+ * @brief Vertical strategy used for @p size_y rows @p stride_x bytes apart.
+ *
+ * The automatic choice of the column strategy is refined per level. Columns
+ * walking more than 256 KiB thrash the cache, so they are transposed
+ * instead, still lifted using the selected acceleration.
+ */
+static
+enum dwt_vert get_vert_type_level(
+	int stride_x,
+	int stride_y,
+	int size_y)
+{
+	const enum dwt_vert vert = get_vert_type(stride_y);
+
+	if( DWT_VERT_AUTO == dwt_util_global_vert_type && DWT_VERT_COLUMN == vert
+		&& (int)sizeof(float) == stride_y && (size_t)size_y * abs(stride_x) > 262144 )
+		return DWT_VERT_TRANSPOSE;
+
+	return vert;
+}
+#endif
+
+#ifdef USE_CPU_DISPATCH
+/**
+ * @brief Instruction sets found on the running CPU by dwt_util_init.
+ */
+static int dwt_util_global_cpu_avx = 0;
+static int dwt_util_global_cpu_avx512f = 0;
+#endif
+
+#ifdef USE_AVX
+static
+int cpu_has_avx()
+{
+#ifdef __AVX__
+	return 1;
+#else
+	return dwt_util_global_cpu_avx;
+#endif
+}
+#endif
+
+#ifdef USE_AVX512F
+static
+int cpu_has_avx512f()
+{
+#ifdef __AVX512F__
+	return 1;
+#else
+	return dwt_util_global_cpu_avx512f;
+#endif
+}
+#endif
+
+/**
+ * @brief Kernels of one acceleration type.
+ *
+ * NULL kernels fall back to the non-accelerated multi-loop algorithms.
+ */
+struct accel_kernels
+{
+	/** lifting a single signal */
+	void (*main_s)(float *restrict arr, int steps, float alpha, float beta, float gamma, float delta, float zeta, int scaling);
+	/** lifting a single signal of at least three steps, NULL uses @p main_s */
+	void (*main_sdl_s)(float *restrict arr, int steps, float alpha, float beta, float gamma, float delta, float zeta, int scaling);
+	/** lifting @p group_s signals of at least three steps at once */
+	void (*main_group_s)(float *restrict arr, int dist, int steps, float alpha, float beta, float gamma, float delta, float zeta, int scaling);
+	/** the number of signals lifted by @p main_group_s */
+	int group_s;
+	/** lifting a double precision signal */
+	void (*main_d)(double *restrict arr, int steps, double alpha, double beta, double gamma, double delta, double zeta, int scaling);
+	/** lifting a double precision signal of at least three steps, NULL uses @p main_d */
+	void (*main_sdl_d)(double *restrict arr, int steps, double alpha, double beta, double gamma, double delta, double zeta, int scaling);
+	/** lifting a signal with two lifting steps */
+	void (*main_op2s_s)(float *restrict arr, int steps, float alpha, float beta, float zeta, int scaling);
+	/** lifting a double precision signal with two lifting steps */
+	void (*main_op2s_d)(double *restrict arr, int steps, double alpha, double beta, double zeta, int scaling);
+};
+
+/**
+ * @brief Kernels of all acceleration types.
+ *
+ * Resolved once in dwt_util_init according to the running CPU (see
+ * accel_table_init), dwt_util_set_accel only selects an entry. Before
+ * dwt_util_init, all types use the multi-loop algorithms.
+ */
+static struct accel_kernels dwt_util_global_accel_table[ACCEL_TYPES];
+
+/**
+ * @brief Kernels of the selected acceleration type.
+ */
+static
+const struct accel_kernels *get_accel()
+{
+	return &dwt_util_global_accel_table[get_accel_type()];
+}
+
 /**
  * @{
  * @brief CDF 9/7 lifting scheme constants
@@ -723,6 +907,44 @@ int to_even(
 	return x&~1;
 }
 
+/**
+ * @brief Samples around each tile of the tiled strategy (even number).
+ *
+ * The halo covers the reach of all four lifting steps of CDF 9/7 including
+ * the prologue and epilogue of the lifting kernels, so the interior of
+ * a tile is computed exactly as within the whole image.
+ */
+#define DWT_TILE_HALO 8
+
+int dwt_util_global_tile_size = 0;
+
+/**
+ * @brief Size of tiles of the tiled strategy (even number).
+ *
+ * Unless set by dwt_util_set_tile, a tile together with its halo occupies
+ * a half of the L2 cache.
+ */
+static
+int get_tile_size()
+{
+	if( dwt_util_global_tile_size > 0 )
+		return max(to_even(dwt_util_global_tile_size), 2*DWT_TILE_HALO);
+
+	long cache = 0;
+#ifdef _SC_LEVEL2_CACHE_SIZE
+	cache = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+	if( cache <= 0 )
+		cache = 256*1024;
+
+	int size = 32;
+
+	while( (long)sizeof(float) * (size+16+2*DWT_TILE_HALO) * (size+16+2*DWT_TILE_HALO) <= cache/2 )
+		size += 16;
+
+	return size;
+}
+
 int dwt_util_to_even(
 	int x)
 {
@@ -1027,6 +1249,220 @@ void *dwt_util_memcpy_stride_s(
 	return dst;
 }
 
+/**
+ * @brief Zero memory area.
+ *
+ * This function fills @p n floats in sparse memory area @p dst with zeros.
+ * The stride (in bytes) is determined by @p stride_dst argument.
+ */
+static
+void dwt_util_zero_stride_s(
+	void *dst,
+	ssize_t stride_dst,
+	size_t n		///< Number of floats to be zeroed, not number of bytes.
+	)
+{
+	assert( NULL != dst );
+
+	const size_t size = sizeof(float);
+
+	if( (ssize_t)size == stride_dst )
+	{
+		memset(dst, 0, n*size);
+	}
+	else
+	{
+		char *restrict ptr_dst = (char *restrict)dst;
+		for(size_t i = 0; i < n; i++)
+		{
+			*(float *restrict)ptr_dst = 0;
+
+			ptr_dst += stride_dst;
+		}
+	}
+}
+
+#ifdef USE_AVX
+/**
+ * @brief AVX part of dwt_util_split_s.
+ *
+ * @returns The number of samples processed.
+ */
+static
+TARGET_AVX
+size_t dwt_util_split_avx_s(
+	float *restrict dst_l,
+	float *restrict dst_h,
+	const float *restrict src,
+	size_t n,
+	float scale_l,
+	float scale_h)
+{
+	const __m256 zl = _mm256_set1_ps(scale_l);
+	const __m256 zh = _mm256_set1_ps(scale_h);
+
+	size_t i = 0;
+
+	for(; i+16 <= n; i += 16)
+	{
+		const __m256 a = _mm256_loadu_ps(src+i+0);
+		const __m256 b = _mm256_loadu_ps(src+i+8);
+		// [ s0 s1 s2 s3 s8 s9 s10 s11 ], [ s4 s5 s6 s7 s12 s13 s14 s15 ]
+		const __m256 lo = _mm256_permute2f128_ps(a, b, 0x20);
+		const __m256 hi = _mm256_permute2f128_ps(a, b, 0x31);
+
+		_mm256_storeu_ps(dst_l+i/2, _mm256_mul_ps(_mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2,0,2,0)), zl));
+		_mm256_storeu_ps(dst_h+i/2, _mm256_mul_ps(_mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3,1,3,1)), zh));
+	}
+
+	return i;
+}
+
+/**
+ * @brief AVX part of dwt_util_merge_s.
+ *
+ * @returns The number of samples processed.
+ */
+static
+TARGET_AVX
+size_t dwt_util_merge_avx_s(
+	float *restrict dst,
+	const float *restrict src_l,
+	const float *restrict src_h,
+	size_t n,
+	float scale_l,
+	float scale_h)
+{
+	const __m256 zl = _mm256_set1_ps(scale_l);
+	const __m256 zh = _mm256_set1_ps(scale_h);
+
+	size_t i = 0;
+
+	for(; i+16 <= n; i += 16)
+	{
+		const __m256 l = _mm256_mul_ps(_mm256_loadu_ps(src_l+i/2), zl);
+		const __m256 h = _mm256_mul_ps(_mm256_loadu_ps(src_h+i/2), zh);
+		// [ l0 h0 l1 h1 l4 h4 l5 h5 ], [ l2 h2 l3 h3 l6 h6 l7 h7 ]
+		const __m256 lo = _mm256_unpacklo_ps(l, h);
+		const __m256 hi = _mm256_unpackhi_ps(l, h);
+
+		_mm256_storeu_ps(dst+i+0, _mm256_permute2f128_ps(lo, hi, 0x20));
+		_mm256_storeu_ps(dst+i+8, _mm256_permute2f128_ps(lo, hi, 0x31));
+	}
+
+	return i;
+}
+#endif
+
+/**
+ * @brief Split interleaved samples into even and odd ones.
+ *
+ * This function copies even samples of @p n contiguous floats from @p src
+ * into @p dst_l and odd samples into @p dst_h in a single pass. The stride
+ * of destinations (in bytes) is determined by @p stride_dst. The samples
+ * are multiplied by @p scale_l and @p scale_h on the way, so the scaling
+ * after lifting can be fused into this output stage. Contiguous
+ * destinations are written using SIMD shuffles.
+ */
+static
+void dwt_util_split_s(
+	float *restrict dst_l,
+	float *restrict dst_h,
+	ssize_t stride_dst,
+	const float *restrict src,
+	size_t n,		///< Number of floats in @p src.
+	float scale_l,
+	float scale_h
+	)
+{
+	assert( NULL != dst_l && NULL != dst_h && NULL != src );
+
+	size_t i = 0;
+
+	if( (ssize_t)sizeof(float) == stride_dst )
+	{
+#ifdef USE_AVX
+		if( cpu_has_avx() )
+			i = dwt_util_split_avx_s(dst_l, dst_h, src, n, scale_l, scale_h);
+#endif
+#ifdef __SSE__
+		const __m128 zl = _mm_set1_ps(scale_l);
+		const __m128 zh = _mm_set1_ps(scale_h);
+
+		for(; i+8 <= n; i += 8)
+		{
+			const __m128 a = _mm_loadu_ps(src+i+0);
+			const __m128 b = _mm_loadu_ps(src+i+4);
+
+			_mm_storeu_ps(dst_l+i/2, _mm_mul_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0)), zl));
+			_mm_storeu_ps(dst_h+i/2, _mm_mul_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3,1,3,1)), zh));
+		}
+#endif
+	}
+
+	for(; i+2 <= n; i += 2)
+	{
+		*addr1_s(dst_l, i/2, stride_dst) = src[i+0] * scale_l;
+		*addr1_s(dst_h, i/2, stride_dst) = src[i+1] * scale_h;
+	}
+
+	if( i < n )
+		*addr1_s(dst_l, i/2, stride_dst) = src[i] * scale_l;
+}
+
+/**
+ * @brief Merge even and odd samples into interleaved ones.
+ *
+ * Counterpart of dwt_util_split_s. This function interleaves samples from
+ * @p src_l and @p src_h (their stride in bytes is @p stride_src) into @p n
+ * contiguous floats of @p dst, multiplied by @p scale_l and @p scale_h.
+ */
+static
+void dwt_util_merge_s(
+	float *restrict dst,
+	const float *restrict src_l,
+	const float *restrict src_h,
+	ssize_t stride_src,
+	size_t n,		///< Number of floats in @p dst.
+	float scale_l,
+	float scale_h
+	)
+{
+	assert( NULL != dst && NULL != src_l && NULL != src_h );
+
+	size_t i = 0;
+
+	if( (ssize_t)sizeof(float) == stride_src )
+	{
+#ifdef USE_AVX
+		if( cpu_has_avx() )
+			i = dwt_util_merge_avx_s(dst, src_l, src_h, n, scale_l, scale_h);
+#endif
+#ifdef __SSE__
+		const __m128 zl = _mm_set1_ps(scale_l);
+		const __m128 zh = _mm_set1_ps(scale_h);
+
+		for(; i+8 <= n; i += 8)
+		{
+			const __m128 l = _mm_mul_ps(_mm_loadu_ps(src_l+i/2), zl);
+			const __m128 h = _mm_mul_ps(_mm_loadu_ps(src_h+i/2), zh);
+
+			_mm_storeu_ps(dst+i+0, _mm_unpacklo_ps(l, h));
+			_mm_storeu_ps(dst+i+4, _mm_unpackhi_ps(l, h));
+		}
+#endif
+	}
+
+	for(; i+2 <= n; i += 2)
+	{
+		dst[i+0] = *addr1_const_s(src_l, i/2, stride_src) * scale_l;
+		dst[i+1] = *addr1_const_s(src_h, i/2, stride_src) * scale_h;
+	}
+
+	if( i < n )
+		dst[i] = *addr1_const_s(src_l, i/2, stride_src) * scale_l;
+}
+
 /**
  * @brief Copy memory area.
  *
@@ -1069,6 +1505,39 @@ void *dwt_util_memcpy_stride_d(
 	return dst;
 }
 
+/**
+ * @brief Zero memory area.
+ *
+ * This function fills @p n doubles in sparse memory area @p dst with zeros.
+ * The stride (in bytes) is determined by @p stride_dst argument.
+ */
+static
+void dwt_util_zero_stride_d(
+	void *dst,
+	ssize_t stride_dst,
+	size_t n		///< Number of doubles to be zeroed, not number of bytes.
+	)
+{
+	assert( NULL != dst );
+
+	const size_t size = sizeof(double);
+
+	if( (ssize_t)size == stride_dst )
+	{
+		memset(dst, 0, n*size);
+	}
+	else
+	{
+		char *restrict ptr_dst = (char *restrict)dst;
+		for(size_t i = 0; i < n; i++)
+		{
+			*(double *restrict)ptr_dst = 0;
+
+			ptr_dst += stride_dst;
+		}
+	}
+}
+
 /**
  * @brief Pixel value of test image.
  */
@@ -1276,2177 +1745,8666 @@ int dwt_util_compare_s(
 	return 0;
 }
 
-void dwt_cdf97_f_d(
-	const double *src,
-	double *dst,
-	double *tmp,
-	int N)
+/**
+ * @brief Multi-loop lifting of double precision data.
+ *
+ * Two pairs (predict and update) of lifting steps and coefficients scaling
+ * merged together. Counterpart of accel_lift_op4s_main_s.
+ *
+ * @param[in] scaling Perform scaling of coefficients. Possible values are:
+ *   @li s = 0 : without scaling,
+ *   @li s > 0 : scaling after lifting,
+ *   @li s < 0 : scaling before lifting.
+ */
+static
+void accel_lift_op4s_main_d(
+	double *arr,
+	int steps,
+	double alpha,
+	double beta,
+	double gamma,
+	double delta,
+	double zeta,
+	int scaling)
 {
-	dwt_cdf97_f_ex_d(
-		src,
-		dst,
-		dst + ceil_div2(N),
-		tmp,
-		N
-	);
-}
+	assert( steps >= 0 );
 
-void dwt_cdf53_f_d(
-	const double *src,
-	double *dst,
-	double *tmp,
-	int N)
-{
-	dwt_cdf53_f_ex_d(
-		src,
-		dst,
-		dst + ceil_div2(N),
-		tmp,
-		N
-	);
-}
+	if( scaling < 0 )
+	{
+		for(int s = 0; s < steps; s++)
+		{
+			arr[4+s*2] *= 1/zeta;
+		}
+	
+		for(int s = 0; s < steps; s++)
+		{
+			arr[5+s*2] *= zeta;
+		}
+	}
 
-void dwt_cdf97_f_s(
-	const float *src,
-	float *dst,
-	float *tmp,
-	int N)
-{
-	dwt_cdf97_f_ex_s(
-		src,
-		dst,
-		dst + ceil_div2(N),
-		tmp,
-		N
-	);
-}
+	const double coeffs[4] = {delta, gamma, beta, alpha};
 
-void dwt_cdf53_f_s(
-	const float *src,
-	float *dst,
-	float *tmp,
-	int N)
-{
-	dwt_cdf53_f_ex_s(
-		src,
-		dst,
-		dst + ceil_div2(N),
-		tmp,
-		N
-	);
-}
+	for(int off = 4; off >= 1; off--)
+	{
+		double *out = arr+off;
 
-void dwt_cdf97_i_d(
-	const double *src,
-	double *dst,
-	double *tmp,
-	int N)
-{
-	dwt_cdf97_i_ex_d(
-		src,
-		src + ceil_div2(N),
-		dst,
-		tmp,
-		N
-	);
-}
+		const double c = coeffs[off-1];
 
-void dwt_cdf53_i_d(
-	const double *src,
-	double *dst,
-	double *tmp,
-	int N)
-{
-	dwt_cdf53_i_ex_d(
-		src,
-		src + ceil_div2(N),
-		dst,
-		tmp,
-		N
-	);
-}
+		for(int s = 0; s < steps; s++)
+		{
+			out[0] += c * (out[-1] + out[+1]);
 
-void dwt_cdf97_i_s(
-	const float *src,
-	float *dst,
-	float *tmp,
-	int N)
-{
-	dwt_cdf97_i_ex_s(
-		src,
-		src + ceil_div2(N),
-		dst,
-		tmp,
-		N
-	);
-}
+			out += 2;
+		}
+	}
 
-void dwt_cdf53_i_s(
-	const float *src,
-	float *dst,
-	float *tmp,
-	int N)
-{
-	dwt_cdf53_i_ex_s(
-		src,
-		src + ceil_div2(N),
-		dst,
-		tmp,
-		N
-	);
-}
+	if( scaling > 0 )
+	{
+		for(int s = 0; s < steps; s++)
+		{
+			arr[0+s*2] *= 1/zeta;
+		}
 
-void dwt_cdf97_f_ex_d(
-	const double *src,
-	double *dst_l,
-	double *dst_h,
-	double *tmp,
-	int N)
-{
-	dwt_cdf97_f_ex_stride_d(
-		src,
-		dst_l,
-		dst_h,
-		tmp,
-		N,
-		sizeof(double)
-	);
+		for(int s = 0; s < steps; s++)
+		{
+			arr[1+s*2] *= zeta;
+		}
+	}
 }
 
-void dwt_cdf53_f_ex_d(
-	const double *src,
-	double *dst_l,
-	double *dst_h,
-	double *tmp,
-	int N)
+/**
+ * @brief Double-loop algorithm from Rade Kutil: A Single-Loop Approach to
+ * SIMD Parallelization of 2-D Wavelet Lifting.
+ */
+static
+void accel_lift_op4s_main_dl_d(
+	double *arr,
+	int steps,
+	double alpha,
+	double beta,
+	double gamma,
+	double delta,
+	double zeta,
+	int scaling)
 {
-	dwt_cdf53_f_ex_stride_d(
-		src,
-		dst_l,
-		dst_h,
-		tmp,
-		N,
-		sizeof(double)
-	);
-}
+	assert( steps >= 0 );
 
-void dwt_cdf97_f_ex_s(
-	const float *src,
-	float *dst_l,
-	float *dst_h,
-	float *tmp,
-	int N)
-{
-	dwt_cdf97_f_ex_stride_s(
-		src,
-		dst_l,
-		dst_h,
-		tmp,
-		N,
-		sizeof(float)
-	);
-}
+	if( scaling < 0 )
+	{
+		const double w[4] = { delta, gamma, beta, alpha };
 
-void dwt_cdf53_f_ex_s(
-	const float *src,
-	float *dst_l,
-	float *dst_h,
-	float *tmp,
-	int N)
-{
-	dwt_cdf53_f_ex_stride_s(
-		src,
-		dst_l,
-		dst_h,
-		tmp,
-		N,
-		sizeof(float)
-	);
-}
+		// values that have to be passed from iteration to iteration
+		// slide in left border
+		double l[4] = { arr[0], arr[1], arr[2], arr[3] };
 
-void dwt_cdf97_f_ex_stride_d(
-	const double *src,
-	double *dst_l,
-	double *dst_h,
-	double *tmp,
-	int N,
-	int stride)
-{
-	assert( N >= 0 && NULL != src && NULL != dst_l && NULL != dst_h && NULL != tmp && 0 != stride );
+		// loop by pairs from left to right
+		for(int s = 0; s < steps; s++)
+		{
+			// auxiliary variables
+			double in0;
+			double in1;
+			double out0;
+			double out1;
+
+			// inputs
+			in0 = arr[4+0+s*2];
+			in1 = arr[4+1+s*2];
+
+			// scales
+			in0 = in0 * 1/zeta;
+			in1 = in1 *   zeta;
+
+			// shuffles
+			double c[4] = { l[1], l[2], l[3], in0 };
+			out0 = l[0];
+
+			double r[4];
+
+			// operation z[] = c[] + { alpha, beta, gamma, delta } * ( l[] + r[] )
+			// by sequential computation from top/right to bottom/left
+			r[3] = in1;
+			r[2] = c[3]+w[3]*(l[3]+r[3]);
+			r[1] = c[2]+w[2]*(l[2]+r[2]);
+			r[0] = c[1]+w[1]*(l[1]+r[1]);
+			out1 = c[0]+w[0]*(l[0]+r[0]);
+
+			// outputs
+			arr[0+0+s*2] = out0;
+			arr[0+1+s*2] = out1;
+
+			// update l[]
+			l[0] = r[0];
+			l[1] = r[1];
+			l[2] = r[2];
+			l[3] = r[3];
+		}
 
-	// fix for small N
-	if(N < 2)
-	{
-		if(1 == N)
-			dst_l[0] = src[0] * dwt_cdf97_s1_d;
-		return;
+		// slide out right border
+		arr[steps*2+0] = l[0];
+		arr[steps*2+1] = l[1];
+		arr[steps*2+2] = l[2];
+		arr[steps*2+3] = l[3];
 	}
+	else if ( scaling > 0 )
+	{
+		const double w[4] = { delta, gamma, beta, alpha };
 
-	// copy src into tmp
-	dwt_util_memcpy_stride_d(tmp, sizeof(double), src, stride, N);
+		// values that have to be passed from iteration to iteration
+		// slide in left border
+		double l[4] = { arr[0], arr[1], arr[2], arr[3] };
 
-	// predict 1 + update 1
-	for(int i=1; i<N-2+(N&1); i+=2)
-		tmp[i] -= dwt_cdf97_p1_d * (tmp[i-1] + tmp[i+1]);
+		// loop by pairs from left to right
+		for(int s = 0; s < steps; s++)
+		{
+			// auxiliary variables
+			double in0;
+			double in1;
+			double out0;
+			double out1;
+
+			// inputs
+			in0 = arr[4+0+s*2];
+			in1 = arr[4+1+s*2];
+
+			// shuffles
+			double c[4] = { l[1], l[2], l[3], in0 };
+			out0 = l[0];
+
+			double r[4];
+
+			// operation z[] = c[] + { alpha, beta, gamma, delta } * ( l[] + r[] )
+			// by sequential computation from top/right to bottom/left
+			r[3] = in1;
+			r[2] = c[3]+w[3]*(l[3]+r[3]);
+			r[1] = c[2]+w[2]*(l[2]+r[2]);
+			r[0] = c[1]+w[1]*(l[1]+r[1]);
+			out1 = c[0]+w[0]*(l[0]+r[0]);
+
+			// scales
+			out0 = out0 * 1/zeta;
+			out1 = out1 *   zeta;
+
+			// outputs
+			arr[0+0+s*2] = out0;
+			arr[0+1+s*2] = out1;
+
+			// update l[]
+			l[0] = r[0];
+			l[1] = r[1];
+			l[2] = r[2];
+			l[3] = r[3];
+		}
 
-	if(is_odd(N))
-		tmp[N-1] += 2 * dwt_cdf97_u1_d * tmp[N-2];
+		// slide out right border
+		arr[steps*2+0] = l[0];
+		arr[steps*2+1] = l[1];
+		arr[steps*2+2] = l[2];
+		arr[steps*2+3] = l[3];
+	}
 	else
-		tmp[N-1] -= 2 * dwt_cdf97_p1_d * tmp[N-2];
+	{
+		// fallback, not implemented
+		accel_lift_op4s_main_d(arr, steps, alpha, beta, gamma, delta, zeta, scaling);
+	}
+}
 
-	tmp[0] += 2 * dwt_cdf97_u1_d * tmp[1];
+static
+void accel_lift_op4s_prolog_d(
+	double *arr,
+	int off,
+	int N,
+	double alpha,
+	double beta,
+	double gamma,
+	double delta,
+	double zeta,
+	int scaling)
+{
+	assert( N-off >= 4 );
 
-	for(int i=2; i<N-(N&1); i+=2)
-		tmp[i] += dwt_cdf97_u1_d * (tmp[i-1] + tmp[i+1]);
+#ifdef NDEBUG
+	UNUSED(N);
+#endif
 
-	// predict 2 + update 2
-	for(int i=1; i<N-2+(N&1); i+=2)
-		tmp[i] -= dwt_cdf97_p2_d * (tmp[i-1] + tmp[i+1]);
+	if(off)
+	{
+		// inv-scaling
+		if( scaling < 0 )
+		{
+			// TODO
+		}
 
-	if(is_odd(N))
-		tmp[N-1] += 2 * dwt_cdf97_u2_d * tmp[N-2];
-	else
-		tmp[N-1] -= 2 * dwt_cdf97_p2_d * tmp[N-2];
+		// alpha
+		arr[1] += alpha*(arr[0]+arr[2]);
+		arr[3] += alpha*(arr[2]+arr[4]);
 
-	tmp[0] += 2 * dwt_cdf97_u2_d * tmp[1];
+		// beta
+		arr[0] += 2*beta*(arr[1]);
+		arr[2] += beta*(arr[1]+arr[3]);
+	
+		// gamma
+		arr[1] += gamma*(arr[0]+arr[2]);
+	
+		// delta
+		arr[0] += 2*delta*(arr[1]);
 
-	for(int i=2; i<N-(N&1); i+=2)
-		tmp[i] += dwt_cdf97_u2_d * (tmp[i-1] + tmp[i+1]);
+		// scaling
+		if( scaling > 0)
+		{
+			arr[0] *= zeta;
+		}
+	}
+	else
+	{
+		// inv-scaling
+		if( scaling < 0 )
+		{
+			arr[0] *= 1/zeta;
+			arr[1] *= zeta;
+			arr[2] *= 1/zeta;
+			arr[3] *= zeta;
+		}
 
-	// scale
-	for(int i=0; i<N; i+=2)
-		tmp[i] = tmp[i] * dwt_cdf97_s1_d;
-	for(int i=1; i<N; i+=2)
-		tmp[i] = tmp[i] * dwt_cdf97_s2_d;
+		// alpha
+		arr[0] += 2*alpha*(arr[1]);
+		arr[2] += alpha*(arr[1]+arr[3]);
+		
+		// beta
+		arr[1] += beta*(arr[0]+arr[2]);
+	
+		// gamma
+		arr[0] += 2*gamma*(arr[1]);
+	
+		// delta
+		// none
 
-	// copy tmp into dst
-	dwt_util_memcpy_stride_d(dst_l, stride, tmp+0, 2*sizeof(double),  ceil_div2(N));
-	dwt_util_memcpy_stride_d(dst_h, stride, tmp+1, 2*sizeof(double), floor_div2(N));
+		// scaling
+		// none
+	}
 }
 
-void dwt_cdf53_f_ex_stride_d(
-	const double *src,
-	double *dst_l,
-	double *dst_h,
-	double *tmp,
+static
+void accel_lift_op4s_epilog_d(
+	double *arr,
+	int off,
 	int N,
-	int stride)
+	double alpha,
+	double beta,
+	double gamma,
+	double delta,
+	double zeta,
+	int scaling)
 {
-	assert( N >= 0 && NULL != src && NULL != dst_l && NULL != dst_h && NULL != tmp && 0 != stride );
+	assert( N-off >= 4 );
 
-	// fix for small N
-	if(N < 2)
+	if( is_even(N-off) )
 	{
-		if(1 == N)
-			dst_l[0] = src[0] * dwt_cdf53_s1_d;
-		return;
-	}
+		// inv-scaling
+		if( scaling < 0 )
+		{
+			// TODO
+		}
 
-	// copy src into tmp
-	dwt_util_memcpy_stride_d(tmp, sizeof(double), src, stride, N);
+		// alpha
+		// none
 
-	// predict 1 + update 1
-	for(int i=1; i<N-2+(N&1); i+=2)
-		tmp[i] -= dwt_cdf53_p1_d * (tmp[i-1] + tmp[i+1]);
+		// beta
+		arr[N-1] += 2*beta*(arr[N-2]);
 
-	if(is_odd(N))
-		tmp[N-1] += 2 * dwt_cdf53_u1_d * tmp[N-2];
-	else
-		tmp[N-1] -= 2 * dwt_cdf53_p1_d * tmp[N-2];
+		// gamma
+		arr[N-2] += gamma*(arr[N-1]+arr[N-3]);
+
+		// delta
+		arr[N-1] += 2*delta*(arr[N-2]);
+		arr[N-3] += delta*(arr[N-4]+arr[N-2]);
+
+		// scaling
+		if( scaling > 0 )
+		{
+			// FIXME: this is dependend on "off"
+			arr[N-4] *= 1/zeta;
+			arr[N-3] *= zeta;
+			arr[N-2] *= 1/zeta;
+			arr[N-1] *= zeta;
+		}
+	}
+	else /* is_odd(N-off) */
+	{
+		// inv-scaling
+		if( scaling < 0 )
+		{
+			arr[N-1] *= 1/zeta;
+		}
 
-	tmp[0] += 2 * dwt_cdf53_u1_d * tmp[1];
+		// alpha
+		arr[N-1] += 2*alpha*(arr[N-2]);
 
-	for(int i=2; i<N-(N&1); i+=2)
-		tmp[i] += dwt_cdf53_u1_d * (tmp[i-1] + tmp[i+1]);
+		// beta
+		arr[N-2] += beta*(arr[N-1]+arr[N-3]);
 
-	// scale
-	for(int i=0; i<N; i+=2)
-		tmp[i] = tmp[i] * dwt_cdf53_s1_d;
-	for(int i=1; i<N; i+=2)
-		tmp[i] = tmp[i] * dwt_cdf53_s2_d;
+		// gamma
+		arr[N-1] += 2*gamma*(arr[N-2]);
+		arr[N-3] += gamma*(arr[N-2]+arr[N-4]);
 
-	// copy tmp into dst
-	dwt_util_memcpy_stride_d(dst_l, stride, tmp+0, 2*sizeof(double),  ceil_div2(N));
-	dwt_util_memcpy_stride_d(dst_h, stride, tmp+1, 2*sizeof(double), floor_div2(N));
+		// delta
+		arr[N-2] += delta*(arr[N-1]+arr[N-3]);
+		arr[N-4] += delta*(arr[N-5]+arr[N-3]);
+
+		// scaling
+		if( scaling > 0 )
+		{
+			// FIXME: this is dependend on "off"
+			arr[N-5] *= 1/zeta;
+			arr[N-4] *= zeta;
+			arr[N-3] *= 1/zeta;
+			arr[N-2] *= zeta;
+			arr[N-1] *= 1/zeta;
+		}
+	}
 }
 
 /**
- * @brief Non-accelerated PicoBlaze operation.
- *
- * Two pairs (predict and update) of lifting steps and coefficients scaling
- * merged together.
- *
- * @param[in] scaling Perform scaling of coefficients. Possible values are:
- *   @li s = 0 : without scaling,
- *   @li s > 0 : scaling after lifting,
- *   @li s < 0 : scaling before lifting.
+ * @brief Prolog and epilog for N-off < 4.
  */
 static
-void accel_lift_op4s_main_s(
-	float *arr,
-	int steps,
-	float alpha,
-	float beta,
-	float gamma,
-	float delta,
-	float zeta,
+void accel_lift_op4s_short_d(
+	double *arr,
+	int off,
+	int N,
+	double alpha,
+	double beta,
+	double gamma,
+	double delta,
+	double zeta,
 	int scaling)
 {
-	assert( steps >= 0 );
+	assert( N-off < 4 );
 
-	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+	if(off)
 	{
-		float *arr_local = calc_temp_offset_s(arr, w);
-
-		if( scaling < 0 )
+		if( N == 2 )
 		{
-			for(int s = 0; s < steps; s++)
+			// inv-scaling
+			if( scaling < 0 )
 			{
-				arr_local[4+s*2] *= 1/zeta;
+				// TODO
 			}
-		
-			for(int s = 0; s < steps; s++)
+
+			// alpha
+			arr[1] += 2*alpha*(arr[0]);
+
+			// beta
+			arr[0] += 2*beta*(arr[1]);
+
+			// gamma
+			arr[1] += 2*gamma*(arr[0]);
+
+			// delta
+			arr[0] += 2*delta*(arr[1]);
+
+			// scaling
+			if( scaling > 0 )
 			{
-				arr_local[5+s*2] *= zeta;
+				arr[0] *= zeta;
+				arr[1] *= 1/zeta;
 			}
 		}
+		else
+		if( N == 3 )
+		{
+			// inv-scaling
+			if( scaling < 0 )
+			{
+				// TODO
+			}
 
-		const float coeffs[4] = {delta, gamma, beta, alpha};
+			// alpha
+			arr[1] += alpha*(arr[0]+arr[2]);
 
-		for(int off = 4; off >= 1; off--)
-		{
-			float *out = arr_local+off;
+			// beta
+			arr[0] += 2*beta*(arr[1]);
+			arr[2] += 2*beta*(arr[1]);
 
-			const float c = coeffs[off-1];
+			// gamma
+			arr[1] += gamma*(arr[0]+arr[2]);
 
-			for(int s = 0; s < steps; s++)
+			// delta
+			arr[0] += 2*delta*(arr[1]);
+			arr[2] += 2*delta*(arr[1]);
+
+			// scaling
+			if( scaling > 0 )
 			{
-				out[0] += c * (out[-1] + out[+1]);
+				arr[0] *= zeta;
+				arr[1] *= 1/zeta;
+				arr[2] *= zeta;
+			}
+		}
+		else /* N == 4 */
+		{
+			// inv-scaling
+			if( scaling < 0 )
+			{
+				// TODO
+			}
 
-				out += 2;
+			// alpha
+			arr[1] += alpha*(arr[0]+arr[2]);
+			arr[3] += 2*alpha*(arr[2]);
+
+			// beta
+			arr[0] += 2*beta*(arr[1]);
+			arr[2] += beta*(arr[1]+arr[3]);
+
+			// gamma
+			arr[1] += gamma*(arr[0]+arr[2]);
+			arr[3] += 2*gamma*(arr[2]);
+
+			// delta
+			arr[0] += 2*delta*(arr[1]);
+			arr[2] += delta*(arr[1]+arr[3]);
+
+			// scaling
+			if( scaling > 0 )
+			{
+				arr[0] *= zeta;
+				arr[1] *= 1/zeta;
+				arr[2] *= zeta;
+				arr[3] *= 1/zeta;
 			}
 		}
+	}
+	else /* !off */
+	{
+		if( N == 2 )
+		{
+			// inv-scaling
+			if( scaling < 0 )
+			{
+				arr[0] *= 1/zeta;
+				arr[1] *= zeta;
+			}
 
-		if( scaling > 0 )
+			// alpha
+			arr[0] += 2*alpha*(arr[1]);
+
+			// beta
+			arr[1] += 2*beta*(arr[0]);
+
+			// gamma
+			arr[0] += 2*gamma*(arr[1]);
+
+			// delta
+			arr[1] += 2*delta*(arr[0]);
+
+			// scaling
+			if( scaling > 0 )
+			{
+				// TODO
+			}
+		}
+		else /* N == 3 */
 		{
-			for(int s = 0; s < steps; s++)
+			// inv-scaling
+			if( scaling < 0 )
 			{
-				arr_local[0+s*2] *= 1/zeta;
+				arr[0] *= 1/zeta;
+				arr[1] *= zeta;
+				arr[2] *= 1/zeta;
 			}
 
-			for(int s = 0; s < steps; s++)
+			// alpha
+			arr[0] += 2*alpha*(arr[1]);
+			arr[2] += 2*alpha*(arr[1]);
+
+			// beta
+			arr[1] += beta*(arr[0]+arr[2]);
+
+			// gamma
+			arr[0] += 2*gamma*(arr[1]);
+			arr[2] += 2*gamma*(arr[1]);
+
+			// delta
+			arr[1] += delta*(arr[0]+arr[2]);
+
+			// scaling
+			if( scaling > 0 )
 			{
-				arr_local[1+s*2] *= zeta;
+				// TODO
 			}
 		}
 	}
 }
 
 static
-void op4s_sdl2_import_preload_s_ref(float *out, const float *restrict addr)
+void op4s_sdl_import_d_ref(double *l, const double *restrict addr, int idx)
 {
-	out[0] = addr[0];
-	out[1] = addr[1];
-	out[2] = addr[2];
-	out[3] = addr[3];
+	l[idx] = addr[idx];
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_import_preload_s_sse(out, addr) \
-do { \
-	(out) = _mm_load_ps(addr); \
-} while(0)
-#endif
-
 static
-void op4s_sdl2_import_s_ref(float *l, int idx, const float *out)
+void op4s_sdl_shuffle_d_ref(double *c, double *r)
 {
-	l[idx] = out[idx];
+	c[0]=c[1]; c[1]=c[2]; c[2]=c[3];
+	r[0]=r[1]; r[1]=r[2]; r[2]=r[3];
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_import_s_sse(l, idx, out) \
-do { \
-	(out) = _mm_shuffle_ps((out), (out), _MM_SHUFFLE(2,1,0,3)); \
-	(l) = _mm_move_ss((l), (out)); \
-	(l) = _mm_shuffle_ps((l), (l), _MM_SHUFFLE((3==idx)?0:3,(2==idx)?0:2,(1==idx)?0:1,(0==idx)?0:0)); \
-} while(0)
-#endif
-
 static
-void op4s_sdl6_import_s_ref(float *l, int idx, const float *out)
+void op4s_sdl_load_d_ref(double *in, const double *restrict addr)
 {
-	l[idx] = out[idx];
+	in[0] = addr[0];
+	in[1] = addr[1];
 }
 
-#ifdef __SSE__
-#define op4s_sdl6_import_s_sse(l, idx, out) \
-do { \
-	(out) = _mm_shuffle_ps((out), (out), _MM_SHUFFLE(2,1,0,3)); \
-	(l) = _mm_move_ss((l), (out)); \
-	(l) = _mm_shuffle_ps((l), (l), _MM_SHUFFLE((3==idx)?0:3,(2==idx)?0:2,(1==idx)?0:1,(0==idx)?0:0)); \
-} while(0)
-#endif
-
 static
-void op4s_sdl2_load_s_ref(float *in, const float *addr)
+void op4s_sdl_input_d_ref(const double *in, double *c, double *r)
 {
-	in[0] = addr[0];
-	in[1] = addr[1];
-	in[2] = addr[2];
-	in[3] = addr[3];
+	c[3] = in[0];
+	r[3] = in[1];
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_load_s_sse(in, addr) \
-do { \
-	(in) = _mm_load_ps((const float *)(addr)); \
-} while(0)
-#endif
-
 static
-void op4s_sdl2_shuffle_s_ref(float *c, float *r)
+void op4s_sdl_op_d_ref(double *z, const double *c, const double *w, const double *l, const double *r)
 {
-	c[0]=c[1]; c[1]=c[2]; c[2]=c[3];
-	r[0]=r[1]; r[1]=r[2]; r[2]=r[3];
+	z[3] = c[3] + w[3] * ( l[3] + r[3] );
+	z[2] = c[2] + w[2] * ( l[2] + r[2] );
+	z[1] = c[1] + w[1] * ( l[1] + r[1] );
+	z[0] = c[0] + w[0] * ( l[0] + r[0] );
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_shuffle_s_sse(c, r) \
-do { \
-	(c) = _mm_shuffle_ps((c), (c), _MM_SHUFFLE(0,3,2,1)); \
-	(r) = _mm_shuffle_ps((r), (r), _MM_SHUFFLE(0,3,2,1)); \
-} while(0)
-#endif
-
 static
-void op4s_sdl2_input_low_s_ref(const float *in, float *c, float *r)
+void op4s_sdl_update_d_ref(double *c, double *l, double *r, const double *z)
 {
-	c[3] = in[0];
-	r[3] = in[1];
-}
+	c[0] = l[0];
+	c[1] = l[1];
+	c[2] = l[2];
+	c[3] = l[3];
 
-#ifdef __SSE__
-#define op4s_sdl2_input_low_s_sse(in, c, r) \
-do { \
-	__m128 t; \
-	(t) = (c); \
-	(t) = _mm_shuffle_ps((t), (in), _MM_SHUFFLE(1,0,3,2)); \
-	(c) = _mm_shuffle_ps((c), (t),  _MM_SHUFFLE(2,0,1,0)); \
-	(t) = _mm_shuffle_ps((t), (r),  _MM_SHUFFLE(3,2,3,2)); \
-	(r) = _mm_shuffle_ps((r), (t),  _MM_SHUFFLE(1,2,1,0)); \
-} while(0)
-#endif
+	l[0] = r[0];
+	l[1] = r[1];
+	l[2] = r[2];
+	l[3] = r[3];
+
+	r[0] = z[0];
+	r[1] = z[1];
+	r[2] = z[2];
+	r[3] = z[3];
+}
 
 static
-void op4s_sdl2_input_high_s_ref(const float *in, float *c, float *r)
+void op4s_sdl_output_d_ref(double *out, const double *l, const double *z)
 {
-	c[3] = in[2];
-	r[3] = in[3];
+	out[0] = l[0];
+	out[1] = z[0];
 }
 
 static
-void op4s_sdl2_shuffle_input_low_s_ref(const float *in, float *c, float *r)
+void op4s_sdl_scale_d_ref(double *out, const double *v)
 {
-	op4s_sdl2_shuffle_s_ref(c, r);
-	op4s_sdl2_input_low_s_ref(in, c, r);
+	out[0] *= v[0];
+	out[1] *= v[1];
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_shuffle_input_low_s_sse(in, c, r) \
-do { \
-	__m128 t; \
-	(t) = (in); \
-	(t) = _mm_shuffle_ps((t), (c), _MM_SHUFFLE(3,2,1,0)); \
-	(c) = _mm_shuffle_ps((c), (t), _MM_SHUFFLE(0,3,2,1)); \
-	(t) = _mm_shuffle_ps((t), (r), _MM_SHUFFLE(3,2,1,0)); \
-	(r) = _mm_shuffle_ps((r), (t), _MM_SHUFFLE(1,3,2,1)); \
-} while(0)
-#endif
-
 static
-void op4s_sdl2_shuffle_input_high_s_ref(const float *in, float *c, float *r)
+void op4s_sdl_descale_d_ref(double *in, const double *v)
 {
-	op4s_sdl2_shuffle_s_ref(c, r);
-	op4s_sdl2_input_high_s_ref(in, c, r);
+	in[0] *= v[0];
+	in[1] *= v[1];
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_shuffle_input_high_s_sse(in, c, r) \
-do { \
-	(in) = _mm_shuffle_ps( (in), (c), _MM_SHUFFLE(3,2,3,2) ); \
-	(c)  = _mm_shuffle_ps( (c), (in), _MM_SHUFFLE(0,3,2,1) ); \
-	(in) = _mm_shuffle_ps( (in), (r), _MM_SHUFFLE(3,2,1,0) ); \
-	(r)  = _mm_shuffle_ps( (r), (in), _MM_SHUFFLE(1,3,2,1) ); \
-} while(0)
-#endif
-
 static
-void op4s_sdl2_op_s_ref(float *z, const float *c, const float *w, const float *l, const float *r)
+void op4s_sdl_save_d_ref(double *out, double *restrict addr)
 {
-	z[3] = c[3] + w[3] * ( l[3] + r[3] );
-	z[2] = c[2] + w[2] * ( l[2] + r[2] );
-	z[1] = c[1] + w[1] * ( l[1] + r[1] );
-	z[0] = c[0] + w[0] * ( l[0] + r[0] );
+	addr[0] = out[0];
+	addr[1] = out[1];
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_op_s_sse(z, c, w, l, r) \
-do { \
-	(z) = (l); \
-	(z) = _mm_add_ps((z), (r)); \
-	(z) = _mm_mul_ps((z), (w)); \
-	(z) = _mm_add_ps((z), (c)); \
-} while(0)
-#endif
-
 static
-void op4s_sdl6_op_s_ref(float *z, const float *w, const float *l, const float *r)
+void op4s_sdl_export_d_ref(const double *l, double *restrict addr, int idx)
 {
-	z[3] = z[3] + w[3] * ( l[3] + r[3] );
-	z[2] = z[2] + w[2] * ( l[2] + r[2] );
-	z[1] = z[1] + w[1] * ( l[1] + r[1] );
-	z[0] = z[0] + w[0] * ( l[0] + r[0] );
+	addr[idx] = l[idx];
 }
 
-#ifdef __SSE__
-#define op4s_sdl6_op_s_sse(z, w, l, r) \
-do { \
-	__m128 t; \
-	(t) = (l); \
-	(t) = _mm_add_ps((t), (r)); \
-	(t) = _mm_mul_ps((t), (w)); \
-	(z) = _mm_add_ps((z), (t)); \
-} while(0)
-#endif
-
 static
-void op4s_sdl2_update_s_ref(float *c, float *l, float *r, const float *z)
+void op4s_sdl_pass_fwd_prolog_d_ref(const double *w, const double *v, double *l, double *c, double *r, double *z, double *in, double *out, double *restrict *addr)
 {
-	c[0] = l[0];
-	c[1] = l[1];
-	c[2] = l[2];
-	c[3] = l[3];
+	UNUSED(v);
+	UNUSED(out);
 
-	l[0] = r[0];
-	l[1] = r[1];
-	l[2] = r[2];
-	l[3] = r[3];
+	// shuffle
+	op4s_sdl_shuffle_d_ref(c, r);
 
-	r[0] = z[0];
-	r[1] = z[1];
-	r[2] = z[2];
-	r[3] = z[3];
-}
+	// load
+	op4s_sdl_load_d_ref(in, *addr+4);
 
-#ifdef __SSE__
-#define op4s_sdl2_update_s_sse(c, l, r, z) \
-do { \
-	(c) = (l); \
-	(l) = (r); \
-	(r) = (z); \
-} while(0)
-#endif
+	// (descale)
 
-static
-void op4s_sdl6_update_s_ref(float *z, float *l, float *r)
-{
-	float t[4];
+	// input
+	op4s_sdl_input_d_ref(in, c, r);
 
-	t[0] = z[0];
-	t[1] = z[1];
-	t[2] = z[2];
-	t[3] = z[3];
+	// operation
+	op4s_sdl_op_d_ref(z, c, w, l, r);
 
-	z[0] = l[0];
-	z[1] = l[1];
-	z[2] = l[2];
-	z[3] = l[3];
+	// (output)
 
-	l[0] = r[0];
-	l[1] = r[1];
-	l[2] = r[2];
-	l[3] = r[3];
+	// (scale)
 
-	r[0] = t[0];
-	r[1] = t[1];
-	r[2] = t[2];
-	r[3] = t[3];
-}
+	// (save)
 
-#ifdef __SSE__
-#define op4s_sdl6_update_s_sse(z, l, r) \
-do { \
-	__m128 t; \
-	(t) = (z); \
-	(z) = (l); \
-	(l) = (r); \
-	(r) = (t); \
-} while(0)
-#endif
+	// update
+	op4s_sdl_update_d_ref(c, l, r, z);
 
-static
-void op4s_sdl2_output_low_s_ref(float *out, const float *l, const float *z)
-{
-	out[0] = l[0];
-	out[1] = z[0];
+	// pointers
+	(*addr) += 2;
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_output_low_s_sse(out, l, z) \
-do { \
-	(out) = (l); \
-	(out) = _mm_unpacklo_ps((out), (z)); \
-} while(0)
-#endif
-
 static
-void op4s_sdl2_output_high_s_ref(float *out, const float *l, const float *z)
+void op4s_sdl_pass_inv_prolog_d_ref(const double *w, const double *v, double *l, double *c, double *r, double *z, double *in, double *out, double *restrict *addr)
 {
-	out[2] = l[0];
-	out[3] = z[0];
-}
+	UNUSED(out);
 
-#ifdef __SSE__
-#define op4s_sdl2_output_high_s_sse(out, l, z) \
-do { \
-	__m128 t; \
-	(t) = (l); \
-	(t) = _mm_unpacklo_ps((t), (z)); \
-	(out) = _mm_shuffle_ps((out), t, _MM_SHUFFLE(1,0,1,0)); \
-} while(0)
-#endif
+	// shuffle
+	op4s_sdl_shuffle_d_ref(c, r);
 
-static
-void op4s_sdl2_scale_s_ref(float *out, const float *v)
-{
-	out[0] *= v[0];
-	out[1] *= v[1];
-	out[2] *= v[2];
-	out[3] *= v[3];
-}
+	// load
+	op4s_sdl_load_d_ref(in, *addr+4);
 
-#ifdef __SSE__
-#define op4s_sdl2_scale_s_sse(out, v) \
-do { \
-	(out) = _mm_mul_ps((out), (v)); \
-} while(0)
-#endif
+	// descale
+	op4s_sdl_descale_d_ref(in, v);
 
-static
-void op4s_sdl2_descale_s_ref(float *in, const float *v)
-{
-	in[0] *= v[0];
-	in[1] *= v[1];
-	in[2] *= v[2];
-	in[3] *= v[3];
-}
+	// input
+	op4s_sdl_input_d_ref(in, c, r);
 
-#ifdef __SSE__
-#define op4s_sdl2_descale_s_sse(in, v) \
-do { \
-	(in) = _mm_mul_ps((in), (v)); \
-} while(0)
-#endif
+	// operation
+	op4s_sdl_op_d_ref(z, c, w, l, r);
 
-static
-void op4s_sdl2_save_s_ref(float *out, float *addr)
-{
-	addr[0] = out[0];
-	addr[1] = out[1];
-}
+	// (output)
 
-#ifdef __SSE__
-#define op4s_sdl2_save_s_sse(out, addr) \
-do { \
-	_mm_storel_pi((__m64 *)(addr), (out)); \
-} while(0)
-#endif
+	// (scale)
 
-static
-void op4s_sdl2_save_shift_s_ref(float *out, float *addr)
-{
-	addr[0] = out[0];
-	addr[1] = out[1];
-	addr[2] = out[2];
-	addr[3] = out[3];
-}
+	// (save)
 
-#ifdef __SSE__
-#define op4s_sdl2_save_shift_s_sse(out, addr) \
-do { \
-	_mm_store_ps((float *)(addr), (out)); \
-} while(0)
-#endif
+	// update
+	op4s_sdl_update_d_ref(c, l, r, z);
 
-static
-void op4s_sdl2_export_s_ref(const float *l, float *addr, int idx)
-{
-	addr[idx] = l[idx];
+	// pointers
+	(*addr) += 2;
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_export_s_sse(l, addr, idx) \
-do { \
-	(addr)[(idx)] = (l)[(idx)]; \
-} while(0)
-#endif
-
 static
-void op4s_sdl6_export_s_ref(const float *l, float *addr, int idx)
+void op4s_sdl_pass_fwd_core_d_ref(const double *w, const double *v, double *l, double *c, double *r, double *z, double *in, double *out, double *restrict *addr)
 {
-	addr[idx] = l[idx];
-}
+	// shuffle
+	op4s_sdl_shuffle_d_ref(c, r);
 
-#ifdef __SSE__
-#define op4s_sdl6_export_s_sse(l, addr, idx) \
-do { \
-	(addr)[(idx)] = (l)[(idx)]; \
-} while(0)
-#endif
+	// load
+	op4s_sdl_load_d_ref(in, *addr+4);
 
-static
-void op4s_sdl_import_s_ref(float *l, const float *restrict addr, int idx)
-{
-	l[idx] = addr[idx];
-}
+	// (descale)
 
-static
-void op4s_sdl_shuffle_s_ref(float *c, float *r)
-{
-	c[0]=c[1]; c[1]=c[2]; c[2]=c[3];
-	r[0]=r[1]; r[1]=r[2]; r[2]=r[3];
-}
+	// input
+	op4s_sdl_input_d_ref(in, c, r);
 
-static
-void op4s_sdl_load_s_ref(float *in, const float *restrict addr)
-{
-	in[0] = addr[0];
-	in[1] = addr[1];
-}
+	// operation
+	op4s_sdl_op_d_ref(z, c, w, l, r);
 
-static
-void op4s_sdl_input_s_ref(const float *in, float *c, float *r)
-{
-	c[3] = in[0];
-	r[3] = in[1];
-}
+	// output
+	op4s_sdl_output_d_ref(out, l, z);
 
-static
-void op4s_sdl_op_s_ref(float *z, const float *c, const float *w, const float *l, const float *r)
-{
-	z[3] = c[3] + w[3] * ( l[3] + r[3] );
-	z[2] = c[2] + w[2] * ( l[2] + r[2] );
-	z[1] = c[1] + w[1] * ( l[1] + r[1] );
-	z[0] = c[0] + w[0] * ( l[0] + r[0] );
-}
+	// scale
+	op4s_sdl_scale_d_ref(out, v);
 
-static
-void op4s_sdl_update_s_ref(float *c, float *l, float *r, const float *z)
-{
-	c[0] = l[0];
-	c[1] = l[1];
-	c[2] = l[2];
-	c[3] = l[3];
+	// save
+	op4s_sdl_save_d_ref(out, *addr-6);
 
-	l[0] = r[0];
-	l[1] = r[1];
-	l[2] = r[2];
-	l[3] = r[3];
+	// update
+	op4s_sdl_update_d_ref(c, l, r, z);
 
-	r[0] = z[0];
-	r[1] = z[1];
-	r[2] = z[2];
-	r[3] = z[3];
+	// pointers
+	(*addr) += 2;
 }
 
 static
-void op4s_sdl_output_s_ref(float *out, const float *l, const float *z)
+void op4s_sdl_pass_inv_core_d_ref(const double *w, const double *v, double *l, double *c, double *r, double *z, double *in, double *out, double *restrict *addr)
 {
-	out[0] = l[0];
-	out[1] = z[0];
-}
+	// shuffle
+	op4s_sdl_shuffle_d_ref(c, r);
 
-static
-void op4s_sdl_scale_s_ref(float *out, const float *v)
-{
-	out[0] *= v[0];
-	out[1] *= v[1];
-}
+	// load
+	op4s_sdl_load_d_ref(in, *addr+4);
 
-static
-void op4s_sdl_descale_s_ref(float *in, const float *v)
-{
-	in[0] *= v[0];
-	in[1] *= v[1];
-}
+	// descale
+	op4s_sdl_descale_d_ref(in, v);
 
-static
-void op4s_sdl_save_s_ref(float *out, float *restrict addr)
-{
-	addr[0] = out[0];
-	addr[1] = out[1];
-}
+	// input
+	op4s_sdl_input_d_ref(in, c, r);
 
-static
-void op4s_sdl_export_s_ref(const float *l, float *restrict addr, int idx)
-{
-	addr[idx] = l[idx];
-}
+	// operation
+	op4s_sdl_op_d_ref(z, c, w, l, r);
 
-static
-void op4s_sdl2_preload_prolog_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(w);
-	UNUSED(v);
-	UNUSED(l);
-	UNUSED(c);
-	UNUSED(r);
-	UNUSED(z);
-	UNUSED(in);
+	// output
+	op4s_sdl_output_d_ref(out, l, z);
 
-	op4s_sdl2_import_preload_s_ref(out, (*addr));
+	// (scale)
 
- 	(*addr) += 4;
-}
+	// save
+	op4s_sdl_save_d_ref(out, *addr-6);
 
-#ifdef __SSE__
-#define op4s_sdl2_preload_prolog_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_import_preload_s_sse((out), (*(addr))); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
+	// update
+	op4s_sdl_update_d_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 2;
+}
 
 static
-void op4s_sdl6_preload_prolog_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+void op4s_sdl_pass_fwd_epilog_d_ref(const double *w, const double *v, double *l, double *c, double *r, double *z, double *in, double *out, double *restrict *addr)
 {
-	UNUSED(w);
-	UNUSED(v);
-	UNUSED(l);
-	UNUSED(r);
-	UNUSED(z);
 	UNUSED(in);
 
-	op4s_sdl2_import_preload_s_ref(out, (*addr));
+	// shuffle
+	op4s_sdl_shuffle_d_ref(c, r);
 
- 	(*addr) += 4;
-}
+	// (load)
 
-#ifdef __SSE__
-#define op4s_sdl6_preload_prolog_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_import_preload_s_sse((out), (*(addr))); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
+	// (descale)
 
-static
-void op4s_sdl2_pass_fwd_prolog_full_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(out);
+	// (input)
 
-	// load
-	op4s_sdl2_load_s_ref(in, (*addr));
+	// operation
+	op4s_sdl_op_d_ref(z, c, w, l, r);
 
-	// shuffle + input-low
-	op4s_sdl2_shuffle_input_low_s_ref(in, c, r);
+	// output
+	op4s_sdl_output_d_ref(out, l, z);
 
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+	// scale
+	op4s_sdl_scale_d_ref(out, v);
+
+	// save
+	op4s_sdl_save_d_ref(out, *addr-6);
 
 	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
+	op4s_sdl_update_d_ref(c, l, r, z);
 
 	// pointers
-	(*addr) += 4;
+	(*addr) += 2;
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_fwd_prolog_full_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_load_s_sse((in), (*(addr))); \
-	op4s_sdl2_shuffle_input_low_s_sse((in), (c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
-
 static
-void op4s_sdl2_pass_inv_prolog_full_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+void op4s_sdl_pass_inv_epilog_d_ref(const double *w, const double *v, double *l, double *c, double *r, double *z, double *in, double *out, double *restrict *addr)
 {
 	UNUSED(v);
-	UNUSED(out);
+	UNUSED(in);
 
-	// load
-	op4s_sdl2_load_s_ref(in, (*addr));
+	// shuffle
+	op4s_sdl_shuffle_d_ref(c, r);
 
-	// descale
-	op4s_sdl2_descale_s_ref(in, v);
+	// (load)
 
-	// shuffle + input-low
-	op4s_sdl2_shuffle_input_low_s_ref(in, c, r);
+	// (descale)
+
+	// (input)
 
 	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+	op4s_sdl_op_d_ref(z, c, w, l, r);
+
+	// (output)
+	op4s_sdl_output_d_ref(out, l, z);
+
+	// (scale)
+
+	// save
+	op4s_sdl_save_d_ref(out, *addr-6);
 
 	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
+	op4s_sdl_update_d_ref(c, l, r, z);
 
 	// pointers
-	(*addr) += 4;
+	(*addr) += 2;
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_inv_prolog_full_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_load_s_sse((in), (*(addr))); \
-	op4s_sdl2_descale_s_sse((in), (v)); \
-	op4s_sdl2_shuffle_input_low_s_sse((in), (c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
-
+/**
+ * @brief Shifted double-loop algorithm.
+ *
+ * This function processes 2 coefficients (even + odd) per one iteration.
+ * Double precision counterpart of accel_lift_op4s_main_sdl_ref_s.
+ */
 static
-void op4s_sdl6_pass_inv_prolog_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+void accel_lift_op4s_main_sdl_ref_d(
+	double *restrict arr,
+	int steps,
+	double alpha,
+	double beta,
+	double gamma,
+	double delta,
+	double zeta,
+	int scaling)
 {
-	UNUSED(v);
-	UNUSED(out);
+	// 6+ coeffs implies 3+ steps
+	assert( steps >= 3 );
 
-	// load
-	op4s_sdl2_load_s_ref(in, (*addr));
+	const double w[4] = { delta, gamma, beta, alpha };
+	const double v[4] = { 1/zeta, zeta, 1/zeta, zeta };
+	double l[4];
+	double c[4];
+	double r[4];
+	double z[4];
+	double in[4];
+	double out[4];
 
-	// descale
-	op4s_sdl2_descale_s_ref(in, v);
+	const int S = steps-3;
 
-	// shuffle + input-low
-	op4s_sdl2_shuffle_input_low_s_ref(in, z, r);
+	if( scaling < 0 )
+	{
+		// ****** inverse transform ******
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+		// *** init ***
 
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
+		// this pointer is needed because of use of arr[] in import and export functions
+		double *restrict addr = arr;
 
-	// pointers
-	(*addr) += 4;
-}
+		// *** prolog2 ***
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_inv_prolog_full_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_load_s_sse((in), (*(addr))); \
-	op4s_sdl2_descale_s_sse((in), (v)); \
-	op4s_sdl2_shuffle_input_low_s_sse((in), (z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
+		// prolog2: import(3)
+		op4s_sdl_import_d_ref(l, arr, 3);
 
-static
-void op4s_sdl6_pass_fwd_prolog_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(out);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_inv_prolog_d_ref(w, v, l, c, r, z, in, out, &addr);
+	
+		// prolog2: import(2)
+		op4s_sdl_import_d_ref(l, arr, 2);
 
-	// load
-	op4s_sdl2_load_s_ref(in, (*addr));
+		// prolog2: pass-prolog
+		op4s_sdl_pass_inv_prolog_d_ref(w, v, l, c, r, z, in, out, &addr);
 
-	// (descale)
+		// prolog2: import(1)
+		op4s_sdl_import_d_ref(l, arr, 1);
 
-	// shuffle + input-low
-	op4s_sdl2_shuffle_input_low_s_ref(in, z, r);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_inv_prolog_d_ref(w, v, l, c, r, z, in, out, &addr);
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+		// prolog2: import(0)
+		op4s_sdl_import_d_ref(l, arr, 0);
 
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
+		// *** core ***
 
-	// pointers
-	(*addr) += 4;
-}
+		// core: for s = 0 to S do
+		for(int s = 0; s < S; s++)
+		{
+			// core: pass-core
+			op4s_sdl_pass_inv_core_d_ref(w, v, l, c, r, z, in, out, &addr);
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_fwd_prolog_full_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_load_s_sse((in), (*(addr))); \
-	op4s_sdl2_shuffle_input_low_s_sse((in), (z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
+		}
 
-static
-void op4s_sdl2_pass_fwd_prolog_light_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(out);
-	UNUSED(addr);
+		// *** epilog2 ***
 
-	// shuffle + input-high
-	op4s_sdl2_shuffle_input_high_s_ref(in, c, r);
+		// epilog2: export(3)
+		op4s_sdl_export_d_ref(l, &arr[2*steps], 3);
 
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+		// epilog2: pass-epilog
+		op4s_sdl_pass_inv_epilog_d_ref(w, v, l, c, r, z, in, out, &addr);
 
-	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
-}
+		// epilog2: export(2)
+		op4s_sdl_export_d_ref(l, &arr[2*steps], 2);
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_fwd_prolog_light_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_input_high_s_sse((in), (c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-} while(0)
-#endif
+		// epilog2: pass-epilog
+		op4s_sdl_pass_inv_epilog_d_ref(w, v, l, c, r, z, in, out, &addr);
 
-static
-void op4s_sdl2_pass_inv_prolog_light_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(out);
-	UNUSED(addr);
+		// epilog2: export(1)
+		op4s_sdl_export_d_ref(l, &arr[2*steps], 1);
 
-	// shuffle + input-high
-	op4s_sdl2_shuffle_input_high_s_ref(in, c, r);
+		// epilog2: pass-epilog
+		op4s_sdl_pass_inv_epilog_d_ref(w, v, l, c, r, z, in, out, &addr);
 
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+		// epilog2: export(0)
+		op4s_sdl_export_d_ref(l, &arr[2*steps], 0);
+	}
+	else if ( scaling > 0 )
+	{
+		// ****** forward transform ******
 
-	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
-}
+		// *** init ***
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_inv_prolog_light_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_input_high_s_sse((in), (c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-} while(0)
-#endif
+		// this pointer is needed because of use of arr[] in import and export functions
+		double *restrict addr = arr;
 
-static
-void op4s_sdl6_pass_inv_prolog_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(out);
-	UNUSED(addr);
+		// *** prolog2 ***
 
-	// shuffle + input-high
-	op4s_sdl2_shuffle_input_high_s_ref(in, z, r);
+		// prolog2: import(3)
+		op4s_sdl_import_d_ref(l, arr, 3);
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_fwd_prolog_d_ref(w, v, l, c, r, z, in, out, &addr);
+	
+		// prolog2: import(2)
+		op4s_sdl_import_d_ref(l, arr, 2);
 
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
-}
+		// prolog2: pass-prolog
+		op4s_sdl_pass_fwd_prolog_d_ref(w, v, l, c, r, z, in, out, &addr);
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_inv_prolog_light_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_input_high_s_sse((in), (z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-} while(0)
-#endif
+		// prolog2: import(1)
+		op4s_sdl_import_d_ref(l, arr, 1);
 
-static
-void op4s_sdl6_pass_fwd_prolog_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(out);
-	UNUSED(addr);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_fwd_prolog_d_ref(w, v, l, c, r, z, in, out, &addr);
 
-	// shuffle + input-high
-	op4s_sdl2_shuffle_input_high_s_ref(in, z, r);
+		// prolog2: import(0)
+		op4s_sdl_import_d_ref(l, arr, 0);
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+		// *** core ***
 
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
-}
+		// core: for s = 0 to S do
+		for(int s = 0; s < S; s++)
+		{
+			// core: pass-core
+			op4s_sdl_pass_fwd_core_d_ref(w, v, l, c, r, z, in, out, &addr);
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_fwd_prolog_light_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_input_high_s_sse((in), (z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-} while(0)
-#endif
+		}
 
-static
-void op4s_sdl2_pass_fwd_core_light_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(addr);
+		// *** epilog2 ***
 
-	// shuffle + input-high
-	op4s_sdl2_shuffle_input_high_s_ref(in, c, r);
+		// epilog2: export(3)
+		op4s_sdl_export_d_ref(l, &arr[2*steps], 3);
 
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+		// epilog2: pass-epilog
+		op4s_sdl_pass_fwd_epilog_d_ref(w, v, l, c, r, z, in, out, &addr);
 
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
+		// epilog2: export(2)
+		op4s_sdl_export_d_ref(l, &arr[2*steps], 2);
 
-	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
-}
+		// epilog2: pass-epilog
+		op4s_sdl_pass_fwd_epilog_d_ref(w, v, l, c, r, z, in, out, &addr);
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_fwd_core_light_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_input_high_s_sse((in), (c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-} while(0)
-#endif
+		// epilog2: export(1)
+		op4s_sdl_export_d_ref(l, &arr[2*steps], 1);
 
-static
-void op4s_sdl2_pass_inv_core_light_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(addr);
+		// epilog2: pass-epilog
+		op4s_sdl_pass_fwd_epilog_d_ref(w, v, l, c, r, z, in, out, &addr);
 
-	// shuffle + input-high
-	op4s_sdl2_shuffle_input_high_s_ref(in, c, r);
+		// epilog2: export(0)
+		op4s_sdl_export_d_ref(l, &arr[2*steps], 0);
+	}
+	else
+	{
+		// ****** transform w/o scaling ******
 
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+		// not implemented yet
+		dwt_util_abort();
+	}
+}
 
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
+#ifdef __SSE2__
+#define op4s_sdl_import_d_sse2(l, addr, idx) \
+do { \
+	if( (idx) & 1 ) \
+		(l)[(idx)>>1] = _mm_loadh_pd((l)[(idx)>>1], &(addr)[(idx)]); \
+	else \
+		(l)[(idx)>>1] = _mm_loadl_pd((l)[(idx)>>1], &(addr)[(idx)]); \
+} while(0)
 
-	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
-}
+#define op4s_sdl_load_d_sse2(in, addr) \
+do { \
+	(in) = _mm_loadu_pd((const double *)(addr)); \
+} while(0)
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_inv_core_light_s_sse(w, v, l, c, r, z, in, out, addr) \
+#define op4s_sdl_shuffle_input_d_sse2(in, c, r) \
 do { \
-	op4s_sdl2_shuffle_input_high_s_sse((in), (c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+	(c)[0] = _mm_shuffle_pd((c)[0], (c)[1], _MM_SHUFFLE2(0,1)); \
+	(c)[1] = _mm_shuffle_pd((c)[1], (in),   _MM_SHUFFLE2(0,1)); \
+	(r)[0] = _mm_shuffle_pd((r)[0], (r)[1], _MM_SHUFFLE2(0,1)); \
+	(r)[1] = _mm_shuffle_pd((r)[1], (in),   _MM_SHUFFLE2(1,1)); \
 } while(0)
-#endif
 
-static
-void op4s_sdl6_pass_inv_core_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(addr);
+#define op4s_sdl_op_d_sse2(z, c, w, l, r) \
+do { \
+	(z)[0] = _mm_add_pd((c)[0], _mm_mul_pd((w)[0], _mm_add_pd((l)[0], (r)[0]))); \
+	(z)[1] = _mm_add_pd((c)[1], _mm_mul_pd((w)[1], _mm_add_pd((l)[1], (r)[1]))); \
+} while(0)
 
-	// shuffle + input-high
-	op4s_sdl2_shuffle_input_high_s_ref(in, z, r);
+#define op4s_sdl_update_d_sse2(c, l, r, z) \
+do { \
+	(c)[0] = (l)[0]; (c)[1] = (l)[1]; \
+	(l)[0] = (r)[0]; (l)[1] = (r)[1]; \
+	(r)[0] = (z)[0]; (r)[1] = (z)[1]; \
+} while(0)
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+#define op4s_sdl_output_d_sse2(out, l, z) \
+do { \
+	(out) = _mm_unpacklo_pd((l)[0], (z)[0]); \
+} while(0)
 
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
+#define op4s_sdl_scale_d_sse2(out, v) \
+do { \
+	(out) = _mm_mul_pd((out), (v)); \
+} while(0)
 
-	// (update)
-}
+#define op4s_sdl_descale_d_sse2(in, v) \
+do { \
+	(in) = _mm_mul_pd((in), (v)); \
+} while(0)
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_inv_core_light_s_sse(w, v, l, r, z, in, out, addr) \
+#define op4s_sdl_save_d_sse2(out, addr) \
 do { \
-	op4s_sdl2_shuffle_input_high_s_sse((in), (z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	_mm_storeu_pd((double *)(addr), (out)); \
 } while(0)
-#endif
 
-static
-void op4s_sdl6_pass_fwd_core_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(addr);
+#define op4s_sdl_export_d_sse2(l, addr, idx) \
+do { \
+	if( (idx) & 1 ) \
+		_mm_storeh_pd(&(addr)[(idx)], (l)[(idx)>>1]); \
+	else \
+		_mm_storel_pd(&(addr)[(idx)], (l)[(idx)>>1]); \
+} while(0)
 
-	// shuffle + input-high
-	op4s_sdl2_shuffle_input_high_s_ref(in, z, r);
+#define op4s_sdl_pass_fwd_prolog_d_sse2(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl_load_d_sse2((in), (*(addr))+4); \
+	op4s_sdl_shuffle_input_d_sse2((in), (c), (r)); \
+	op4s_sdl_op_d_sse2((z), (c), (w), (l), (r)); \
+	op4s_sdl_update_d_sse2((c), (l), (r), (z)); \
+	(*(addr)) += 2; \
+} while(0)
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+#define op4s_sdl_pass_inv_prolog_d_sse2(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl_load_d_sse2((in), (*(addr))+4); \
+	op4s_sdl_descale_d_sse2((in), (v)); \
+	op4s_sdl_shuffle_input_d_sse2((in), (c), (r)); \
+	op4s_sdl_op_d_sse2((z), (c), (w), (l), (r)); \
+	op4s_sdl_update_d_sse2((c), (l), (r), (z)); \
+	(*(addr)) += 2; \
+} while(0)
 
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
+#define op4s_sdl_pass_fwd_core_d_sse2(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl_load_d_sse2((in), (*(addr))+4); \
+	op4s_sdl_shuffle_input_d_sse2((in), (c), (r)); \
+	op4s_sdl_op_d_sse2((z), (c), (w), (l), (r)); \
+	op4s_sdl_output_d_sse2((out), (l), (z)); \
+	op4s_sdl_scale_d_sse2((out), (v)); \
+	op4s_sdl_save_d_sse2((out), (*(addr))-6); \
+	op4s_sdl_update_d_sse2((c), (l), (r), (z)); \
+	(*(addr)) += 2; \
+} while(0)
 
-	// (update)
-}
+#define op4s_sdl_pass_inv_core_d_sse2(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl_load_d_sse2((in), (*(addr))+4); \
+	op4s_sdl_descale_d_sse2((in), (v)); \
+	op4s_sdl_shuffle_input_d_sse2((in), (c), (r)); \
+	op4s_sdl_op_d_sse2((z), (c), (w), (l), (r)); \
+	op4s_sdl_output_d_sse2((out), (l), (z)); \
+	op4s_sdl_save_d_sse2((out), (*(addr))-6); \
+	op4s_sdl_update_d_sse2((c), (l), (r), (z)); \
+	(*(addr)) += 2; \
+} while(0)
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_fwd_core_light_s_sse(w, v, l, r, z, in, out, addr) \
+#define op4s_sdl_pass_fwd_epilog_d_sse2(w, v, l, c, r, z, in, out, addr) \
 do { \
-	op4s_sdl2_shuffle_input_high_s_sse((in), (z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl_shuffle_input_d_sse2((in), (c), (r)); \
+	op4s_sdl_op_d_sse2((z), (c), (w), (l), (r)); \
+	op4s_sdl_output_d_sse2((out), (l), (z)); \
+	op4s_sdl_scale_d_sse2((out), (v)); \
+	op4s_sdl_save_d_sse2((out), (*(addr))-6); \
+	op4s_sdl_update_d_sse2((c), (l), (r), (z)); \
+	(*(addr)) += 2; \
 } while(0)
-#endif
 
-static
-void op4s_sdl6_pass_inv_postcore_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(addr);
-
-	// shuffle + input-high
-	op4s_sdl2_shuffle_input_high_s_ref(in, z, r);
-
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
-
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
-
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
-}
-
-#ifdef __SSE__
-#define op4s_sdl6_pass_inv_postcore_light_s_sse(w, v, l, r, z, in, out, addr) \
+#define op4s_sdl_pass_inv_epilog_d_sse2(w, v, l, c, r, z, in, out, addr) \
 do { \
-	op4s_sdl2_shuffle_input_high_s_sse((in), (z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
+	op4s_sdl_shuffle_input_d_sse2((in), (c), (r)); \
+	op4s_sdl_op_d_sse2((z), (c), (w), (l), (r)); \
+	op4s_sdl_output_d_sse2((out), (l), (z)); \
+	op4s_sdl_save_d_sse2((out), (*(addr))-6); \
+	op4s_sdl_update_d_sse2((c), (l), (r), (z)); \
+	(*(addr)) += 2; \
 } while(0)
-#endif
 
+/**
+ * @brief Shifted double-loop algorithm, SSE2 implementation.
+ *
+ * The four lifting steps are held in a pair of SSE2 registers. This function
+ * processes 2 coefficients (even + odd) per one iteration.
+ */
 static
-void op4s_sdl6_pass_fwd_postcore_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+void accel_lift_op4s_main_sdl_sse2_d(
+	double *restrict arr,
+	int steps,
+	double alpha,
+	double beta,
+	double gamma,
+	double delta,
+	double zeta,
+	int scaling)
 {
-	UNUSED(v);
-	UNUSED(addr);
+	// 6+ coeffs implies 3+ steps
+	assert( steps >= 3 );
 
-	// shuffle + input-high
-	op4s_sdl2_shuffle_input_high_s_ref(in, z, r);
+	const __m128d w[2] = { { delta, gamma }, { beta, alpha } };
+	const __m128d v = { 1/zeta, zeta };
+	__m128d l[2] = { _mm_setzero_pd(), _mm_setzero_pd() };
+	__m128d c[2] = { _mm_setzero_pd(), _mm_setzero_pd() };
+	__m128d r[2] = { _mm_setzero_pd(), _mm_setzero_pd() };
+	__m128d z[2];
+	__m128d in = _mm_setzero_pd();
+	__m128d out;
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+	const int S = steps-3;
 
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
+	if( scaling < 0 )
+	{
+		// ****** inverse transform ******
 
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
-}
+		// *** init ***
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_fwd_postcore_light_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_input_high_s_sse((in), (z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-} while(0)
-#endif
+		// this pointer is needed because of use of arr[] in import and export functions
+		double *restrict addr = arr;
 
-static
-void op4s_sdl2_pass_fwd_core_full_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	// load
-	op4s_sdl2_load_s_ref(in, (*addr));
+		// *** prolog2 ***
 
-	// shuffle + input-low
-	op4s_sdl2_shuffle_input_low_s_ref(in, c, r);
+		// prolog2: import(3)
+		op4s_sdl_import_d_sse2(l, arr, 3);
 
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_inv_prolog_d_sse2(w, v, l, c, r, z, in, out, &addr);
+	
+		// prolog2: import(2)
+		op4s_sdl_import_d_sse2(l, arr, 2);
 
-	// output-high
-	op4s_sdl2_output_high_s_ref(out, l, z);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_inv_prolog_d_sse2(w, v, l, c, r, z, in, out, &addr);
 
-	// scale
-	op4s_sdl2_scale_s_ref(out, v);
+		// prolog2: import(1)
+		op4s_sdl_import_d_sse2(l, arr, 1);
 
-	// save-shift
-	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_inv_prolog_d_sse2(w, v, l, c, r, z, in, out, &addr);
 
-	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
+		// prolog2: import(0)
+		op4s_sdl_import_d_sse2(l, arr, 0);
 
-	// pointers
-	(*addr) += 4;
-}
+		// *** core ***
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_fwd_core_full_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_load_s_sse((in), (*(addr))); \
-	op4s_sdl2_shuffle_input_low_s_sse((in), (c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
-	op4s_sdl2_scale_s_sse((out), (v)); \
-	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
+		// core: for s = 0 to S do
+		for(int s = 0; s < S; s++)
+		{
+			// core: pass-core
+			op4s_sdl_pass_inv_core_d_sse2(w, v, l, c, r, z, in, out, &addr);
 
-static
-void op4s_sdl2_pass_inv_core_full_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	// load
-	op4s_sdl2_load_s_ref(in, (*addr));
+		}
 
-	// descale
-	op4s_sdl2_descale_s_ref(in, v);
+		// *** epilog2 ***
 
-	// shuffle + input-low
-	op4s_sdl2_shuffle_input_low_s_ref(in, c, r);
+		// epilog2: export(3)
+		op4s_sdl_export_d_sse2(l, &arr[2*steps], 3);
 
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+		// epilog2: pass-epilog
+		op4s_sdl_pass_inv_epilog_d_sse2(w, v, l, c, r, z, in, out, &addr);
 
-	// output-high
-	op4s_sdl2_output_high_s_ref(out, l, z);
+		// epilog2: export(2)
+		op4s_sdl_export_d_sse2(l, &arr[2*steps], 2);
 
-	// (scale)
+		// epilog2: pass-epilog
+		op4s_sdl_pass_inv_epilog_d_sse2(w, v, l, c, r, z, in, out, &addr);
 
-	// save-shift
-	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+		// epilog2: export(1)
+		op4s_sdl_export_d_sse2(l, &arr[2*steps], 1);
 
-	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
+		// epilog2: pass-epilog
+		op4s_sdl_pass_inv_epilog_d_sse2(w, v, l, c, r, z, in, out, &addr);
 
-	// pointers
-	(*addr) += 4;
-}
+		// epilog2: export(0)
+		op4s_sdl_export_d_sse2(l, &arr[2*steps], 0);
+	}
+	else if ( scaling > 0 )
+	{
+		// ****** forward transform ******
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_inv_core_full_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_load_s_sse((in), (*(addr))); \
-	op4s_sdl2_descale_s_sse((in), (v)); \
-	op4s_sdl2_shuffle_input_low_s_sse((in), (c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
-	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
+		// *** init ***
 
-static
-void op4s_sdl6_pass_inv_core_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	// load
-	op4s_sdl2_load_s_ref(in, (*addr));
+		// this pointer is needed because of use of arr[] in import and export functions
+		double *restrict addr = arr;
 
-	// descale
-	op4s_sdl2_descale_s_ref(in, v);
+		// *** prolog2 ***
 
-	// shuffle + input-low
-	op4s_sdl2_shuffle_input_low_s_ref(in, z, r);
+		// prolog2: import(3)
+		op4s_sdl_import_d_sse2(l, arr, 3);
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_fwd_prolog_d_sse2(w, v, l, c, r, z, in, out, &addr);
+	
+		// prolog2: import(2)
+		op4s_sdl_import_d_sse2(l, arr, 2);
 
-	// output-high
-	op4s_sdl2_output_high_s_ref(out, l, z);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_fwd_prolog_d_sse2(w, v, l, c, r, z, in, out, &addr);
 
-	// (scale)
+		// prolog2: import(1)
+		op4s_sdl_import_d_sse2(l, arr, 1);
 
-	// save-shift
-	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_fwd_prolog_d_sse2(w, v, l, c, r, z, in, out, &addr);
 
-	// (update)
+		// prolog2: import(0)
+		op4s_sdl_import_d_sse2(l, arr, 0);
 
-	// pointers
-	(*addr) += 4;
-}
+		// *** core ***
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_inv_core_full_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_load_s_sse((in), (*(addr))); \
-	op4s_sdl2_descale_s_sse((in), (v)); \
-	op4s_sdl2_shuffle_input_low_s_sse((in), (z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
-	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
+		// core: for s = 0 to S do
+		for(int s = 0; s < S; s++)
+		{
+			// core: pass-core
+			op4s_sdl_pass_fwd_core_d_sse2(w, v, l, c, r, z, in, out, &addr);
 
-static
-void op4s_sdl6_pass_fwd_core_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	// load
-	op4s_sdl2_load_s_ref(in, (*addr));
+		}
 
-	// (descale)
+		// *** epilog2 ***
 
-	// shuffle + input-low
-	op4s_sdl2_shuffle_input_low_s_ref(in, z, r);
+		// epilog2: export(3)
+		op4s_sdl_export_d_sse2(l, &arr[2*steps], 3);
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+		// epilog2: pass-epilog
+		op4s_sdl_pass_fwd_epilog_d_sse2(w, v, l, c, r, z, in, out, &addr);
 
-	// output-high
-	op4s_sdl2_output_high_s_ref(out, l, z);
+		// epilog2: export(2)
+		op4s_sdl_export_d_sse2(l, &arr[2*steps], 2);
 
-	// (scale)
-	op4s_sdl2_scale_s_ref(out, v);
+		// epilog2: pass-epilog
+		op4s_sdl_pass_fwd_epilog_d_sse2(w, v, l, c, r, z, in, out, &addr);
 
-	// save-shift
-	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+		// epilog2: export(1)
+		op4s_sdl_export_d_sse2(l, &arr[2*steps], 1);
 
-	// (update)
+		// epilog2: pass-epilog
+		op4s_sdl_pass_fwd_epilog_d_sse2(w, v, l, c, r, z, in, out, &addr);
 
-	// pointers
-	(*addr) += 4;
+		// epilog2: export(0)
+		op4s_sdl_export_d_sse2(l, &arr[2*steps], 0);
+	}
+	else
+	{
+		// ****** transform w/o scaling ******
+
+		// not implemented yet
+		dwt_util_abort();
+	}
 }
+#endif /* __SSE2__ */
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_fwd_core_full_s_sse(w, v, l, r, z, in, out, addr) \
+#ifdef USE_AVX
+#define op4s_sdl_import_d_avx(l, addr, idx) \
 do { \
-	op4s_sdl2_load_s_sse((in), (*(addr))); \
-	op4s_sdl2_shuffle_input_low_s_sse((in), (z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
-	op4s_sdl2_scale_s_sse((out), (v)); \
-	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
-	(*(addr)) += 4; \
+	(l) = _mm256_blend_pd((l), _mm256_broadcast_sd(&(addr)[(idx)]), 1<<(idx)); \
 } while(0)
-#endif
-
-static
-void op4s_sdl6_pass_inv_postcore_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	// load
-	op4s_sdl2_load_s_ref(in, (*addr));
 
-	// descale
-	op4s_sdl2_descale_s_ref(in, v);
+#define op4s_sdl_load_d_avx(in, addr) \
+do { \
+	(in) = _mm_loadu_pd((const double *)(addr)); \
+} while(0)
 
-	// shuffle + input-low
-	op4s_sdl2_shuffle_input_low_s_ref(in, z, r);
-
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
-
-	// output-high
-	op4s_sdl2_output_high_s_ref(out, l, z);
-
-	// (scale)
-
-	// save-shift
-	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+#define op4s_sdl_shuffle_input_d_avx(in, c, r) \
+do { \
+	__m256d t; \
+	(t) = _mm256_permute2f128_pd((c), _mm256_castpd128_pd256(in), 0x21); \
+	(c) = _mm256_shuffle_pd((c), (t), 0x5); \
+	(t) = _mm256_permute2f128_pd((r), _mm256_castpd128_pd256(in), 0x21); \
+	(r) = _mm256_shuffle_pd((r), (t), 0xd); \
+} while(0)
 
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
+#define op4s_sdl_op_d_avx(z, c, w, l, r) \
+do { \
+	(z) = _mm256_add_pd((c), _mm256_mul_pd((w), _mm256_add_pd((l), (r)))); \
+} while(0)
 
-	// pointers
-	(*addr) += 4;
-}
+#define op4s_sdl_update_d_avx(c, l, r, z) \
+do { \
+	(c) = (l); \
+	(l) = (r); \
+	(r) = (z); \
+} while(0)
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_inv_postcore_full_s_sse(w, v, l, r, z, in, out, addr) \
+#define op4s_sdl_output_d_avx(out, l, z) \
 do { \
-	op4s_sdl2_load_s_sse((in), (*(addr))); \
-	op4s_sdl2_descale_s_sse((in), (v)); \
-	op4s_sdl2_shuffle_input_low_s_sse((in), (z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
-	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-	(*(addr)) += 4; \
+	(out) = _mm_unpacklo_pd(_mm256_castpd256_pd128(l), _mm256_castpd256_pd128(z)); \
 } while(0)
-#endif
 
-static
-void op4s_sdl6_pass_fwd_postcore_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	// load
-	op4s_sdl2_load_s_ref(in, (*addr));
+#define op4s_sdl_scale_d_avx(out, v) \
+do { \
+	(out) = _mm_mul_pd((out), (v)); \
+} while(0)
 
-	// (descale)
+#define op4s_sdl_descale_d_avx(in, v) \
+do { \
+	(in) = _mm_mul_pd((in), (v)); \
+} while(0)
 
-	// shuffle + input-low
-	op4s_sdl2_shuffle_input_low_s_ref(in, z, r);
+#define op4s_sdl_save_d_avx(out, addr) \
+do { \
+	_mm_storeu_pd((double *)(addr), (out)); \
+} while(0)
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+#define op4s_sdl_export_d_avx(l, addr, idx) \
+do { \
+	(addr)[(idx)] = (l)[(idx)]; \
+} while(0)
 
-	// output-high
-	op4s_sdl2_output_high_s_ref(out, l, z);
+#define op4s_sdl_pass_fwd_prolog_d_avx(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl_load_d_avx((in), (*(addr))+4); \
+	op4s_sdl_shuffle_input_d_avx((in), (c), (r)); \
+	op4s_sdl_op_d_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl_update_d_avx((c), (l), (r), (z)); \
+	(*(addr)) += 2; \
+} while(0)
 
-	// (scale)
-	op4s_sdl2_scale_s_ref(out, v);
+#define op4s_sdl_pass_inv_prolog_d_avx(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl_load_d_avx((in), (*(addr))+4); \
+	op4s_sdl_descale_d_avx((in), (v)); \
+	op4s_sdl_shuffle_input_d_avx((in), (c), (r)); \
+	op4s_sdl_op_d_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl_update_d_avx((c), (l), (r), (z)); \
+	(*(addr)) += 2; \
+} while(0)
 
-	// save-shift
-	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+#define op4s_sdl_pass_fwd_core_d_avx(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl_load_d_avx((in), (*(addr))+4); \
+	op4s_sdl_shuffle_input_d_avx((in), (c), (r)); \
+	op4s_sdl_op_d_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl_output_d_avx((out), (l), (z)); \
+	op4s_sdl_scale_d_avx((out), (v)); \
+	op4s_sdl_save_d_avx((out), (*(addr))-6); \
+	op4s_sdl_update_d_avx((c), (l), (r), (z)); \
+	(*(addr)) += 2; \
+} while(0)
 
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
+#define op4s_sdl_pass_inv_core_d_avx(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl_load_d_avx((in), (*(addr))+4); \
+	op4s_sdl_descale_d_avx((in), (v)); \
+	op4s_sdl_shuffle_input_d_avx((in), (c), (r)); \
+	op4s_sdl_op_d_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl_output_d_avx((out), (l), (z)); \
+	op4s_sdl_save_d_avx((out), (*(addr))-6); \
+	op4s_sdl_update_d_avx((c), (l), (r), (z)); \
+	(*(addr)) += 2; \
+} while(0)
 
-	// pointers
-	(*addr) += 4;
-}
+#define op4s_sdl_pass_fwd_epilog_d_avx(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl_shuffle_input_d_avx((in), (c), (r)); \
+	op4s_sdl_op_d_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl_output_d_avx((out), (l), (z)); \
+	op4s_sdl_scale_d_avx((out), (v)); \
+	op4s_sdl_save_d_avx((out), (*(addr))-6); \
+	op4s_sdl_update_d_avx((c), (l), (r), (z)); \
+	(*(addr)) += 2; \
+} while(0)
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_fwd_postcore_full_s_sse(w, v, l, r, z, in, out, addr) \
+#define op4s_sdl_pass_inv_epilog_d_avx(w, v, l, c, r, z, in, out, addr) \
 do { \
-	op4s_sdl2_load_s_sse((in), (*(addr))); \
-	op4s_sdl2_shuffle_input_low_s_sse((in), (z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
-	op4s_sdl2_scale_s_sse((out), (v)); \
-	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-	(*(addr)) += 4; \
+	op4s_sdl_shuffle_input_d_avx((in), (c), (r)); \
+	op4s_sdl_op_d_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl_output_d_avx((out), (l), (z)); \
+	op4s_sdl_save_d_avx((out), (*(addr))-6); \
+	op4s_sdl_update_d_avx((c), (l), (r), (z)); \
+	(*(addr)) += 2; \
 } while(0)
-#endif
 
+/**
+ * @brief Shifted double-loop algorithm, AVX implementation.
+ *
+ * The four lifting steps are held in one AVX register. This function
+ * processes 2 coefficients (even + odd) per one iteration.
+ */
 static
-void op4s_sdl2_pass_fwd_epilog_full_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+TARGET_AVX
+void accel_lift_op4s_main_sdl_avx_d(
+	double *restrict arr,
+	int steps,
+	double alpha,
+	double beta,
+	double gamma,
+	double delta,
+	double zeta,
+	int scaling)
 {
-	UNUSED(in);
+	// 6+ coeffs implies 3+ steps
+	assert( steps >= 3 );
 
-	// shuffle
-	op4s_sdl2_shuffle_s_ref(c, r);
+	const __m256d w = { delta, gamma, beta, alpha };
+	const __m128d v = { 1/zeta, zeta };
+	__m256d l = _mm256_setzero_pd();
+	__m256d c = _mm256_setzero_pd();
+	__m256d r = _mm256_setzero_pd();
+	__m256d z;
+	__m128d in = _mm_setzero_pd();
+	__m128d out;
 
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+	const int S = steps-3;
 
-	// output-high
-	op4s_sdl2_output_high_s_ref(out, l, z);
+	if( scaling < 0 )
+	{
+		// ****** inverse transform ******
 
-	// scale
-	op4s_sdl2_scale_s_ref(out, v);
+		// *** init ***
 
-	// save-shift
-	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+		// this pointer is needed because of use of arr[] in import and export functions
+		double *restrict addr = arr;
 
-	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
+		// *** prolog2 ***
 
-	// pointers
-	(*addr) += 4;
-}
+		// prolog2: import(3)
+		op4s_sdl_import_d_avx(l, arr, 3);
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_fwd_epilog_full_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_s_sse((c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
-	op4s_sdl2_scale_s_sse((out), (v)); \
-	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
+		// prolog2: pass-prolog
+		op4s_sdl_pass_inv_prolog_d_avx(w, v, l, c, r, z, in, out, &addr);
+	
+		// prolog2: import(2)
+		op4s_sdl_import_d_avx(l, arr, 2);
 
-static
-void op4s_sdl2_pass_inv_epilog_full_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(in);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_inv_prolog_d_avx(w, v, l, c, r, z, in, out, &addr);
 
-	// shuffle
-	op4s_sdl2_shuffle_s_ref(c, r);
+		// prolog2: import(1)
+		op4s_sdl_import_d_avx(l, arr, 1);
 
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_inv_prolog_d_avx(w, v, l, c, r, z, in, out, &addr);
 
-	// output-high
-	op4s_sdl2_output_high_s_ref(out, l, z);
+		// prolog2: import(0)
+		op4s_sdl_import_d_avx(l, arr, 0);
 
-	// (scale)
+		// *** core ***
 
-	// save-shift
-	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+		// core: for s = 0 to S do
+		for(int s = 0; s < S; s++)
+		{
+			// core: pass-core
+			op4s_sdl_pass_inv_core_d_avx(w, v, l, c, r, z, in, out, &addr);
 
-	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
+		}
 
-	// pointers
-	(*addr) += 4;
-}
+		// *** epilog2 ***
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_inv_epilog_full_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_s_sse((c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
-	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
+		// epilog2: export(3)
+		op4s_sdl_export_d_avx(l, &arr[2*steps], 3);
 
-static
-void op4s_sdl6_pass_inv_epilog_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(in);
+		// epilog2: pass-epilog
+		op4s_sdl_pass_inv_epilog_d_avx(w, v, l, c, r, z, in, out, &addr);
 
-	// shuffle
-	op4s_sdl2_shuffle_s_ref(z, r);
+		// epilog2: export(2)
+		op4s_sdl_export_d_avx(l, &arr[2*steps], 2);
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+		// epilog2: pass-epilog
+		op4s_sdl_pass_inv_epilog_d_avx(w, v, l, c, r, z, in, out, &addr);
 
-	// output-high
-	op4s_sdl2_output_high_s_ref(out, l, z);
+		// epilog2: export(1)
+		op4s_sdl_export_d_avx(l, &arr[2*steps], 1);
 
-	// (scale)
+		// epilog2: pass-epilog
+		op4s_sdl_pass_inv_epilog_d_avx(w, v, l, c, r, z, in, out, &addr);
 
-	// save-shift
-	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+		// epilog2: export(0)
+		op4s_sdl_export_d_avx(l, &arr[2*steps], 0);
+	}
+	else if ( scaling > 0 )
+	{
+		// ****** forward transform ******
 
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
+		// *** init ***
 
-	// pointers
-	(*addr) += 4;
-}
+		// this pointer is needed because of use of arr[] in import and export functions
+		double *restrict addr = arr;
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_inv_epilog_full_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_s_sse((z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
-	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
+		// *** prolog2 ***
 
-static
-void op4s_sdl6_pass_fwd_epilog_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(in);
+		// prolog2: import(3)
+		op4s_sdl_import_d_avx(l, arr, 3);
 
-	// shuffle
-	op4s_sdl2_shuffle_s_ref(z, r);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_fwd_prolog_d_avx(w, v, l, c, r, z, in, out, &addr);
+	
+		// prolog2: import(2)
+		op4s_sdl_import_d_avx(l, arr, 2);
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_fwd_prolog_d_avx(w, v, l, c, r, z, in, out, &addr);
 
-	// output-high
-	op4s_sdl2_output_high_s_ref(out, l, z);
+		// prolog2: import(1)
+		op4s_sdl_import_d_avx(l, arr, 1);
 
-	// (scale)
-	op4s_sdl2_scale_s_ref(out, v);
+		// prolog2: pass-prolog
+		op4s_sdl_pass_fwd_prolog_d_avx(w, v, l, c, r, z, in, out, &addr);
 
-	// save-shift
-	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+		// prolog2: import(0)
+		op4s_sdl_import_d_avx(l, arr, 0);
 
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
+		// *** core ***
 
-	// pointers
-	(*addr) += 4;
-}
+		// core: for s = 0 to S do
+		for(int s = 0; s < S; s++)
+		{
+			// core: pass-core
+			op4s_sdl_pass_fwd_core_d_avx(w, v, l, c, r, z, in, out, &addr);
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_fwd_epilog_full_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_s_sse((z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
-	op4s_sdl2_scale_s_sse((out), (v)); \
-	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-	(*(addr)) += 4; \
-} while(0)
-#endif
+		}
 
-static
-void op4s_sdl2_pass_fwd_epilog_light_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(in);
-	UNUSED(addr);
+		// *** epilog2 ***
 
-	// shuffle
-	op4s_sdl2_shuffle_s_ref(c, r);
+		// epilog2: export(3)
+		op4s_sdl_export_d_avx(l, &arr[2*steps], 3);
 
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+		// epilog2: pass-epilog
+		op4s_sdl_pass_fwd_epilog_d_avx(w, v, l, c, r, z, in, out, &addr);
 
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
+		// epilog2: export(2)
+		op4s_sdl_export_d_avx(l, &arr[2*steps], 2);
 
-	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
-}
+		// epilog2: pass-epilog
+		op4s_sdl_pass_fwd_epilog_d_avx(w, v, l, c, r, z, in, out, &addr);
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_fwd_epilog_light_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_s_sse((c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-} while(0)
-#endif
+		// epilog2: export(1)
+		op4s_sdl_export_d_avx(l, &arr[2*steps], 1);
+
+		// epilog2: pass-epilog
+		op4s_sdl_pass_fwd_epilog_d_avx(w, v, l, c, r, z, in, out, &addr);
+
+		// epilog2: export(0)
+		op4s_sdl_export_d_avx(l, &arr[2*steps], 0);
+	}
+	else
+	{
+		// ****** transform w/o scaling ******
+
+		// not implemented yet
+		dwt_util_abort();
+	}
+}
+#endif /* USE_AVX */
 
+/**
+ * @brief Lifting of double precision data using the selected acceleration.
+ *
+ * Counterpart of accel_lift_op4s_s. The block-acceleration (BCE) is
+ * available in single precision only, the multi-loop algorithm is used
+ * instead.
+ */
 static
-void op4s_sdl2_pass_inv_epilog_light_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+void accel_lift_op4s_d(
+	double *restrict arr,
+	int off,
+	int len,
+	double alpha,
+	double beta,
+	double gamma,
+	double delta,
+	double zeta,
+	int scaling)
 {
-	UNUSED(v);
-	UNUSED(in);
-	UNUSED(addr);
+	assert( len >= 2 );
+	assert( 0 == off || 1 == off );
 
-	// shuffle
-	op4s_sdl2_shuffle_s_ref(c, r);
+	if( len-off < 4 )
+	{
+		accel_lift_op4s_short_d(arr, off, len, alpha, beta, gamma, delta, zeta, scaling);
+	}
+	else
+	{
+		accel_lift_op4s_prolog_d(arr, off, len, alpha, beta, gamma, delta, zeta, scaling);
 
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+		const struct accel_kernels *accel = get_accel();
+		const int steps = (to_even(len-off)-4)/2;
 
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
+		if( steps >= 3 && NULL != accel->main_sdl_d )
+			accel->main_sdl_d(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
+		else if( NULL != accel->main_d )
+			accel->main_d(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
+		else
+			accel_lift_op4s_main_d(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
 
-	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
+		accel_lift_op4s_epilog_d(arr, off, len, alpha, beta, gamma, delta, zeta, scaling);
+	}
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_inv_epilog_light_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_s_sse((c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-} while(0)
-#endif
-
+/**
+ * @brief Non-accelerated lifting with two lifting steps.
+ *
+ * Double precision counterpart of accel_lift_op2s_main_s.
+ */
 static
-void op4s_sdl6_pass_inv_epilog_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+void accel_lift_op2s_main_d(
+	double *arr,
+	int steps,
+	double alpha,
+	double beta,
+	double zeta,
+	int scaling)
 {
-	UNUSED(v);
-	UNUSED(in);
-	UNUSED(addr);
-
-	// shuffle
-	op4s_sdl2_shuffle_s_ref(z, r);
+	assert( steps >= 0 );
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+	if( scaling < 0 )
+	{
+		for(int s = 0; s < steps; s++)
+		{
+			arr[2+s*2] *= 1/zeta;
+		}
 
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
+		for(int s = 0; s < steps; s++)
+		{
+			arr[3+s*2] *= zeta;
+		}
+	}
 
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
-}
+	const double coeffs[2] = {beta, alpha};
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_inv_epilog_light_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_s_sse((z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-} while(0)
-#endif
+	for(int off = 2; off >= 1; off--)
+	{
+		double *out = arr+off;
 
-static
-void op4s_sdl6_pass_fwd_epilog_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(in);
-	UNUSED(addr);
+		const double c = coeffs[off-1];
 
-	// shuffle
-	op4s_sdl2_shuffle_s_ref(z, r);
+		for(int s = 0; s < steps; s++)
+		{
+			out[0] += c * (out[-1] + out[+1]);
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+			out += 2;
+		}
+	}
 
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
+	if( scaling > 0 )
+	{
+		for(int s = 0; s < steps; s++)
+		{
+			arr[0+s*2] *= 1/zeta;
+		}
 
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
+		for(int s = 0; s < steps; s++)
+		{
+			arr[1+s*2] *= zeta;
+		}
+	}
 }
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_fwd_epilog_light_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_s_sse((z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-} while(0)
-#endif
-
+/**
+ * @brief One iteration of two-step double-loop algorithm.
+ *
+ * Double precision counterpart of op2s_dl_pass_s_ref.
+ */
 static
-void op4s_sdl2_pass_fwd_epilog_flush_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+void op2s_dl_pass_d_ref(const double *w, const double *v, double *l, double *restrict addr, int scaling)
 {
-	UNUSED(in);
-
-	// shuffle
-	op4s_sdl2_shuffle_s_ref(c, r);
+	// inputs
+	double in0 = addr[2];
+	double in1 = addr[3];
 
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+	// descales
+	if( scaling < 0 )
+	{
+		in0 *= v[0];
+		in1 *= v[1];
+	}
 
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
+	// operation: predict of the loaded pair, update of the stored one
+	const double r0 = in0 + w[1] * (l[1] + in1);
+	double out0 = l[0];
+	double out1 = l[1] + w[0] * (l[0] + r0);
 
-	// scale
-	op4s_sdl2_scale_s_ref(out, v);
+	// scales
+	if( scaling > 0 )
+	{
+		out0 *= v[0];
+		out1 *= v[1];
+	}
 
-	// save
-	op4s_sdl2_save_s_ref(out, (*addr)-12);
+	// outputs
+	addr[0] = out0;
+	addr[1] = out1;
 
-	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
+	// update l[]
+	l[0] = r0;
+	l[1] = in1;
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_fwd_epilog_flush_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_s_sse((c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
-	op4s_sdl2_scale_s_sse((out), (v)); \
-	op4s_sdl2_save_s_sse((out), (*(addr))-12); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-} while(0)
-#endif
-
+/**
+ * @brief Double-loop algorithm with two lifting steps.
+ *
+ * Double precision counterpart of accel_lift_op2s_main_dl_s.
+ */
 static
-void op4s_sdl2_pass_inv_epilog_flush_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+void accel_lift_op2s_main_dl_d(
+	double *restrict arr,
+	int steps,
+	double alpha,
+	double beta,
+	double zeta,
+	int scaling)
 {
-	UNUSED(v);
-	UNUSED(in);
-
-	// shuffle
-	op4s_sdl2_shuffle_s_ref(c, r);
-
-	// operation
-	op4s_sdl2_op_s_ref(z, c, w, l, r);
+	assert( steps >= 0 );
 
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
+	const double w[2] = { beta, alpha };
+	const double v[2] = { 1/zeta, zeta };
 
-	// (scale)
+	// slide in left border
+	double l[2] = { arr[0], arr[1] };
 
-	// save
-	op4s_sdl2_save_s_ref(out, (*addr)-12);
+	for(int s = 0; s < steps; s++)
+		op2s_dl_pass_d_ref(w, v, l, arr+2*s, scaling);
 
-	// update
-	op4s_sdl2_update_s_ref(c, l, r, z);
+	// slide out right border
+	arr[2*steps+0] = l[0];
+	arr[2*steps+1] = l[1];
 }
 
-#ifdef __SSE__
-#define op4s_sdl2_pass_inv_epilog_flush_s_sse(w, v, l, c, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_s_sse((c), (r)); \
-	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
-	op4s_sdl2_save_s_sse((out), (*(addr))-12); \
-	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
-} while(0)
-#endif
-
+#ifdef __SSE2__
+/**
+ * @brief Shifted double-loop algorithm with two lifting steps, SSE2
+ * implementation.
+ *
+ * Double precision counterpart of accel_lift_op2s_main_sdl_sse_s. This
+ * function processes 4 coefficients (2 even + 2 odd) per one iteration.
+ */
 static
-void op4s_sdl6_pass_inv_epilog_flush_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+void accel_lift_op2s_main_sdl_sse2_d(
+	double *restrict arr,
+	int steps,
+	double alpha,
+	double beta,
+	double zeta,
+	int scaling)
 {
-	UNUSED(v);
-	UNUSED(in);
+	assert( steps >= 0 );
 
-	// shuffle
-	op4s_sdl2_shuffle_s_ref(z, r);
+	const double w[2] = { beta, alpha };
+	const double v[2] = { 1/zeta, zeta };
 
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
+	const __m128d wa = _mm_set1_pd(alpha);
+	const __m128d wb = _mm_set1_pd(beta);
+	const __m128d ve = _mm_set1_pd(v[0]);
+	const __m128d vo = _mm_set1_pd(v[1]);
 
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
+	// slide in left border, only the last elements are used
+	__m128d le = _mm_set1_pd(arr[0]);
+	__m128d lo = _mm_set1_pd(arr[1]);
 
-	// (scale)
+	int s = 0;
 
-	// save
-	op4s_sdl2_save_s_ref(out, (*addr)-12);
+	for(; s+2 <= steps; s += 2)
+	{
+		double *restrict addr = arr+2*s;
 
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
-}
+		// load + split
+		const __m128d x0 = _mm_loadu_pd(addr+2);
+		const __m128d x1 = _mm_loadu_pd(addr+4);
 
-#ifdef __SSE__
-#define op4s_sdl6_pass_inv_epilog_flush_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_s_sse((z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
-	op4s_sdl2_save_s_sse((out), (*(addr))-12); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-} while(0)
-#endif
-
-static
-void op4s_sdl6_pass_fwd_epilog_flush_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(in);
-
-	// shuffle
-	op4s_sdl2_shuffle_s_ref(z, r);
-
-	// operation
-	op4s_sdl6_op_s_ref(z, w, l, r);
-
-	// output-low
-	op4s_sdl2_output_low_s_ref(out, l, z);
-
-	// (scale)
-	op4s_sdl2_scale_s_ref(out, v);
-
-	// save
-	op4s_sdl2_save_s_ref(out, (*addr)-12);
-
-	// update
-	op4s_sdl6_update_s_ref(z, l, r);
-}
-
-#ifdef __SSE__
-#define op4s_sdl6_pass_fwd_epilog_flush_s_sse(w, v, l, r, z, in, out, addr) \
-do { \
-	op4s_sdl2_shuffle_s_sse((z), (r)); \
-	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
-	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
-	op4s_sdl2_scale_s_sse((out), (v)); \
-	op4s_sdl2_save_s_sse((out), (*(addr))-12); \
-	op4s_sdl6_update_s_sse((z), (l), (r)); \
-} while(0)
-#endif
+		__m128d e = _mm_unpacklo_pd(x0, x1);
+		__m128d o = _mm_unpackhi_pd(x0, x1);
 
-static
-void op4s_sdl_pass_fwd_prolog_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	UNUSED(v);
-	UNUSED(out);
+		// descale
+		if( scaling < 0 )
+		{
+			e = _mm_mul_pd(e, ve);
+			o = _mm_mul_pd(o, vo);
+		}
 
-	// shuffle
-	op4s_sdl_shuffle_s_ref(c, r);
+		// shift odd coefficients: [ lo1 o0 ]
+		__m128d ol = _mm_shuffle_pd(lo, o, _MM_SHUFFLE2(0,1));
 
-	// load
-	op4s_sdl_load_s_ref(in, *addr+4);
+		// predict
+		e = _mm_add_pd(e, _mm_mul_pd(wa, _mm_add_pd(ol, o)));
 
-	// (descale)
+		// shift even coefficients: [ le1 e0 ]
+		__m128d el = _mm_shuffle_pd(le, e, _MM_SHUFFLE2(0,1));
 
-	// input
-	op4s_sdl_input_s_ref(in, c, r);
+		// update
+		ol = _mm_add_pd(ol, _mm_mul_pd(wb, _mm_add_pd(el, e)));
 
-	// operation
-	op4s_sdl_op_s_ref(z, c, w, l, r);
+		// scale
+		if( scaling > 0 )
+		{
+			el = _mm_mul_pd(el, ve);
+			ol = _mm_mul_pd(ol, vo);
+		}
 
-	// (output)
+		// merge + save
+		_mm_storeu_pd(addr+0, _mm_unpacklo_pd(el, ol));
+		_mm_storeu_pd(addr+2, _mm_unpackhi_pd(el, ol));
 
-	// (scale)
+		le = e;
+		lo = o;
+	}
 
-	// (save)
+	double l[2] = {
+		_mm_cvtsd_f64(_mm_unpackhi_pd(le, le)),
+		_mm_cvtsd_f64(_mm_unpackhi_pd(lo, lo))
+	};
 
-	// update
-	op4s_sdl_update_s_ref(c, l, r, z);
+	for(; s < steps; s++)
+		op2s_dl_pass_d_ref(w, v, l, arr+2*s, scaling);
 
-	// pointers
-	(*addr) += 2;
+	// slide out right border
+	arr[2*steps+0] = l[0];
+	arr[2*steps+1] = l[1];
 }
+#endif /* __SSE2__ */
 
+#ifdef USE_AVX
+/**
+ * @brief Shifted double-loop algorithm with two lifting steps, AVX
+ * implementation.
+ *
+ * Double precision counterpart of accel_lift_op2s_main_sdl_avx_s. This
+ * function processes 8 coefficients (4 even + 4 odd) per one iteration.
+ */
 static
-void op4s_sdl_pass_inv_prolog_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+TARGET_AVX
+void accel_lift_op2s_main_sdl_avx_d(
+	double *restrict arr,
+	int steps,
+	double alpha,
+	double beta,
+	double zeta,
+	int scaling)
 {
-	UNUSED(out);
+	assert( steps >= 0 );
 
-	// shuffle
-	op4s_sdl_shuffle_s_ref(c, r);
+	const double w[2] = { beta, alpha };
+	const double v[2] = { 1/zeta, zeta };
 
-	// load
-	op4s_sdl_load_s_ref(in, *addr+4);
+	const __m256d wa = _mm256_set1_pd(alpha);
+	const __m256d wb = _mm256_set1_pd(beta);
+	const __m256d ve = _mm256_set1_pd(v[0]);
+	const __m256d vo = _mm256_set1_pd(v[1]);
 
-	// descale
-	op4s_sdl_descale_s_ref(in, v);
+	// slide in left border, only the last elements are used
+	__m256d le = _mm256_set1_pd(arr[0]);
+	__m256d lo = _mm256_set1_pd(arr[1]);
 
-	// input
-	op4s_sdl_input_s_ref(in, c, r);
+	int s = 0;
 
-	// operation
-	op4s_sdl_op_s_ref(z, c, w, l, r);
+	for(; s+4 <= steps; s += 4)
+	{
+		double *restrict addr = arr+2*s;
 
-	// (output)
+		// load + split
+		const __m256d x0 = _mm256_loadu_pd(addr+2);
+		const __m256d x1 = _mm256_loadu_pd(addr+6);
+		const __m256d y0 = _mm256_permute2f128_pd(x0, x1, 0x20);
+		const __m256d y1 = _mm256_permute2f128_pd(x0, x1, 0x31);
 
-	// (scale)
+		__m256d e = _mm256_unpacklo_pd(y0, y1);
+		__m256d o = _mm256_unpackhi_pd(y0, y1);
 
-	// (save)
+		// descale
+		if( scaling < 0 )
+		{
+			e = _mm256_mul_pd(e, ve);
+			o = _mm256_mul_pd(o, vo);
+		}
 
-	// update
-	op4s_sdl_update_s_ref(c, l, r, z);
+		// shift odd coefficients: [ lo3 o0 | o1 o2 ]
+		__m256d ol = _mm256_shuffle_pd(_mm256_permute2f128_pd(lo, o, 0x21), o, 0x5);
 
-	// pointers
-	(*addr) += 2;
-}
+		// predict
+		e = _mm256_add_pd(e, _mm256_mul_pd(wa, _mm256_add_pd(ol, o)));
 
-static
-void op4s_sdl_pass_fwd_core_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
-{
-	// shuffle
-	op4s_sdl_shuffle_s_ref(c, r);
+		// shift even coefficients: [ le3 e0 | e1 e2 ]
+		__m256d el = _mm256_shuffle_pd(_mm256_permute2f128_pd(le, e, 0x21), e, 0x5);
 
-	// load
-	op4s_sdl_load_s_ref(in, *addr+4);
+		// update
+		ol = _mm256_add_pd(ol, _mm256_mul_pd(wb, _mm256_add_pd(el, e)));
 
-	// (descale)
+		// scale
+		if( scaling > 0 )
+		{
+			el = _mm256_mul_pd(el, ve);
+			ol = _mm256_mul_pd(ol, vo);
+		}
 
-	// input
-	op4s_sdl_input_s_ref(in, c, r);
+		// merge + save
+		const __m256d z0 = _mm256_unpacklo_pd(el, ol);
+		const __m256d z1 = _mm256_unpackhi_pd(el, ol);
 
-	// operation
-	op4s_sdl_op_s_ref(z, c, w, l, r);
+		_mm256_storeu_pd(addr+0, _mm256_permute2f128_pd(z0, z1, 0x20));
+		_mm256_storeu_pd(addr+4, _mm256_permute2f128_pd(z0, z1, 0x31));
 
-	// output
-	op4s_sdl_output_s_ref(out, l, z);
+		le = e;
+		lo = o;
+	}
 
-	// scale
-	op4s_sdl_scale_s_ref(out, v);
+	const __m128d leh = _mm256_extractf128_pd(le, 1);
+	const __m128d loh = _mm256_extractf128_pd(lo, 1);
 
-	// save
-	op4s_sdl_save_s_ref(out, *addr-6);
+	double l[2] = {
+		_mm_cvtsd_f64(_mm_unpackhi_pd(leh, leh)),
+		_mm_cvtsd_f64(_mm_unpackhi_pd(loh, loh))
+	};
 
-	// update
-	op4s_sdl_update_s_ref(c, l, r, z);
+	for(; s < steps; s++)
+		op2s_dl_pass_d_ref(w, v, l, arr+2*s, scaling);
 
-	// pointers
-	(*addr) += 2;
+	// slide out right border
+	arr[2*steps+0] = l[0];
+	arr[2*steps+1] = l[1];
 }
+#endif /* USE_AVX */
 
+/**
+ * @brief Prolog of the lifting with two lifting steps.
+ *
+ * Double precision counterpart of accel_lift_op2s_prolog_s.
+ */
 static
-void op4s_sdl_pass_inv_core_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+void accel_lift_op2s_prolog_d(
+	double *arr,
+	int off,
+	int N,
+	double alpha,
+	double beta,
+	double zeta,
+	int scaling)
 {
-	// shuffle
-	op4s_sdl_shuffle_s_ref(c, r);
-
-	// load
-	op4s_sdl_load_s_ref(in, *addr+4);
+	assert( N-off >= 2 );
 
-	// descale
-	op4s_sdl_descale_s_ref(in, v);
+#ifdef NDEBUG
+	UNUSED(N);
+#endif
 
-	// input
-	op4s_sdl_input_s_ref(in, c, r);
+	if(off)
+	{
+		// inv-scaling
+		if( scaling < 0 )
+		{
+			arr[0] *= zeta;
+			arr[1] *= 1/zeta;
+			arr[2] *= zeta;
+		}
 
-	// operation
-	op4s_sdl_op_s_ref(z, c, w, l, r);
+		// alpha
+		arr[1] += alpha*(arr[0]+arr[2]);
 
-	// output
-	op4s_sdl_output_s_ref(out, l, z);
+		// beta
+		arr[0] += 2*beta*(arr[1]);
 
-	// (scale)
+		// scaling
+		if( scaling > 0 )
+		{
+			arr[0] *= zeta;
+		}
+	}
+	else
+	{
+		// inv-scaling
+		if( scaling < 0 )
+		{
+			arr[0] *= 1/zeta;
+			arr[1] *= zeta;
+		}
 
-	// save
-	op4s_sdl_save_s_ref(out, *addr-6);
+		// alpha
+		arr[0] += 2*alpha*(arr[1]);
 
-	// update
-	op4s_sdl_update_s_ref(c, l, r, z);
+		// beta
+		// none
 
-	// pointers
-	(*addr) += 2;
+		// scaling
+		// none
+	}
 }
 
+/**
+ * @brief Epilog of the lifting with two lifting steps.
+ *
+ * Double precision counterpart of accel_lift_op2s_epilog_s.
+ */
 static
-void op4s_sdl_pass_fwd_epilog_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+void accel_lift_op2s_epilog_d(
+	double *arr,
+	int off,
+	int N,
+	double alpha,
+	double beta,
+	double zeta,
+	int scaling)
 {
-	UNUSED(in);
-
-	// shuffle
-	op4s_sdl_shuffle_s_ref(c, r);
-
-	// (load)
-
-	// (descale)
+	assert( N-off >= 2 );
 
-	// (input)
+	if( is_even(N-off) )
+	{
+		// inv-scaling
+		// none
 
-	// operation
-	op4s_sdl_op_s_ref(z, c, w, l, r);
+		// alpha
+		// none
 
-	// output
-	op4s_sdl_output_s_ref(out, l, z);
+		// beta
+		arr[N-1] += 2*beta*(arr[N-2]);
 
-	// scale
-	op4s_sdl_scale_s_ref(out, v);
+		// scaling
+		if( scaling > 0 )
+		{
+			arr[N-2] *= 1/zeta;
+			arr[N-1] *= zeta;
+		}
+	}
+	else /* is_odd(N-off) */
+	{
+		// inv-scaling
+		if( scaling < 0 )
+		{
+			arr[N-1] *= 1/zeta;
+		}
 
-	// save
-	op4s_sdl_save_s_ref(out, *addr-6);
+		// alpha
+		arr[N-1] += 2*alpha*(arr[N-2]);
 
-	// update
-	op4s_sdl_update_s_ref(c, l, r, z);
+		// beta
+		arr[N-2] += beta*(arr[N-1]+arr[N-3]);
 
-	// pointers
-	(*addr) += 2;
+		// scaling
+		if( scaling > 0 )
+		{
+			arr[N-3] *= 1/zeta;
+			arr[N-2] *= zeta;
+			arr[N-1] *= 1/zeta;
+		}
+	}
 }
 
+/**
+ * @brief Prolog and epilog for N-off < 2.
+ */
 static
-void op4s_sdl_pass_inv_epilog_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+void accel_lift_op2s_short_d(
+	double *arr,
+	int off,
+	int N,
+	double alpha,
+	double beta,
+	double zeta,
+	int scaling)
 {
-	UNUSED(v);
-	UNUSED(in);
-
-	// shuffle
-	op4s_sdl_shuffle_s_ref(c, r);
+	assert( 1 == off && 2 == N );
 
-	// (load)
-
-	// (descale)
-
-	// (input)
-
-	// operation
-	op4s_sdl_op_s_ref(z, c, w, l, r);
-
-	// (output)
-	op4s_sdl_output_s_ref(out, l, z);
+	UNUSED(off);
+	UNUSED(N);
 
-	// (scale)
+	// inv-scaling
+	if( scaling < 0 )
+	{
+		arr[0] *= zeta;
+		arr[1] *= 1/zeta;
+	}
 
-	// save
-	op4s_sdl_save_s_ref(out, *addr-6);
+	// alpha
+	arr[1] += 2*alpha*(arr[0]);
 
-	// update
-	op4s_sdl_update_s_ref(c, l, r, z);
+	// beta
+	arr[0] += 2*beta*(arr[1]);
 
-	// pointers
-	(*addr) += 2;
+	// scaling
+	if( scaling > 0 )
+	{
+		arr[0] *= zeta;
+		arr[1] *= 1/zeta;
+	}
 }
 
-
-#ifdef __SSE__
 /**
- * @brief Shifted Double-Loop implementation of lifting scheme with 6
- * iterations merger.
+ * @brief Lifting of double precision data with two lifting steps using the
+ * selected acceleration.
  *
- * i.e. 12 = (6)*(2) = (2*3)*(2) coefficients per one iteration.
+ * Counterpart of accel_lift_op2s_s.
  */
 static
-void accel_lift_op4s_main_sdl6_sse_s(
-	float *restrict arr,
-	int steps,
+void accel_lift_op2s_d(
+	double *restrict arr,
+	int off,
+	int len,
+	double alpha,
+	double beta,
+	double zeta,
+	int scaling)
+{
+	assert( len >= 2 );
+	assert( 0 == off || 1 == off );
+
+	if( len-off < 2 )
+	{
+		accel_lift_op2s_short_d(arr, off, len, alpha, beta, zeta, scaling);
+	}
+	else
+	{
+		accel_lift_op2s_prolog_d(arr, off, len, alpha, beta, zeta, scaling);
+
+		const struct accel_kernels *accel = get_accel();
+		const int steps = (to_even(len-off)-2)/2;
+
+		if( NULL != accel->main_op2s_d )
+			accel->main_op2s_d(arr+off, steps, alpha, beta, zeta, scaling);
+		else
+			accel_lift_op2s_main_d(arr+off, steps, alpha, beta, zeta, scaling);
+
+		accel_lift_op2s_epilog_d(arr, off, len, alpha, beta, zeta, scaling);
+	}
+}
+
+void dwt_cdf97_f_d(
+	const double *src,
+	double *dst,
+	double *tmp,
+	int N)
+{
+	dwt_cdf97_f_ex_d(
+		src,
+		dst,
+		dst + ceil_div2(N),
+		tmp,
+		N
+	);
+}
+
+void dwt_cdf53_f_d(
+	const double *src,
+	double *dst,
+	double *tmp,
+	int N)
+{
+	dwt_cdf53_f_ex_d(
+		src,
+		dst,
+		dst + ceil_div2(N),
+		tmp,
+		N
+	);
+}
+
+void dwt_cdf97_f_s(
+	const float *src,
+	float *dst,
+	float *tmp,
+	int N)
+{
+	dwt_cdf97_f_ex_s(
+		src,
+		dst,
+		dst + ceil_div2(N),
+		tmp,
+		N
+	);
+}
+
+void dwt_cdf53_f_s(
+	const float *src,
+	float *dst,
+	float *tmp,
+	int N)
+{
+	dwt_cdf53_f_ex_s(
+		src,
+		dst,
+		dst + ceil_div2(N),
+		tmp,
+		N
+	);
+}
+
+void dwt_cdf97_i_d(
+	const double *src,
+	double *dst,
+	double *tmp,
+	int N)
+{
+	dwt_cdf97_i_ex_d(
+		src,
+		src + ceil_div2(N),
+		dst,
+		tmp,
+		N
+	);
+}
+
+void dwt_cdf53_i_d(
+	const double *src,
+	double *dst,
+	double *tmp,
+	int N)
+{
+	dwt_cdf53_i_ex_d(
+		src,
+		src + ceil_div2(N),
+		dst,
+		tmp,
+		N
+	);
+}
+
+void dwt_cdf97_i_s(
+	const float *src,
+	float *dst,
+	float *tmp,
+	int N)
+{
+	dwt_cdf97_i_ex_s(
+		src,
+		src + ceil_div2(N),
+		dst,
+		tmp,
+		N
+	);
+}
+
+void dwt_cdf53_i_s(
+	const float *src,
+	float *dst,
+	float *tmp,
+	int N)
+{
+	dwt_cdf53_i_ex_s(
+		src,
+		src + ceil_div2(N),
+		dst,
+		tmp,
+		N
+	);
+}
+
+void dwt_cdf97_f_ex_d(
+	const double *src,
+	double *dst_l,
+	double *dst_h,
+	double *tmp,
+	int N)
+{
+	dwt_cdf97_f_ex_stride_d(
+		src,
+		dst_l,
+		dst_h,
+		tmp,
+		N,
+		sizeof(double)
+	);
+}
+
+void dwt_cdf53_f_ex_d(
+	const double *src,
+	double *dst_l,
+	double *dst_h,
+	double *tmp,
+	int N)
+{
+	dwt_cdf53_f_ex_stride_d(
+		src,
+		dst_l,
+		dst_h,
+		tmp,
+		N,
+		sizeof(double)
+	);
+}
+
+void dwt_cdf97_f_ex_s(
+	const float *src,
+	float *dst_l,
+	float *dst_h,
+	float *tmp,
+	int N)
+{
+	dwt_cdf97_f_ex_stride_s(
+		src,
+		dst_l,
+		dst_h,
+		tmp,
+		N,
+		sizeof(float)
+	);
+}
+
+void dwt_cdf53_f_ex_s(
+	const float *src,
+	float *dst_l,
+	float *dst_h,
+	float *tmp,
+	int N)
+{
+	dwt_cdf53_f_ex_stride_s(
+		src,
+		dst_l,
+		dst_h,
+		tmp,
+		N,
+		sizeof(float)
+	);
+}
+
+void dwt_cdf97_f_ex_stride_d(
+	const double *src,
+	double *dst_l,
+	double *dst_h,
+	double *tmp,
+	int N,
+	int stride)
+{
+	assert( N >= 0 && NULL != src && NULL != dst_l && NULL != dst_h && NULL != tmp && 0 != stride );
+
+	// fix for small N
+	if(N < 2)
+	{
+		if(1 == N)
+			dst_l[0] = src[0] * dwt_cdf97_s1_d;
+		return;
+	}
+
+	// copy src into tmp
+	dwt_util_memcpy_stride_d(tmp, sizeof(double), src, stride, N);
+
+	accel_lift_op4s_d(tmp, 1, N, -dwt_cdf97_p1_d, dwt_cdf97_u1_d, -dwt_cdf97_p2_d, dwt_cdf97_u2_d, dwt_cdf97_s1_d, +1);
+
+	// copy tmp into dst
+	dwt_util_memcpy_stride_d(dst_l, stride, tmp+0, 2*sizeof(double),  ceil_div2(N));
+	dwt_util_memcpy_stride_d(dst_h, stride, tmp+1, 2*sizeof(double), floor_div2(N));
+}
+
+void dwt_cdf53_f_ex_stride_d(
+	const double *src,
+	double *dst_l,
+	double *dst_h,
+	double *tmp,
+	int N,
+	int stride)
+{
+	assert( N >= 0 && NULL != src && NULL != dst_l && NULL != dst_h && NULL != tmp && 0 != stride );
+
+	// fix for small N
+	if(N < 2)
+	{
+		if(1 == N)
+			dst_l[0] = src[0] * dwt_cdf53_s1_d;
+		return;
+	}
+
+	// copy src into tmp
+	dwt_util_memcpy_stride_d(tmp, sizeof(double), src, stride, N);
+
+	accel_lift_op2s_d(tmp, 1, N, -dwt_cdf53_p1_d, dwt_cdf53_u1_d, dwt_cdf53_s1_d, +1);
+
+	// copy tmp into dst
+	dwt_util_memcpy_stride_d(dst_l, stride, tmp+0, 2*sizeof(double),  ceil_div2(N));
+	dwt_util_memcpy_stride_d(dst_h, stride, tmp+1, 2*sizeof(double), floor_div2(N));
+}
+
+/**
+ * @brief Non-accelerated PicoBlaze operation.
+ *
+ * Two pairs (predict and update) of lifting steps and coefficients scaling
+ * merged together.
+ *
+ * @param[in] scaling Perform scaling of coefficients. Possible values are:
+ *   @li s = 0 : without scaling,
+ *   @li s > 0 : scaling after lifting,
+ *   @li s < 0 : scaling before lifting.
+ */
+static
+void accel_lift_op4s_main_s(
+	float *arr,
+	int steps,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	assert( steps >= 0 );
+
+	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+	{
+		float *arr_local = calc_temp_offset_s(arr, w);
+
+		if( scaling < 0 )
+		{
+			for(int s = 0; s < steps; s++)
+			{
+				arr_local[4+s*2] *= 1/zeta;
+			}
+		
+			for(int s = 0; s < steps; s++)
+			{
+				arr_local[5+s*2] *= zeta;
+			}
+		}
+
+		const float coeffs[4] = {delta, gamma, beta, alpha};
+
+		for(int off = 4; off >= 1; off--)
+		{
+			float *out = arr_local+off;
+
+			const float c = coeffs[off-1];
+
+			for(int s = 0; s < steps; s++)
+			{
+				out[0] += c * (out[-1] + out[+1]);
+
+				out += 2;
+			}
+		}
+
+		if( scaling > 0 )
+		{
+			for(int s = 0; s < steps; s++)
+			{
+				arr_local[0+s*2] *= 1/zeta;
+			}
+
+			for(int s = 0; s < steps; s++)
+			{
+				arr_local[1+s*2] *= zeta;
+			}
+		}
+	}
+}
+
+static
+void op4s_sdl2_import_preload_s_ref(float *out, const float *restrict addr)
+{
+	out[0] = addr[0];
+	out[1] = addr[1];
+	out[2] = addr[2];
+	out[3] = addr[3];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_import_preload_s_sse(out, addr) \
+do { \
+	(out) = _mm_load_ps(addr); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_import_s_ref(float *l, int idx, const float *out)
+{
+	l[idx] = out[idx];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_import_s_sse(l, idx, out) \
+do { \
+	(out) = _mm_shuffle_ps((out), (out), _MM_SHUFFLE(2,1,0,3)); \
+	(l) = _mm_move_ss((l), (out)); \
+	(l) = _mm_shuffle_ps((l), (l), _MM_SHUFFLE((3==idx)?0:3,(2==idx)?0:2,(1==idx)?0:1,(0==idx)?0:0)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_import_s_ref(float *l, int idx, const float *out)
+{
+	l[idx] = out[idx];
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_import_s_sse(l, idx, out) \
+do { \
+	(out) = _mm_shuffle_ps((out), (out), _MM_SHUFFLE(2,1,0,3)); \
+	(l) = _mm_move_ss((l), (out)); \
+	(l) = _mm_shuffle_ps((l), (l), _MM_SHUFFLE((3==idx)?0:3,(2==idx)?0:2,(1==idx)?0:1,(0==idx)?0:0)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_load_s_ref(float *in, const float *addr)
+{
+	in[0] = addr[0];
+	in[1] = addr[1];
+	in[2] = addr[2];
+	in[3] = addr[3];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_load_s_sse(in, addr) \
+do { \
+	(in) = _mm_load_ps((const float *)(addr)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_shuffle_s_ref(float *c, float *r)
+{
+	c[0]=c[1]; c[1]=c[2]; c[2]=c[3];
+	r[0]=r[1]; r[1]=r[2]; r[2]=r[3];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_shuffle_s_sse(c, r) \
+do { \
+	(c) = _mm_shuffle_ps((c), (c), _MM_SHUFFLE(0,3,2,1)); \
+	(r) = _mm_shuffle_ps((r), (r), _MM_SHUFFLE(0,3,2,1)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_input_low_s_ref(const float *in, float *c, float *r)
+{
+	c[3] = in[0];
+	r[3] = in[1];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_input_low_s_sse(in, c, r) \
+do { \
+	__m128 t; \
+	(t) = (c); \
+	(t) = _mm_shuffle_ps((t), (in), _MM_SHUFFLE(1,0,3,2)); \
+	(c) = _mm_shuffle_ps((c), (t),  _MM_SHUFFLE(2,0,1,0)); \
+	(t) = _mm_shuffle_ps((t), (r),  _MM_SHUFFLE(3,2,3,2)); \
+	(r) = _mm_shuffle_ps((r), (t),  _MM_SHUFFLE(1,2,1,0)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_input_high_s_ref(const float *in, float *c, float *r)
+{
+	c[3] = in[2];
+	r[3] = in[3];
+}
+
+static
+void op4s_sdl2_shuffle_input_low_s_ref(const float *in, float *c, float *r)
+{
+	op4s_sdl2_shuffle_s_ref(c, r);
+	op4s_sdl2_input_low_s_ref(in, c, r);
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_shuffle_input_low_s_sse(in, c, r) \
+do { \
+	__m128 t; \
+	(t) = (in); \
+	(t) = _mm_shuffle_ps((t), (c), _MM_SHUFFLE(3,2,1,0)); \
+	(c) = _mm_shuffle_ps((c), (t), _MM_SHUFFLE(0,3,2,1)); \
+	(t) = _mm_shuffle_ps((t), (r), _MM_SHUFFLE(3,2,1,0)); \
+	(r) = _mm_shuffle_ps((r), (t), _MM_SHUFFLE(1,3,2,1)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_shuffle_input_high_s_ref(const float *in, float *c, float *r)
+{
+	op4s_sdl2_shuffle_s_ref(c, r);
+	op4s_sdl2_input_high_s_ref(in, c, r);
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_shuffle_input_high_s_sse(in, c, r) \
+do { \
+	(in) = _mm_shuffle_ps( (in), (c), _MM_SHUFFLE(3,2,3,2) ); \
+	(c)  = _mm_shuffle_ps( (c), (in), _MM_SHUFFLE(0,3,2,1) ); \
+	(in) = _mm_shuffle_ps( (in), (r), _MM_SHUFFLE(3,2,1,0) ); \
+	(r)  = _mm_shuffle_ps( (r), (in), _MM_SHUFFLE(1,3,2,1) ); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_op_s_ref(float *z, const float *c, const float *w, const float *l, const float *r)
+{
+	z[3] = c[3] + w[3] * ( l[3] + r[3] );
+	z[2] = c[2] + w[2] * ( l[2] + r[2] );
+	z[1] = c[1] + w[1] * ( l[1] + r[1] );
+	z[0] = c[0] + w[0] * ( l[0] + r[0] );
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_op_s_sse(z, c, w, l, r) \
+do { \
+	(z) = (l); \
+	(z) = _mm_add_ps((z), (r)); \
+	(z) = _mm_mul_ps((z), (w)); \
+	(z) = _mm_add_ps((z), (c)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_op_s_ref(float *z, const float *w, const float *l, const float *r)
+{
+	z[3] = z[3] + w[3] * ( l[3] + r[3] );
+	z[2] = z[2] + w[2] * ( l[2] + r[2] );
+	z[1] = z[1] + w[1] * ( l[1] + r[1] );
+	z[0] = z[0] + w[0] * ( l[0] + r[0] );
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_op_s_sse(z, w, l, r) \
+do { \
+	__m128 t; \
+	(t) = (l); \
+	(t) = _mm_add_ps((t), (r)); \
+	(t) = _mm_mul_ps((t), (w)); \
+	(z) = _mm_add_ps((z), (t)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_update_s_ref(float *c, float *l, float *r, const float *z)
+{
+	c[0] = l[0];
+	c[1] = l[1];
+	c[2] = l[2];
+	c[3] = l[3];
+
+	l[0] = r[0];
+	l[1] = r[1];
+	l[2] = r[2];
+	l[3] = r[3];
+
+	r[0] = z[0];
+	r[1] = z[1];
+	r[2] = z[2];
+	r[3] = z[3];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_update_s_sse(c, l, r, z) \
+do { \
+	(c) = (l); \
+	(l) = (r); \
+	(r) = (z); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_update_s_ref(float *z, float *l, float *r)
+{
+	float t[4];
+
+	t[0] = z[0];
+	t[1] = z[1];
+	t[2] = z[2];
+	t[3] = z[3];
+
+	z[0] = l[0];
+	z[1] = l[1];
+	z[2] = l[2];
+	z[3] = l[3];
+
+	l[0] = r[0];
+	l[1] = r[1];
+	l[2] = r[2];
+	l[3] = r[3];
+
+	r[0] = t[0];
+	r[1] = t[1];
+	r[2] = t[2];
+	r[3] = t[3];
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_update_s_sse(z, l, r) \
+do { \
+	__m128 t; \
+	(t) = (z); \
+	(z) = (l); \
+	(l) = (r); \
+	(r) = (t); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_output_low_s_ref(float *out, const float *l, const float *z)
+{
+	out[0] = l[0];
+	out[1] = z[0];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_output_low_s_sse(out, l, z) \
+do { \
+	(out) = (l); \
+	(out) = _mm_unpacklo_ps((out), (z)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_output_high_s_ref(float *out, const float *l, const float *z)
+{
+	out[2] = l[0];
+	out[3] = z[0];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_output_high_s_sse(out, l, z) \
+do { \
+	__m128 t; \
+	(t) = (l); \
+	(t) = _mm_unpacklo_ps((t), (z)); \
+	(out) = _mm_shuffle_ps((out), t, _MM_SHUFFLE(1,0,1,0)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_scale_s_ref(float *out, const float *v)
+{
+	out[0] *= v[0];
+	out[1] *= v[1];
+	out[2] *= v[2];
+	out[3] *= v[3];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_scale_s_sse(out, v) \
+do { \
+	(out) = _mm_mul_ps((out), (v)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_descale_s_ref(float *in, const float *v)
+{
+	in[0] *= v[0];
+	in[1] *= v[1];
+	in[2] *= v[2];
+	in[3] *= v[3];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_descale_s_sse(in, v) \
+do { \
+	(in) = _mm_mul_ps((in), (v)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_save_s_ref(float *out, float *addr)
+{
+	addr[0] = out[0];
+	addr[1] = out[1];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_save_s_sse(out, addr) \
+do { \
+	_mm_storel_pi((__m64 *)(addr), (out)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_save_shift_s_ref(float *out, float *addr)
+{
+	addr[0] = out[0];
+	addr[1] = out[1];
+	addr[2] = out[2];
+	addr[3] = out[3];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_save_shift_s_sse(out, addr) \
+do { \
+	_mm_store_ps((float *)(addr), (out)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_export_s_ref(const float *l, float *addr, int idx)
+{
+	addr[idx] = l[idx];
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_export_s_sse(l, addr, idx) \
+do { \
+	(addr)[(idx)] = (l)[(idx)]; \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_export_s_ref(const float *l, float *addr, int idx)
+{
+	addr[idx] = l[idx];
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_export_s_sse(l, addr, idx) \
+do { \
+	(addr)[(idx)] = (l)[(idx)]; \
+} while(0)
+#endif
+
+static
+void op4s_sdl_import_s_ref(float *l, const float *restrict addr, int idx)
+{
+	l[idx] = addr[idx];
+}
+
+static
+void op4s_sdl_shuffle_s_ref(float *c, float *r)
+{
+	c[0]=c[1]; c[1]=c[2]; c[2]=c[3];
+	r[0]=r[1]; r[1]=r[2]; r[2]=r[3];
+}
+
+static
+void op4s_sdl_load_s_ref(float *in, const float *restrict addr)
+{
+	in[0] = addr[0];
+	in[1] = addr[1];
+}
+
+static
+void op4s_sdl_input_s_ref(const float *in, float *c, float *r)
+{
+	c[3] = in[0];
+	r[3] = in[1];
+}
+
+static
+void op4s_sdl_op_s_ref(float *z, const float *c, const float *w, const float *l, const float *r)
+{
+	z[3] = c[3] + w[3] * ( l[3] + r[3] );
+	z[2] = c[2] + w[2] * ( l[2] + r[2] );
+	z[1] = c[1] + w[1] * ( l[1] + r[1] );
+	z[0] = c[0] + w[0] * ( l[0] + r[0] );
+}
+
+static
+void op4s_sdl_update_s_ref(float *c, float *l, float *r, const float *z)
+{
+	c[0] = l[0];
+	c[1] = l[1];
+	c[2] = l[2];
+	c[3] = l[3];
+
+	l[0] = r[0];
+	l[1] = r[1];
+	l[2] = r[2];
+	l[3] = r[3];
+
+	r[0] = z[0];
+	r[1] = z[1];
+	r[2] = z[2];
+	r[3] = z[3];
+}
+
+static
+void op4s_sdl_output_s_ref(float *out, const float *l, const float *z)
+{
+	out[0] = l[0];
+	out[1] = z[0];
+}
+
+static
+void op4s_sdl_scale_s_ref(float *out, const float *v)
+{
+	out[0] *= v[0];
+	out[1] *= v[1];
+}
+
+static
+void op4s_sdl_descale_s_ref(float *in, const float *v)
+{
+	in[0] *= v[0];
+	in[1] *= v[1];
+}
+
+static
+void op4s_sdl_save_s_ref(float *out, float *restrict addr)
+{
+	addr[0] = out[0];
+	addr[1] = out[1];
+}
+
+static
+void op4s_sdl_export_s_ref(const float *l, float *restrict addr, int idx)
+{
+	addr[idx] = l[idx];
+}
+
+static
+void op4s_sdl2_preload_prolog_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(w);
+	UNUSED(v);
+	UNUSED(l);
+	UNUSED(c);
+	UNUSED(r);
+	UNUSED(z);
+	UNUSED(in);
+
+	op4s_sdl2_import_preload_s_ref(out, (*addr));
+
+ 	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_preload_prolog_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_import_preload_s_sse((out), (*(addr))); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_preload_prolog_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(w);
+	UNUSED(v);
+	UNUSED(l);
+	UNUSED(r);
+	UNUSED(z);
+	UNUSED(in);
+
+	op4s_sdl2_import_preload_s_ref(out, (*addr));
+
+ 	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_preload_prolog_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_import_preload_s_sse((out), (*(addr))); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_fwd_prolog_full_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(out);
+
+	// load
+	op4s_sdl2_load_s_ref(in, (*addr));
+
+	// shuffle + input-low
+	op4s_sdl2_shuffle_input_low_s_ref(in, c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_fwd_prolog_full_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_load_s_sse((in), (*(addr))); \
+	op4s_sdl2_shuffle_input_low_s_sse((in), (c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_inv_prolog_full_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(out);
+
+	// load
+	op4s_sdl2_load_s_ref(in, (*addr));
+
+	// descale
+	op4s_sdl2_descale_s_ref(in, v);
+
+	// shuffle + input-low
+	op4s_sdl2_shuffle_input_low_s_ref(in, c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_inv_prolog_full_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_load_s_sse((in), (*(addr))); \
+	op4s_sdl2_descale_s_sse((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_sse((in), (c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_inv_prolog_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(out);
+
+	// load
+	op4s_sdl2_load_s_ref(in, (*addr));
+
+	// descale
+	op4s_sdl2_descale_s_ref(in, v);
+
+	// shuffle + input-low
+	op4s_sdl2_shuffle_input_low_s_ref(in, z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_inv_prolog_full_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_load_s_sse((in), (*(addr))); \
+	op4s_sdl2_descale_s_sse((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_sse((in), (z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_fwd_prolog_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(out);
+
+	// load
+	op4s_sdl2_load_s_ref(in, (*addr));
+
+	// (descale)
+
+	// shuffle + input-low
+	op4s_sdl2_shuffle_input_low_s_ref(in, z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_fwd_prolog_full_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_load_s_sse((in), (*(addr))); \
+	op4s_sdl2_shuffle_input_low_s_sse((in), (z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_fwd_prolog_light_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(out);
+	UNUSED(addr);
+
+	// shuffle + input-high
+	op4s_sdl2_shuffle_input_high_s_ref(in, c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_fwd_prolog_light_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_sse((in), (c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_inv_prolog_light_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(out);
+	UNUSED(addr);
+
+	// shuffle + input-high
+	op4s_sdl2_shuffle_input_high_s_ref(in, c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_inv_prolog_light_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_sse((in), (c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_inv_prolog_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(out);
+	UNUSED(addr);
+
+	// shuffle + input-high
+	op4s_sdl2_shuffle_input_high_s_ref(in, z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_inv_prolog_light_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_sse((in), (z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_fwd_prolog_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(out);
+	UNUSED(addr);
+
+	// shuffle + input-high
+	op4s_sdl2_shuffle_input_high_s_ref(in, z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_fwd_prolog_light_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_sse((in), (z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_fwd_core_light_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(addr);
+
+	// shuffle + input-high
+	op4s_sdl2_shuffle_input_high_s_ref(in, c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_fwd_core_light_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_sse((in), (c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_inv_core_light_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(addr);
+
+	// shuffle + input-high
+	op4s_sdl2_shuffle_input_high_s_ref(in, c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_inv_core_light_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_sse((in), (c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_inv_core_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(addr);
+
+	// shuffle + input-high
+	op4s_sdl2_shuffle_input_high_s_ref(in, z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// (update)
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_inv_core_light_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_sse((in), (z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_fwd_core_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(addr);
+
+	// shuffle + input-high
+	op4s_sdl2_shuffle_input_high_s_ref(in, z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// (update)
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_fwd_core_light_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_sse((in), (z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_inv_postcore_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(addr);
+
+	// shuffle + input-high
+	op4s_sdl2_shuffle_input_high_s_ref(in, z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_inv_postcore_light_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_sse((in), (z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_fwd_postcore_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(addr);
+
+	// shuffle + input-high
+	op4s_sdl2_shuffle_input_high_s_ref(in, z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_fwd_postcore_light_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_sse((in), (z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_fwd_core_full_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	// load
+	op4s_sdl2_load_s_ref(in, (*addr));
+
+	// shuffle + input-low
+	op4s_sdl2_shuffle_input_low_s_ref(in, c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// output-high
+	op4s_sdl2_output_high_s_ref(out, l, z);
+
+	// scale
+	op4s_sdl2_scale_s_ref(out, v);
+
+	// save-shift
+	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_fwd_core_full_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_load_s_sse((in), (*(addr))); \
+	op4s_sdl2_shuffle_input_low_s_sse((in), (c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
+	op4s_sdl2_scale_s_sse((out), (v)); \
+	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_inv_core_full_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	// load
+	op4s_sdl2_load_s_ref(in, (*addr));
+
+	// descale
+	op4s_sdl2_descale_s_ref(in, v);
+
+	// shuffle + input-low
+	op4s_sdl2_shuffle_input_low_s_ref(in, c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// output-high
+	op4s_sdl2_output_high_s_ref(out, l, z);
+
+	// (scale)
+
+	// save-shift
+	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_inv_core_full_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_load_s_sse((in), (*(addr))); \
+	op4s_sdl2_descale_s_sse((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_sse((in), (c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_inv_core_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	// load
+	op4s_sdl2_load_s_ref(in, (*addr));
+
+	// descale
+	op4s_sdl2_descale_s_ref(in, v);
+
+	// shuffle + input-low
+	op4s_sdl2_shuffle_input_low_s_ref(in, z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-high
+	op4s_sdl2_output_high_s_ref(out, l, z);
+
+	// (scale)
+
+	// save-shift
+	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+
+	// (update)
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_inv_core_full_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_load_s_sse((in), (*(addr))); \
+	op4s_sdl2_descale_s_sse((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_sse((in), (z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_fwd_core_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	// load
+	op4s_sdl2_load_s_ref(in, (*addr));
+
+	// (descale)
+
+	// shuffle + input-low
+	op4s_sdl2_shuffle_input_low_s_ref(in, z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-high
+	op4s_sdl2_output_high_s_ref(out, l, z);
+
+	// (scale)
+	op4s_sdl2_scale_s_ref(out, v);
+
+	// save-shift
+	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+
+	// (update)
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_fwd_core_full_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_load_s_sse((in), (*(addr))); \
+	op4s_sdl2_shuffle_input_low_s_sse((in), (z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
+	op4s_sdl2_scale_s_sse((out), (v)); \
+	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_inv_postcore_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	// load
+	op4s_sdl2_load_s_ref(in, (*addr));
+
+	// descale
+	op4s_sdl2_descale_s_ref(in, v);
+
+	// shuffle + input-low
+	op4s_sdl2_shuffle_input_low_s_ref(in, z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-high
+	op4s_sdl2_output_high_s_ref(out, l, z);
+
+	// (scale)
+
+	// save-shift
+	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_inv_postcore_full_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_load_s_sse((in), (*(addr))); \
+	op4s_sdl2_descale_s_sse((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_sse((in), (z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_fwd_postcore_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	// load
+	op4s_sdl2_load_s_ref(in, (*addr));
+
+	// (descale)
+
+	// shuffle + input-low
+	op4s_sdl2_shuffle_input_low_s_ref(in, z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-high
+	op4s_sdl2_output_high_s_ref(out, l, z);
+
+	// (scale)
+	op4s_sdl2_scale_s_ref(out, v);
+
+	// save-shift
+	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_fwd_postcore_full_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_load_s_sse((in), (*(addr))); \
+	op4s_sdl2_shuffle_input_low_s_sse((in), (z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
+	op4s_sdl2_scale_s_sse((out), (v)); \
+	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_fwd_epilog_full_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(in);
+
+	// shuffle
+	op4s_sdl2_shuffle_s_ref(c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// output-high
+	op4s_sdl2_output_high_s_ref(out, l, z);
+
+	// scale
+	op4s_sdl2_scale_s_ref(out, v);
+
+	// save-shift
+	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_fwd_epilog_full_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_s_sse((c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
+	op4s_sdl2_scale_s_sse((out), (v)); \
+	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_inv_epilog_full_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(in);
+
+	// shuffle
+	op4s_sdl2_shuffle_s_ref(c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// output-high
+	op4s_sdl2_output_high_s_ref(out, l, z);
+
+	// (scale)
+
+	// save-shift
+	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_inv_epilog_full_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_s_sse((c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_inv_epilog_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(in);
+
+	// shuffle
+	op4s_sdl2_shuffle_s_ref(z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-high
+	op4s_sdl2_output_high_s_ref(out, l, z);
+
+	// (scale)
+
+	// save-shift
+	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_inv_epilog_full_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_s_sse((z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_fwd_epilog_full_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(in);
+
+	// shuffle
+	op4s_sdl2_shuffle_s_ref(z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-high
+	op4s_sdl2_output_high_s_ref(out, l, z);
+
+	// (scale)
+	op4s_sdl2_scale_s_ref(out, v);
+
+	// save-shift
+	op4s_sdl2_save_shift_s_ref(out, (*addr)-12);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+
+	// pointers
+	(*addr) += 4;
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_fwd_epilog_full_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_s_sse((z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_sse((out), (l), (z)); \
+	op4s_sdl2_scale_s_sse((out), (v)); \
+	op4s_sdl2_save_shift_s_sse((out), (*(addr))-12); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_fwd_epilog_light_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(in);
+	UNUSED(addr);
+
+	// shuffle
+	op4s_sdl2_shuffle_s_ref(c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_fwd_epilog_light_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_s_sse((c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_inv_epilog_light_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(in);
+	UNUSED(addr);
+
+	// shuffle
+	op4s_sdl2_shuffle_s_ref(c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_inv_epilog_light_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_s_sse((c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_inv_epilog_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(in);
+	UNUSED(addr);
+
+	// shuffle
+	op4s_sdl2_shuffle_s_ref(z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_inv_epilog_light_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_s_sse((z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_fwd_epilog_light_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(in);
+	UNUSED(addr);
+
+	// shuffle
+	op4s_sdl2_shuffle_s_ref(z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_fwd_epilog_light_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_s_sse((z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_fwd_epilog_flush_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(in);
+
+	// shuffle
+	op4s_sdl2_shuffle_s_ref(c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// scale
+	op4s_sdl2_scale_s_ref(out, v);
+
+	// save
+	op4s_sdl2_save_s_ref(out, (*addr)-12);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_fwd_epilog_flush_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_s_sse((c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl2_scale_s_sse((out), (v)); \
+	op4s_sdl2_save_s_sse((out), (*(addr))-12); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl2_pass_inv_epilog_flush_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(in);
+
+	// shuffle
+	op4s_sdl2_shuffle_s_ref(c, r);
+
+	// operation
+	op4s_sdl2_op_s_ref(z, c, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// (scale)
+
+	// save
+	op4s_sdl2_save_s_ref(out, (*addr)-12);
+
+	// update
+	op4s_sdl2_update_s_ref(c, l, r, z);
+}
+
+#ifdef __SSE__
+#define op4s_sdl2_pass_inv_epilog_flush_s_sse(w, v, l, c, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_s_sse((c), (r)); \
+	op4s_sdl2_op_s_sse((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl2_save_s_sse((out), (*(addr))-12); \
+	op4s_sdl2_update_s_sse((c), (l), (r), (z)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_inv_epilog_flush_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(in);
+
+	// shuffle
+	op4s_sdl2_shuffle_s_ref(z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// (scale)
+
+	// save
+	op4s_sdl2_save_s_ref(out, (*addr)-12);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_inv_epilog_flush_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_s_sse((z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl2_save_s_sse((out), (*(addr))-12); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl6_pass_fwd_epilog_flush_s_ref(const float *w, const float *v, float *l, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(in);
+
+	// shuffle
+	op4s_sdl2_shuffle_s_ref(z, r);
+
+	// operation
+	op4s_sdl6_op_s_ref(z, w, l, r);
+
+	// output-low
+	op4s_sdl2_output_low_s_ref(out, l, z);
+
+	// (scale)
+	op4s_sdl2_scale_s_ref(out, v);
+
+	// save
+	op4s_sdl2_save_s_ref(out, (*addr)-12);
+
+	// update
+	op4s_sdl6_update_s_ref(z, l, r);
+}
+
+#ifdef __SSE__
+#define op4s_sdl6_pass_fwd_epilog_flush_s_sse(w, v, l, r, z, in, out, addr) \
+do { \
+	op4s_sdl2_shuffle_s_sse((z), (r)); \
+	op4s_sdl6_op_s_sse((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_sse((out), (l), (z)); \
+	op4s_sdl2_scale_s_sse((out), (v)); \
+	op4s_sdl2_save_s_sse((out), (*(addr))-12); \
+	op4s_sdl6_update_s_sse((z), (l), (r)); \
+} while(0)
+#endif
+
+static
+void op4s_sdl_pass_fwd_prolog_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(out);
+
+	// shuffle
+	op4s_sdl_shuffle_s_ref(c, r);
+
+	// load
+	op4s_sdl_load_s_ref(in, *addr+4);
+
+	// (descale)
+
+	// input
+	op4s_sdl_input_s_ref(in, c, r);
+
+	// operation
+	op4s_sdl_op_s_ref(z, c, w, l, r);
+
+	// (output)
+
+	// (scale)
+
+	// (save)
+
+	// update
+	op4s_sdl_update_s_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 2;
+}
+
+static
+void op4s_sdl_pass_inv_prolog_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(out);
+
+	// shuffle
+	op4s_sdl_shuffle_s_ref(c, r);
+
+	// load
+	op4s_sdl_load_s_ref(in, *addr+4);
+
+	// descale
+	op4s_sdl_descale_s_ref(in, v);
+
+	// input
+	op4s_sdl_input_s_ref(in, c, r);
+
+	// operation
+	op4s_sdl_op_s_ref(z, c, w, l, r);
+
+	// (output)
+
+	// (scale)
+
+	// (save)
+
+	// update
+	op4s_sdl_update_s_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 2;
+}
+
+static
+void op4s_sdl_pass_fwd_core_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	// shuffle
+	op4s_sdl_shuffle_s_ref(c, r);
+
+	// load
+	op4s_sdl_load_s_ref(in, *addr+4);
+
+	// (descale)
+
+	// input
+	op4s_sdl_input_s_ref(in, c, r);
+
+	// operation
+	op4s_sdl_op_s_ref(z, c, w, l, r);
+
+	// output
+	op4s_sdl_output_s_ref(out, l, z);
+
+	// scale
+	op4s_sdl_scale_s_ref(out, v);
+
+	// save
+	op4s_sdl_save_s_ref(out, *addr-6);
+
+	// update
+	op4s_sdl_update_s_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 2;
+}
+
+static
+void op4s_sdl_pass_inv_core_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	// shuffle
+	op4s_sdl_shuffle_s_ref(c, r);
+
+	// load
+	op4s_sdl_load_s_ref(in, *addr+4);
+
+	// descale
+	op4s_sdl_descale_s_ref(in, v);
+
+	// input
+	op4s_sdl_input_s_ref(in, c, r);
+
+	// operation
+	op4s_sdl_op_s_ref(z, c, w, l, r);
+
+	// output
+	op4s_sdl_output_s_ref(out, l, z);
+
+	// (scale)
+
+	// save
+	op4s_sdl_save_s_ref(out, *addr-6);
+
+	// update
+	op4s_sdl_update_s_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 2;
+}
+
+static
+void op4s_sdl_pass_fwd_epilog_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(in);
+
+	// shuffle
+	op4s_sdl_shuffle_s_ref(c, r);
+
+	// (load)
+
+	// (descale)
+
+	// (input)
+
+	// operation
+	op4s_sdl_op_s_ref(z, c, w, l, r);
+
+	// output
+	op4s_sdl_output_s_ref(out, l, z);
+
+	// scale
+	op4s_sdl_scale_s_ref(out, v);
+
+	// save
+	op4s_sdl_save_s_ref(out, *addr-6);
+
+	// update
+	op4s_sdl_update_s_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 2;
+}
+
+static
+void op4s_sdl_pass_inv_epilog_s_ref(const float *w, const float *v, float *l, float *c, float *r, float *z, float *in, float *out, float *restrict *addr)
+{
+	UNUSED(v);
+	UNUSED(in);
+
+	// shuffle
+	op4s_sdl_shuffle_s_ref(c, r);
+
+	// (load)
+
+	// (descale)
+
+	// (input)
+
+	// operation
+	op4s_sdl_op_s_ref(z, c, w, l, r);
+
+	// (output)
+	op4s_sdl_output_s_ref(out, l, z);
+
+	// (scale)
+
+	// save
+	op4s_sdl_save_s_ref(out, *addr-6);
+
+	// update
+	op4s_sdl_update_s_ref(c, l, r, z);
+
+	// pointers
+	(*addr) += 2;
+}
+
+
+#ifdef __SSE__
+/**
+ * @brief Shifted Double-Loop implementation of lifting scheme with 6
+ * iterations merger.
+ *
+ * i.e. 12 = (6)*(2) = (2*3)*(2) coefficients per one iteration.
+ */
+static
+void accel_lift_op4s_main_sdl6_sse_s(
+	float *restrict arr,
+	int steps,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	// 6+ coeffs implies 3+ steps
+	assert( steps >= 3 );
+
+	assert( is_aligned_16(arr) );
+
+	const __m128 w = { delta, gamma, beta, alpha };
+	const __m128 v = { 1/zeta, zeta, 1/zeta, zeta };
+	__m128 l;
+	__m128 r;
+	__m128 z;
+	__m128 in;
+	__m128 out;
+
+	const int S = steps-3;
+	const int U = S / 6;
+	const int M = S % 6;
+	const int T = M >> 1;
+
+	if( scaling < 0 )
+	{
+		// ****** inverse transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl6_preload_prolog_s_sse(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(3)
+		op4s_sdl6_import_s_sse(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_inv_prolog_full_s_sse(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(2)
+		op4s_sdl6_import_s_sse(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl6_pass_inv_prolog_light_s_sse(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(1)
+		op4s_sdl6_import_s_sse(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_inv_prolog_full_s_sse(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(0)
+		op4s_sdl6_import_s_sse(l, 0, out);
+
+		// *** core ***
+
+		// core: for u = 0 to U
+		for(int u = 0; u < U; u++)
+		{
+			// NOTE: l, r, z
+
+			// core: pass1-core-light
+			op4s_sdl6_pass_inv_core_light_s_sse(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass1-core-full
+			op4s_sdl6_pass_inv_core_full_s_sse(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass2-core-light
+			op4s_sdl6_pass_inv_core_light_s_sse(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+
+			// core: pass2-core-full
+			op4s_sdl6_pass_inv_core_full_s_sse(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass3-core-light
+			op4s_sdl6_pass_inv_core_light_s_sse(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass3-core-full
+			op4s_sdl6_pass_inv_core_full_s_sse(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+		}
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_inv_postcore_light_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// core: pass-core-full
+			op4s_sdl6_pass_inv_postcore_full_s_sse(w, v, l, r, z, in, out, &addr);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_inv_postcore_light_s_sse(w, v, l, r, z, in, out, &addr);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_inv_epilog_full_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_inv_epilog_light_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_inv_epilog_full_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_inv_epilog_light_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_inv_epilog_full_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl6_pass_inv_epilog_flush_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 0);
+		}
+	}
+	else if ( scaling > 0 )
+	{
+		// ****** forward transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl6_preload_prolog_s_sse(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(3)
+		op4s_sdl6_import_s_sse(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_fwd_prolog_full_s_sse(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(2)
+		op4s_sdl6_import_s_sse(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl6_pass_fwd_prolog_light_s_sse(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(1)
+		op4s_sdl6_import_s_sse(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_fwd_prolog_full_s_sse(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(0)
+		op4s_sdl6_import_s_sse(l, 0, out);
+
+		// *** core ***
+
+		// core: for u = 0 to U
+		for(int u = 0; u < U; u++)
+		{
+			// NOTE: l, r, z
+
+			// core: pass1-core-light
+			op4s_sdl6_pass_fwd_core_light_s_sse(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass1-core-full
+			op4s_sdl6_pass_fwd_core_full_s_sse(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass2-core-light
+			op4s_sdl6_pass_fwd_core_light_s_sse(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+
+			// core: pass2-core-full
+			op4s_sdl6_pass_fwd_core_full_s_sse(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass3-core-light
+			op4s_sdl6_pass_fwd_core_light_s_sse(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass3-core-full
+			op4s_sdl6_pass_fwd_core_full_s_sse(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+		}
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_fwd_postcore_light_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// core: pass-core-full
+			op4s_sdl6_pass_fwd_postcore_full_s_sse(w, v, l, r, z, in, out, &addr);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_fwd_postcore_light_s_sse(w, v, l, r, z, in, out, &addr);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_fwd_epilog_full_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_fwd_epilog_light_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_fwd_epilog_full_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_fwd_epilog_light_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_fwd_epilog_full_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl6_pass_fwd_epilog_flush_s_sse(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_sse(l, &arr[2*steps], 0);
+		}
+	}
+	else
+	{
+		// ****** transform w/o scaling ******
+
+		// not implemented yet
+		dwt_util_abort();
+	}
+}
+#endif /* __SSE__ */
+
+/**
+ * @brief Shifted Double-Loop implementation of lifting scheme with 6
+ * iterations merger.
+ *
+ * i.e. 12 = (6)*(2) = (2*3)*(2) coefficients per one iteration.
+ */
+static
+void accel_lift_op4s_main_sdl6_ref_s(
+	float *restrict arr,
+	int steps,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	// 6+ coeffs implies 3+ steps
+	assert( steps >= 3 );
+
+	assert( is_aligned_16(arr) );
+
+	const float w[4] = { delta, gamma, beta, alpha };
+	const float v[4] = { 1/zeta, zeta, 1/zeta, zeta };
+	float l[4];
+	float r[4];
+	float z[4];
+	float in[4];
+	float out[4];
+
+	const int S = steps-3;
+	const int U = S / 6;
+	const int M = S % 6;
+	const int T = M >> 1;
+
+	if( scaling < 0 )
+	{
+		// ****** inverse transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl6_preload_prolog_s_ref(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(3)
+		op4s_sdl6_import_s_ref(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_inv_prolog_full_s_ref(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(2)
+		op4s_sdl6_import_s_ref(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl6_pass_inv_prolog_light_s_ref(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(1)
+		op4s_sdl6_import_s_ref(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_inv_prolog_full_s_ref(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(0)
+		op4s_sdl6_import_s_ref(l, 0, out);
+
+		// *** core ***
+
+		// core: for u = 0 to U
+		for(int u = 0; u < U; u++)
+		{
+			// NOTE: l, r, z
+
+			// core: pass1-core-light
+			op4s_sdl6_pass_inv_core_light_s_ref(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass1-core-full
+			op4s_sdl6_pass_inv_core_full_s_ref(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass2-core-light
+			op4s_sdl6_pass_inv_core_light_s_ref(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+
+			// core: pass2-core-full
+			op4s_sdl6_pass_inv_core_full_s_ref(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass3-core-light
+			op4s_sdl6_pass_inv_core_light_s_ref(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass3-core-full
+			op4s_sdl6_pass_inv_core_full_s_ref(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+		}
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_inv_postcore_light_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// core: pass-core-full
+			op4s_sdl6_pass_inv_postcore_full_s_ref(w, v, l, r, z, in, out, &addr);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_inv_postcore_light_s_ref(w, v, l, r, z, in, out, &addr);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_inv_epilog_full_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_inv_epilog_light_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_inv_epilog_full_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_inv_epilog_light_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_inv_epilog_full_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl6_pass_inv_epilog_flush_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 0);
+		}
+	}
+	else if ( scaling > 0 )
+	{
+		// ****** forward transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl6_preload_prolog_s_ref(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(3)
+		op4s_sdl6_import_s_ref(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_fwd_prolog_full_s_ref(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(2)
+		op4s_sdl6_import_s_ref(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl6_pass_fwd_prolog_light_s_ref(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(1)
+		op4s_sdl6_import_s_ref(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_fwd_prolog_full_s_ref(w, v, l, r, z, in, out, &addr);
+
+		// prolog2: import(0)
+		op4s_sdl6_import_s_ref(l, 0, out);
+
+		// *** core ***
+
+		// core: for u = 0 to U
+		for(int u = 0; u < U; u++)
+		{
+			// NOTE: l, r, z
+
+			// core: pass1-core-light
+			op4s_sdl6_pass_fwd_core_light_s_ref(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass1-core-full
+			op4s_sdl6_pass_fwd_core_full_s_ref(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass2-core-light
+			op4s_sdl6_pass_fwd_core_light_s_ref(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+
+			// core: pass2-core-full
+			op4s_sdl6_pass_fwd_core_full_s_ref(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass3-core-light
+			op4s_sdl6_pass_fwd_core_light_s_ref(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass3-core-full
+			op4s_sdl6_pass_fwd_core_full_s_ref(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+		}
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_fwd_postcore_light_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// core: pass-core-full
+			op4s_sdl6_pass_fwd_postcore_full_s_ref(w, v, l, r, z, in, out, &addr);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_fwd_postcore_light_s_ref(w, v, l, r, z, in, out, &addr);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_fwd_epilog_full_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_fwd_epilog_light_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_fwd_epilog_full_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_fwd_epilog_light_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_fwd_epilog_full_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl6_pass_fwd_epilog_flush_s_ref(w, v, l, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_ref(l, &arr[2*steps], 0);
+		}
+	}
+	else
+	{
+		// ****** transform w/o scaling ******
+
+		// not implemented yet
+		dwt_util_abort();
+	}
+}
+
+/**
+ * @brief SDL with 2 iterations merged.
+ *
+ * i.e. loads and stores 4 = (2)*(2) coefficients in every iteration.
+ */
+static
+void accel_lift_op4s_main_sdl2_ref_s(
+	float *restrict arr,
+	int steps,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	// 6+ coeffs implies 3+ steps
+	assert( steps >= 3 );
+
+	assert( is_aligned_16(arr) );
+
+	const float w[4] = { delta, gamma, beta, alpha };
+	const float v[4] = { 1/zeta, zeta, 1/zeta, zeta };
+	float l[4];
+	float c[4];
+	float r[4];
+	float z[4];
+	float in[4];
+	float out[4];
+
+	const int S = steps-3;
+	const int T = S >> 1;
+
+	if( scaling < 0 )
+	{
+		// ****** inverse transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl2_preload_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(3)
+		op4s_sdl2_import_s_ref(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_inv_prolog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(2)
+		op4s_sdl2_import_s_ref(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl2_pass_inv_prolog_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(1)
+		op4s_sdl2_import_s_ref(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_inv_prolog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(0)
+		op4s_sdl2_import_s_ref(l, 0, out);
+
+		// *** core ***
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_inv_core_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// core: pass-core-full
+			op4s_sdl2_pass_inv_core_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_inv_core_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_inv_epilog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_inv_epilog_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_inv_epilog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_inv_epilog_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_inv_epilog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl2_pass_inv_epilog_flush_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 0);
+		}
+	}
+	else if ( scaling > 0 )
+	{
+		// ****** forward transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl2_preload_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(3)
+		op4s_sdl2_import_s_ref(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_fwd_prolog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(2)
+		op4s_sdl2_import_s_ref(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl2_pass_fwd_prolog_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(1)
+		op4s_sdl2_import_s_ref(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_fwd_prolog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(0)
+		op4s_sdl2_import_s_ref(l, 0, out);
+
+		// *** core ***
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_fwd_core_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// core: pass-core-full
+			op4s_sdl2_pass_fwd_core_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_fwd_core_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_fwd_epilog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_fwd_epilog_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_fwd_epilog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_fwd_epilog_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_fwd_epilog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl2_pass_fwd_epilog_flush_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_ref(l, &arr[2*steps], 0);
+		}
+	}
+	else
+	{
+		// ****** transform w/o scaling ******
+
+		// not implemented yet
+		dwt_util_abort();
+	}
+}
+
+#ifdef __SSE__
+static
+void accel_lift_op4s_main_sdl2_sse_s(
+	float *restrict arr,
+	int steps,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	// 6+ coeffs implies 3+ steps
+	assert( steps >= 3 );
+
+	assert( is_aligned_16(arr) );
+
+	// FIXME: global variables?
+	const __m128 w = { delta, gamma, beta, alpha };
+	const __m128 v = { 1/zeta, zeta, 1/zeta, zeta };
+	__m128 l;
+	__m128 c;
+	__m128 r;
+	__m128 z;
+	__m128 in;
+	__m128 out;
+
+	const int S = steps-3;
+	const int T = S >> 1;
+
+	if( scaling < 0 )
+	{
+		// ****** inverse transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl2_preload_prolog_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(3)
+		op4s_sdl2_import_s_sse(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_inv_prolog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(2)
+		op4s_sdl2_import_s_sse(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl2_pass_inv_prolog_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(1)
+		op4s_sdl2_import_s_sse(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_inv_prolog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(0)
+		op4s_sdl2_import_s_sse(l, 0, out);
+
+		// *** core ***
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_inv_core_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// core: pass-core-full
+			op4s_sdl2_pass_inv_core_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_inv_core_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_inv_epilog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_inv_epilog_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_inv_epilog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_inv_epilog_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_inv_epilog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl2_pass_inv_epilog_flush_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 0);
+		}
+	}
+	else if ( scaling > 0 )
+	{
+		// ****** forward transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl2_preload_prolog_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(3)
+		op4s_sdl2_import_s_sse(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_fwd_prolog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(2)
+		op4s_sdl2_import_s_sse(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl2_pass_fwd_prolog_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(1)
+		op4s_sdl2_import_s_sse(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_fwd_prolog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(0)
+		op4s_sdl2_import_s_sse(l, 0, out);
+
+		// *** core ***
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_fwd_core_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// core: pass-core-full
+			op4s_sdl2_pass_fwd_core_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_fwd_core_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_fwd_epilog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_fwd_epilog_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_fwd_epilog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_fwd_epilog_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_fwd_epilog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl2_pass_fwd_epilog_flush_s_sse(w, v, l, c, r, z, in, out, &addr);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_sse(l, &arr[2*steps], 0);
+		}
+	}
+	else
+	{
+		// ****** transform w/o scaling ******
+
+		// not implemented yet
+		dwt_util_abort();
+	}
+}
+#endif /* __SSE__ */
+
+#ifdef USE_AVX
+#define op4s_sdl2_import_preload_s_avx(out, addr, dist) \
+do { \
+	(out) = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(addr)), _mm_load_ps((addr)+(dist)), 1); \
+} while(0)
+
+#define op4s_sdl2_import_s_avx(l, idx, out) \
+do { \
+	(out) = _mm256_shuffle_ps((out), (out), _MM_SHUFFLE(2,1,0,3)); \
+	(l) = _mm256_blend_ps((l), (out), 0x11); \
+	(l) = _mm256_shuffle_ps((l), (l), _MM_SHUFFLE((3==idx)?0:3,(2==idx)?0:2,(1==idx)?0:1,(0==idx)?0:0)); \
+} while(0)
+
+#define op4s_sdl6_import_s_avx(l, idx, out) \
+do { \
+	(out) = _mm256_shuffle_ps((out), (out), _MM_SHUFFLE(2,1,0,3)); \
+	(l) = _mm256_blend_ps((l), (out), 0x11); \
+	(l) = _mm256_shuffle_ps((l), (l), _MM_SHUFFLE((3==idx)?0:3,(2==idx)?0:2,(1==idx)?0:1,(0==idx)?0:0)); \
+} while(0)
+
+#define op4s_sdl2_load_s_avx(in, addr, dist) \
+do { \
+	(in) = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps((const float *)(addr))), _mm_load_ps((const float *)(addr)+(dist)), 1); \
+} while(0)
+
+#define op4s_sdl2_shuffle_s_avx(c, r) \
+do { \
+	(c) = _mm256_shuffle_ps((c), (c), _MM_SHUFFLE(0,3,2,1)); \
+	(r) = _mm256_shuffle_ps((r), (r), _MM_SHUFFLE(0,3,2,1)); \
+} while(0)
+
+#define op4s_sdl2_input_low_s_avx(in, c, r) \
+do { \
+	__m256 t; \
+	(t) = (c); \
+	(t) = _mm256_shuffle_ps((t), (in), _MM_SHUFFLE(1,0,3,2)); \
+	(c) = _mm256_shuffle_ps((c), (t),  _MM_SHUFFLE(2,0,1,0)); \
+	(t) = _mm256_shuffle_ps((t), (r),  _MM_SHUFFLE(3,2,3,2)); \
+	(r) = _mm256_shuffle_ps((r), (t),  _MM_SHUFFLE(1,2,1,0)); \
+} while(0)
+
+#define op4s_sdl2_shuffle_input_low_s_avx(in, c, r) \
+do { \
+	__m256 t; \
+	(t) = (in); \
+	(t) = _mm256_shuffle_ps((t), (c), _MM_SHUFFLE(3,2,1,0)); \
+	(c) = _mm256_shuffle_ps((c), (t), _MM_SHUFFLE(0,3,2,1)); \
+	(t) = _mm256_shuffle_ps((t), (r), _MM_SHUFFLE(3,2,1,0)); \
+	(r) = _mm256_shuffle_ps((r), (t), _MM_SHUFFLE(1,3,2,1)); \
+} while(0)
+
+#define op4s_sdl2_shuffle_input_high_s_avx(in, c, r) \
+do { \
+	(in) = _mm256_shuffle_ps( (in), (c), _MM_SHUFFLE(3,2,3,2) ); \
+	(c)  = _mm256_shuffle_ps( (c), (in), _MM_SHUFFLE(0,3,2,1) ); \
+	(in) = _mm256_shuffle_ps( (in), (r), _MM_SHUFFLE(3,2,1,0) ); \
+	(r)  = _mm256_shuffle_ps( (r), (in), _MM_SHUFFLE(1,3,2,1) ); \
+} while(0)
+
+#define op4s_sdl2_op_s_avx(z, c, w, l, r) \
+do { \
+	(z) = (l); \
+	(z) = _mm256_add_ps((z), (r)); \
+	(z) = _mm256_mul_ps((z), (w)); \
+	(z) = _mm256_add_ps((z), (c)); \
+} while(0)
+
+#define op4s_sdl6_op_s_avx(z, w, l, r) \
+do { \
+	__m256 t; \
+	(t) = (l); \
+	(t) = _mm256_add_ps((t), (r)); \
+	(t) = _mm256_mul_ps((t), (w)); \
+	(z) = _mm256_add_ps((z), (t)); \
+} while(0)
+
+#define op4s_sdl2_update_s_avx(c, l, r, z) \
+do { \
+	(c) = (l); \
+	(l) = (r); \
+	(r) = (z); \
+} while(0)
+
+#define op4s_sdl6_update_s_avx(z, l, r) \
+do { \
+	__m256 t; \
+	(t) = (z); \
+	(z) = (l); \
+	(l) = (r); \
+	(r) = (t); \
+} while(0)
+
+#define op4s_sdl2_output_low_s_avx(out, l, z) \
+do { \
+	(out) = (l); \
+	(out) = _mm256_unpacklo_ps((out), (z)); \
+} while(0)
+
+#define op4s_sdl2_output_high_s_avx(out, l, z) \
+do { \
+	__m256 t; \
+	(t) = (l); \
+	(t) = _mm256_unpacklo_ps((t), (z)); \
+	(out) = _mm256_shuffle_ps((out), t, _MM_SHUFFLE(1,0,1,0)); \
+} while(0)
+
+#define op4s_sdl2_scale_s_avx(out, v) \
+do { \
+	(out) = _mm256_mul_ps((out), (v)); \
+} while(0)
+
+#define op4s_sdl2_descale_s_avx(in, v) \
+do { \
+	(in) = _mm256_mul_ps((in), (v)); \
+} while(0)
+
+#define op4s_sdl2_save_s_avx(out, addr, dist) \
+do { \
+	_mm_storel_pi((__m64 *)(addr), _mm256_castps256_ps128(out)); \
+	_mm_storel_pi((__m64 *)((addr)+(dist)), _mm256_extractf128_ps((out), 1)); \
+} while(0)
+
+#define op4s_sdl2_save_shift_s_avx(out, addr, dist) \
+do { \
+	_mm_store_ps((float *)(addr), _mm256_castps256_ps128(out)); \
+	_mm_store_ps((float *)(addr)+(dist), _mm256_extractf128_ps((out), 1)); \
+} while(0)
+
+#define op4s_sdl2_export_s_avx(l, addr, dist, idx) \
+do { \
+	(addr)[(idx)] = (l)[(idx)]; \
+	(addr)[(dist)+(idx)] = (l)[4+(idx)]; \
+} while(0)
+
+#define op4s_sdl6_export_s_avx(l, addr, dist, idx) \
+do { \
+	(addr)[(idx)] = (l)[(idx)]; \
+	(addr)[(dist)+(idx)] = (l)[4+(idx)]; \
+} while(0)
+
+#define op4s_sdl2_preload_prolog_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_import_preload_s_avx((out), (*(addr)), (dist)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_preload_prolog_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_import_preload_s_avx((out), (*(addr)), (dist)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_prolog_full_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx((in), (*(addr)), (dist)); \
+	op4s_sdl2_shuffle_input_low_s_avx((in), (c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_inv_prolog_full_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx((in), (*(addr)), (dist)); \
+	op4s_sdl2_descale_s_avx((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_avx((in), (c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_inv_prolog_full_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx((in), (*(addr)), (dist)); \
+	op4s_sdl2_descale_s_avx((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_avx((in), (z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_prolog_full_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx((in), (*(addr)), (dist)); \
+	op4s_sdl2_shuffle_input_low_s_avx((in), (z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_prolog_light_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx((in), (c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl2_pass_inv_prolog_light_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx((in), (c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl6_pass_inv_prolog_light_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx((in), (z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_prolog_light_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx((in), (z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_core_light_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx((in), (c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl2_pass_inv_core_light_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx((in), (c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl6_pass_inv_core_light_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx((in), (z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_core_light_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx((in), (z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+} while(0)
+
+#define op4s_sdl6_pass_inv_postcore_light_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx((in), (z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_postcore_light_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx((in), (z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_core_full_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx((in), (*(addr)), (dist)); \
+	op4s_sdl2_shuffle_input_low_s_avx((in), (c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx((out), (v)); \
+	op4s_sdl2_save_shift_s_avx((out), (*(addr))-12, (dist)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_inv_core_full_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx((in), (*(addr)), (dist)); \
+	op4s_sdl2_descale_s_avx((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_avx((in), (c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_avx((out), (*(addr))-12, (dist)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_inv_core_full_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx((in), (*(addr)), (dist)); \
+	op4s_sdl2_descale_s_avx((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_avx((in), (z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_avx((out), (*(addr))-12, (dist)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_core_full_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx((in), (*(addr)), (dist)); \
+	op4s_sdl2_shuffle_input_low_s_avx((in), (z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx((out), (v)); \
+	op4s_sdl2_save_shift_s_avx((out), (*(addr))-12, (dist)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_inv_postcore_full_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx((in), (*(addr)), (dist)); \
+	op4s_sdl2_descale_s_avx((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_avx((in), (z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_avx((out), (*(addr))-12, (dist)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_postcore_full_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx((in), (*(addr)), (dist)); \
+	op4s_sdl2_shuffle_input_low_s_avx((in), (z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx((out), (v)); \
+	op4s_sdl2_save_shift_s_avx((out), (*(addr))-12, (dist)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_epilog_full_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx((c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx((out), (v)); \
+	op4s_sdl2_save_shift_s_avx((out), (*(addr))-12, (dist)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_inv_epilog_full_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx((c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_avx((out), (*(addr))-12, (dist)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_inv_epilog_full_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx((z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_avx((out), (*(addr))-12, (dist)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_epilog_full_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx((z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx((out), (v)); \
+	op4s_sdl2_save_shift_s_avx((out), (*(addr))-12, (dist)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_epilog_light_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx((c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl2_pass_inv_epilog_light_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx((c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl6_pass_inv_epilog_light_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx((z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_epilog_light_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx((z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_epilog_flush_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx((c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx((out), (v)); \
+	op4s_sdl2_save_s_avx((out), (*(addr))-12, (dist)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl2_pass_inv_epilog_flush_s_avx(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx((c), (r)); \
+	op4s_sdl2_op_s_avx((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+	op4s_sdl2_save_s_avx((out), (*(addr))-12, (dist)); \
+	op4s_sdl2_update_s_avx((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl6_pass_inv_epilog_flush_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx((z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+	op4s_sdl2_save_s_avx((out), (*(addr))-12, (dist)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_epilog_flush_s_avx(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx((z), (r)); \
+	op4s_sdl6_op_s_avx((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx((out), (v)); \
+	op4s_sdl2_save_s_avx((out), (*(addr))-12, (dist)); \
+	op4s_sdl6_update_s_avx((z), (l), (r)); \
+} while(0)
+
+/**
+ * @brief Shifted Double-Loop implementation of lifting scheme with 2
+ * iterations merger, two signals in parallel.
+ *
+ * The lower and upper 128-bit lanes of AVX registers hold two independent
+ * signals. The second signal is stored @p dist floats after the first one.
+ * Both @p arr and @p arr+dist have to be aligned on 16 bytes.
+ */
+static
+TARGET_AVX
+void accel_lift_op4s_main_sdl2_avx_s(
+	float *restrict arr,
+	int dist,
+	int steps,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	// 6+ coeffs implies 3+ steps
+	assert( steps >= 3 );
+
+	assert( is_aligned_16(arr) && is_aligned_16(arr+dist) );
+
+	// FIXME: global variables?
+	const __m256 w = { delta, gamma, beta, alpha, delta, gamma, beta, alpha };
+	const __m256 v = { 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta };
+	__m256 l = _mm256_setzero_ps();
+	__m256 c = _mm256_setzero_ps();
+	__m256 r = _mm256_setzero_ps();
+	__m256 z = _mm256_setzero_ps();
+	__m256 in;
+	__m256 out;
+
+	const int S = steps-3;
+	const int T = S >> 1;
+
+	if( scaling < 0 )
+	{
+		// ****** inverse transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl2_preload_prolog_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(3)
+		op4s_sdl2_import_s_avx(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_inv_prolog_full_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(2)
+		op4s_sdl2_import_s_avx(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl2_pass_inv_prolog_light_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(1)
+		op4s_sdl2_import_s_avx(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_inv_prolog_full_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(0)
+		op4s_sdl2_import_s_avx(l, 0, out);
+
+		// *** core ***
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_inv_core_light_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// core: pass-core-full
+			op4s_sdl2_pass_inv_core_full_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_inv_core_light_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_inv_epilog_full_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_inv_epilog_light_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_inv_epilog_full_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_inv_epilog_light_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_inv_epilog_full_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl2_pass_inv_epilog_flush_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 0);
+		}
+	}
+	else if ( scaling > 0 )
+	{
+		// ****** forward transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl2_preload_prolog_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(3)
+		op4s_sdl2_import_s_avx(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_fwd_prolog_full_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(2)
+		op4s_sdl2_import_s_avx(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl2_pass_fwd_prolog_light_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(1)
+		op4s_sdl2_import_s_avx(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_fwd_prolog_full_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(0)
+		op4s_sdl2_import_s_avx(l, 0, out);
+
+		// *** core ***
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_fwd_core_light_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// core: pass-core-full
+			op4s_sdl2_pass_fwd_core_full_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_fwd_core_light_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_fwd_epilog_full_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_fwd_epilog_light_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_fwd_epilog_full_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_fwd_epilog_light_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_fwd_epilog_full_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl2_pass_fwd_epilog_flush_s_avx(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_avx(l, &arr[2*steps], dist, 0);
+		}
+	}
+	else
+	{
+		// ****** transform w/o scaling ******
+
+		// not implemented yet
+		dwt_util_abort();
+	}
+}
+
+/**
+ * @brief Shifted Double-Loop implementation of lifting scheme with 6
+ * iterations merger, two signals in parallel.
+ *
+ * The lower and upper 128-bit lanes of AVX registers hold two independent
+ * signals. The second signal is stored @p dist floats after the first one.
+ * Both @p arr and @p arr+dist have to be aligned on 16 bytes.
+ */
+static
+TARGET_AVX
+void accel_lift_op4s_main_sdl6_avx_s(
+	float *restrict arr,
+	int dist,
+	int steps,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	// 6+ coeffs implies 3+ steps
+	assert( steps >= 3 );
+
+	assert( is_aligned_16(arr) && is_aligned_16(arr+dist) );
+
+	const __m256 w = { delta, gamma, beta, alpha, delta, gamma, beta, alpha };
+	const __m256 v = { 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta };
+	__m256 l = _mm256_setzero_ps();
+	__m256 r = _mm256_setzero_ps();
+	__m256 z = _mm256_setzero_ps();
+	__m256 in;
+	__m256 out;
+
+	const int S = steps-3;
+	const int U = S / 6;
+	const int M = S % 6;
+	const int T = M >> 1;
+
+	if( scaling < 0 )
+	{
+		// ****** inverse transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl6_preload_prolog_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(3)
+		op4s_sdl6_import_s_avx(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_inv_prolog_full_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(2)
+		op4s_sdl6_import_s_avx(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl6_pass_inv_prolog_light_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(1)
+		op4s_sdl6_import_s_avx(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_inv_prolog_full_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(0)
+		op4s_sdl6_import_s_avx(l, 0, out);
+
+		// *** core ***
+
+		// core: for u = 0 to U
+		for(int u = 0; u < U; u++)
+		{
+			// NOTE: l, r, z
+
+			// core: pass1-core-light
+			op4s_sdl6_pass_inv_core_light_s_avx(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr, dist);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass1-core-full
+			op4s_sdl6_pass_inv_core_full_s_avx(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr, dist);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass2-core-light
+			op4s_sdl6_pass_inv_core_light_s_avx(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr, dist);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+
+			// core: pass2-core-full
+			op4s_sdl6_pass_inv_core_full_s_avx(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr, dist);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass3-core-light
+			op4s_sdl6_pass_inv_core_light_s_avx(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr, dist);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass3-core-full
+			op4s_sdl6_pass_inv_core_full_s_avx(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr, dist);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+		}
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_inv_postcore_light_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// core: pass-core-full
+			op4s_sdl6_pass_inv_postcore_full_s_avx(w, v, l, r, z, in, out, &addr, dist);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_inv_postcore_light_s_avx(w, v, l, r, z, in, out, &addr, dist);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_inv_epilog_full_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_inv_epilog_light_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_inv_epilog_full_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_inv_epilog_light_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_inv_epilog_full_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl6_pass_inv_epilog_flush_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 0);
+		}
+	}
+	else if ( scaling > 0 )
+	{
+		// ****** forward transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl6_preload_prolog_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(3)
+		op4s_sdl6_import_s_avx(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_fwd_prolog_full_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(2)
+		op4s_sdl6_import_s_avx(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl6_pass_fwd_prolog_light_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(1)
+		op4s_sdl6_import_s_avx(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_fwd_prolog_full_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(0)
+		op4s_sdl6_import_s_avx(l, 0, out);
+
+		// *** core ***
+
+		// core: for u = 0 to U
+		for(int u = 0; u < U; u++)
+		{
+			// NOTE: l, r, z
+
+			// core: pass1-core-light
+			op4s_sdl6_pass_fwd_core_light_s_avx(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr, dist);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass1-core-full
+			op4s_sdl6_pass_fwd_core_full_s_avx(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr, dist);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass2-core-light
+			op4s_sdl6_pass_fwd_core_light_s_avx(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr, dist);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+
+			// core: pass2-core-full
+			op4s_sdl6_pass_fwd_core_full_s_avx(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr, dist);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass3-core-light
+			op4s_sdl6_pass_fwd_core_light_s_avx(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr, dist);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass3-core-full
+			op4s_sdl6_pass_fwd_core_full_s_avx(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr, dist);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+		}
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_fwd_postcore_light_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// core: pass-core-full
+			op4s_sdl6_pass_fwd_postcore_full_s_avx(w, v, l, r, z, in, out, &addr, dist);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_fwd_postcore_light_s_avx(w, v, l, r, z, in, out, &addr, dist);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_fwd_epilog_full_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_fwd_epilog_light_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_fwd_epilog_full_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_fwd_epilog_light_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_fwd_epilog_full_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl6_pass_fwd_epilog_flush_s_avx(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_avx(l, &arr[2*steps], dist, 0);
+		}
+	}
+	else
+	{
+		// ****** transform w/o scaling ******
+
+		// not implemented yet
+		dwt_util_abort();
+	}
+}
+#endif /* USE_AVX */
+
+#ifdef USE_AVX512F
+#define op4s_sdl2_import_preload_s_avx512(out, addr, dist) \
+do { \
+	(out) = _mm512_castps128_ps512(_mm_load_ps(addr)); \
+	(out) = _mm512_insertf32x4((out), _mm_load_ps((addr)+1*(dist)), 1); \
+	(out) = _mm512_insertf32x4((out), _mm_load_ps((addr)+2*(dist)), 2); \
+	(out) = _mm512_insertf32x4((out), _mm_load_ps((addr)+3*(dist)), 3); \
+} while(0)
+
+#define op4s_sdl2_import_s_avx512(l, idx, out) \
+do { \
+	(out) = _mm512_shuffle_ps((out), (out), _MM_SHUFFLE(2,1,0,3)); \
+	(l) = _mm512_mask_blend_ps(0x1111, (l), (out)); \
+	(l) = _mm512_shuffle_ps((l), (l), _MM_SHUFFLE((3==idx)?0:3,(2==idx)?0:2,(1==idx)?0:1,(0==idx)?0:0)); \
+} while(0)
+
+#define op4s_sdl6_import_s_avx512(l, idx, out) \
+do { \
+	(out) = _mm512_shuffle_ps((out), (out), _MM_SHUFFLE(2,1,0,3)); \
+	(l) = _mm512_mask_blend_ps(0x1111, (l), (out)); \
+	(l) = _mm512_shuffle_ps((l), (l), _MM_SHUFFLE((3==idx)?0:3,(2==idx)?0:2,(1==idx)?0:1,(0==idx)?0:0)); \
+} while(0)
+
+#define op4s_sdl2_load_s_avx512(in, addr, dist) \
+do { \
+	(in) = _mm512_castps128_ps512(_mm_load_ps((const float *)(addr))); \
+	(in) = _mm512_insertf32x4((in), _mm_load_ps((const float *)(addr)+1*(dist)), 1); \
+	(in) = _mm512_insertf32x4((in), _mm_load_ps((const float *)(addr)+2*(dist)), 2); \
+	(in) = _mm512_insertf32x4((in), _mm_load_ps((const float *)(addr)+3*(dist)), 3); \
+} while(0)
+
+#define op4s_sdl2_shuffle_s_avx512(c, r) \
+do { \
+	(c) = _mm512_shuffle_ps((c), (c), _MM_SHUFFLE(0,3,2,1)); \
+	(r) = _mm512_shuffle_ps((r), (r), _MM_SHUFFLE(0,3,2,1)); \
+} while(0)
+
+#define op4s_sdl2_input_low_s_avx512(in, c, r) \
+do { \
+	__m512 t; \
+	(t) = (c); \
+	(t) = _mm512_shuffle_ps((t), (in), _MM_SHUFFLE(1,0,3,2)); \
+	(c) = _mm512_shuffle_ps((c), (t),  _MM_SHUFFLE(2,0,1,0)); \
+	(t) = _mm512_shuffle_ps((t), (r),  _MM_SHUFFLE(3,2,3,2)); \
+	(r) = _mm512_shuffle_ps((r), (t),  _MM_SHUFFLE(1,2,1,0)); \
+} while(0)
+
+#define op4s_sdl2_shuffle_input_low_s_avx512(in, c, r) \
+do { \
+	__m512 t; \
+	(t) = (in); \
+	(t) = _mm512_shuffle_ps((t), (c), _MM_SHUFFLE(3,2,1,0)); \
+	(c) = _mm512_shuffle_ps((c), (t), _MM_SHUFFLE(0,3,2,1)); \
+	(t) = _mm512_shuffle_ps((t), (r), _MM_SHUFFLE(3,2,1,0)); \
+	(r) = _mm512_shuffle_ps((r), (t), _MM_SHUFFLE(1,3,2,1)); \
+} while(0)
+
+#define op4s_sdl2_shuffle_input_high_s_avx512(in, c, r) \
+do { \
+	(in) = _mm512_shuffle_ps( (in), (c), _MM_SHUFFLE(3,2,3,2) ); \
+	(c)  = _mm512_shuffle_ps( (c), (in), _MM_SHUFFLE(0,3,2,1) ); \
+	(in) = _mm512_shuffle_ps( (in), (r), _MM_SHUFFLE(3,2,1,0) ); \
+	(r)  = _mm512_shuffle_ps( (r), (in), _MM_SHUFFLE(1,3,2,1) ); \
+} while(0)
+
+#define op4s_sdl2_op_s_avx512(z, c, w, l, r) \
+do { \
+	(z) = (l); \
+	(z) = _mm512_add_ps((z), (r)); \
+	(z) = _mm512_mul_ps((z), (w)); \
+	(z) = _mm512_add_ps((z), (c)); \
+} while(0)
+
+#define op4s_sdl6_op_s_avx512(z, w, l, r) \
+do { \
+	__m512 t; \
+	(t) = (l); \
+	(t) = _mm512_add_ps((t), (r)); \
+	(t) = _mm512_mul_ps((t), (w)); \
+	(z) = _mm512_add_ps((z), (t)); \
+} while(0)
+
+#define op4s_sdl2_update_s_avx512(c, l, r, z) \
+do { \
+	(c) = (l); \
+	(l) = (r); \
+	(r) = (z); \
+} while(0)
+
+#define op4s_sdl6_update_s_avx512(z, l, r) \
+do { \
+	__m512 t; \
+	(t) = (z); \
+	(z) = (l); \
+	(l) = (r); \
+	(r) = (t); \
+} while(0)
+
+#define op4s_sdl2_output_low_s_avx512(out, l, z) \
+do { \
+	(out) = (l); \
+	(out) = _mm512_unpacklo_ps((out), (z)); \
+} while(0)
+
+#define op4s_sdl2_output_high_s_avx512(out, l, z) \
+do { \
+	__m512 t; \
+	(t) = (l); \
+	(t) = _mm512_unpacklo_ps((t), (z)); \
+	(out) = _mm512_shuffle_ps((out), t, _MM_SHUFFLE(1,0,1,0)); \
+} while(0)
+
+#define op4s_sdl2_scale_s_avx512(out, v) \
+do { \
+	(out) = _mm512_mul_ps((out), (v)); \
+} while(0)
+
+#define op4s_sdl2_descale_s_avx512(in, v) \
+do { \
+	(in) = _mm512_mul_ps((in), (v)); \
+} while(0)
+
+#define op4s_sdl2_save_s_avx512(out, addr, dist) \
+do { \
+	_mm_storel_pi((__m64 *)(addr), _mm512_castps512_ps128(out)); \
+	_mm_storel_pi((__m64 *)((addr)+1*(dist)), _mm512_extractf32x4_ps((out), 1)); \
+	_mm_storel_pi((__m64 *)((addr)+2*(dist)), _mm512_extractf32x4_ps((out), 2)); \
+	_mm_storel_pi((__m64 *)((addr)+3*(dist)), _mm512_extractf32x4_ps((out), 3)); \
+} while(0)
+
+#define op4s_sdl2_save_shift_s_avx512(out, addr, dist) \
+do { \
+	_mm_store_ps((float *)(addr), _mm512_castps512_ps128(out)); \
+	_mm_store_ps((float *)(addr)+1*(dist), _mm512_extractf32x4_ps((out), 1)); \
+	_mm_store_ps((float *)(addr)+2*(dist), _mm512_extractf32x4_ps((out), 2)); \
+	_mm_store_ps((float *)(addr)+3*(dist), _mm512_extractf32x4_ps((out), 3)); \
+} while(0)
+
+#define op4s_sdl2_export_s_avx512(l, addr, dist, idx) \
+do { \
+	(addr)[(idx)] = (l)[(idx)]; \
+	(addr)[1*(dist)+(idx)] = (l)[4+(idx)]; \
+	(addr)[2*(dist)+(idx)] = (l)[8+(idx)]; \
+	(addr)[3*(dist)+(idx)] = (l)[12+(idx)]; \
+} while(0)
+
+#define op4s_sdl6_export_s_avx512(l, addr, dist, idx) \
+do { \
+	(addr)[(idx)] = (l)[(idx)]; \
+	(addr)[1*(dist)+(idx)] = (l)[4+(idx)]; \
+	(addr)[2*(dist)+(idx)] = (l)[8+(idx)]; \
+	(addr)[3*(dist)+(idx)] = (l)[12+(idx)]; \
+} while(0)
+
+#define op4s_sdl2_preload_prolog_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_import_preload_s_avx512((out), (*(addr)), (dist)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_preload_prolog_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_import_preload_s_avx512((out), (*(addr)), (dist)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_prolog_full_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx512((in), (*(addr)), (dist)); \
+	op4s_sdl2_shuffle_input_low_s_avx512((in), (c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_inv_prolog_full_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx512((in), (*(addr)), (dist)); \
+	op4s_sdl2_descale_s_avx512((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_avx512((in), (c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_inv_prolog_full_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx512((in), (*(addr)), (dist)); \
+	op4s_sdl2_descale_s_avx512((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_avx512((in), (z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_prolog_full_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx512((in), (*(addr)), (dist)); \
+	op4s_sdl2_shuffle_input_low_s_avx512((in), (z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_prolog_light_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx512((in), (c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl2_pass_inv_prolog_light_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx512((in), (c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl6_pass_inv_prolog_light_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx512((in), (z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_prolog_light_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx512((in), (z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_core_light_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx512((in), (c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl2_pass_inv_core_light_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx512((in), (c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl6_pass_inv_core_light_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx512((in), (z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_core_light_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx512((in), (z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+} while(0)
+
+#define op4s_sdl6_pass_inv_postcore_light_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx512((in), (z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_postcore_light_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_input_high_s_avx512((in), (z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_core_full_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx512((in), (*(addr)), (dist)); \
+	op4s_sdl2_shuffle_input_low_s_avx512((in), (c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx512((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx512((out), (v)); \
+	op4s_sdl2_save_shift_s_avx512((out), (*(addr))-12, (dist)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_inv_core_full_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx512((in), (*(addr)), (dist)); \
+	op4s_sdl2_descale_s_avx512((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_avx512((in), (c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx512((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_avx512((out), (*(addr))-12, (dist)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_inv_core_full_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx512((in), (*(addr)), (dist)); \
+	op4s_sdl2_descale_s_avx512((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_avx512((in), (z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx512((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_avx512((out), (*(addr))-12, (dist)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_core_full_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx512((in), (*(addr)), (dist)); \
+	op4s_sdl2_shuffle_input_low_s_avx512((in), (z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx512((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx512((out), (v)); \
+	op4s_sdl2_save_shift_s_avx512((out), (*(addr))-12, (dist)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_inv_postcore_full_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx512((in), (*(addr)), (dist)); \
+	op4s_sdl2_descale_s_avx512((in), (v)); \
+	op4s_sdl2_shuffle_input_low_s_avx512((in), (z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx512((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_avx512((out), (*(addr))-12, (dist)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_postcore_full_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_load_s_avx512((in), (*(addr)), (dist)); \
+	op4s_sdl2_shuffle_input_low_s_avx512((in), (z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx512((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx512((out), (v)); \
+	op4s_sdl2_save_shift_s_avx512((out), (*(addr))-12, (dist)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_epilog_full_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx512((c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx512((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx512((out), (v)); \
+	op4s_sdl2_save_shift_s_avx512((out), (*(addr))-12, (dist)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_inv_epilog_full_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx512((c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx512((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_avx512((out), (*(addr))-12, (dist)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_inv_epilog_full_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx512((z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx512((out), (l), (z)); \
+	op4s_sdl2_save_shift_s_avx512((out), (*(addr))-12, (dist)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_epilog_full_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx512((z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_high_s_avx512((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx512((out), (v)); \
+	op4s_sdl2_save_shift_s_avx512((out), (*(addr))-12, (dist)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+	(*(addr)) += 4; \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_epilog_light_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx512((c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl2_pass_inv_epilog_light_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx512((c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl6_pass_inv_epilog_light_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx512((z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_epilog_light_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx512((z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl2_pass_fwd_epilog_flush_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx512((c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx512((out), (v)); \
+	op4s_sdl2_save_s_avx512((out), (*(addr))-12, (dist)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl2_pass_inv_epilog_flush_s_avx512(w, v, l, c, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx512((c), (r)); \
+	op4s_sdl2_op_s_avx512((z), (c), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+	op4s_sdl2_save_s_avx512((out), (*(addr))-12, (dist)); \
+	op4s_sdl2_update_s_avx512((c), (l), (r), (z)); \
+} while(0)
+
+#define op4s_sdl6_pass_inv_epilog_flush_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx512((z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+	op4s_sdl2_save_s_avx512((out), (*(addr))-12, (dist)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+} while(0)
+
+#define op4s_sdl6_pass_fwd_epilog_flush_s_avx512(w, v, l, r, z, in, out, addr, dist) \
+do { \
+	op4s_sdl2_shuffle_s_avx512((z), (r)); \
+	op4s_sdl6_op_s_avx512((z), (w), (l), (r)); \
+	op4s_sdl2_output_low_s_avx512((out), (l), (z)); \
+	op4s_sdl2_scale_s_avx512((out), (v)); \
+	op4s_sdl2_save_s_avx512((out), (*(addr))-12, (dist)); \
+	op4s_sdl6_update_s_avx512((z), (l), (r)); \
+} while(0)
+
+/**
+ * @brief Shifted Double-Loop implementation of lifting scheme with 2
+ * iterations merger, four signals in parallel.
+ *
+ * Each of the four 128-bit lanes of AVX-512 registers holds one independent
+ * signal. The k-th signal is stored @p k * @p dist floats after the first one.
+ * All of them have to be aligned on 16 bytes.
+ */
+static
+TARGET_AVX512F
+void accel_lift_op4s_main_sdl2_avx512_s(
+	float *restrict arr,
+	int dist,
+	int steps,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	// 6+ coeffs implies 3+ steps
+	assert( steps >= 3 );
+
+	assert( is_aligned_16(arr) && is_aligned_16(arr+dist) && is_aligned_16(arr+2*dist) && is_aligned_16(arr+3*dist) );
+
+	// FIXME: global variables?
+	const __m512 w = { delta, gamma, beta, alpha, delta, gamma, beta, alpha, delta, gamma, beta, alpha, delta, gamma, beta, alpha };
+	const __m512 v = { 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta };
+	__m512 l = _mm512_setzero_ps();
+	__m512 c = _mm512_setzero_ps();
+	__m512 r = _mm512_setzero_ps();
+	__m512 z = _mm512_setzero_ps();
+	__m512 in;
+	__m512 out;
+
+	const int S = steps-3;
+	const int T = S >> 1;
+
+	if( scaling < 0 )
+	{
+		// ****** inverse transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl2_preload_prolog_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(3)
+		op4s_sdl2_import_s_avx512(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_inv_prolog_full_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(2)
+		op4s_sdl2_import_s_avx512(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl2_pass_inv_prolog_light_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(1)
+		op4s_sdl2_import_s_avx512(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_inv_prolog_full_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(0)
+		op4s_sdl2_import_s_avx512(l, 0, out);
+
+		// *** core ***
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_inv_core_light_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// core: pass-core-full
+			op4s_sdl2_pass_inv_core_full_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_inv_core_light_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_inv_epilog_full_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_inv_epilog_light_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_inv_epilog_full_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_inv_epilog_light_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_inv_epilog_full_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl2_pass_inv_epilog_flush_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 0);
+		}
+	}
+	else if ( scaling > 0 )
+	{
+		// ****** forward transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl2_preload_prolog_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(3)
+		op4s_sdl2_import_s_avx512(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_fwd_prolog_full_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(2)
+		op4s_sdl2_import_s_avx512(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl2_pass_fwd_prolog_light_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(1)
+		op4s_sdl2_import_s_avx512(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl2_pass_fwd_prolog_full_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+		// prolog2: import(0)
+		op4s_sdl2_import_s_avx512(l, 0, out);
+
+		// *** core ***
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_fwd_core_light_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// core: pass-core-full
+			op4s_sdl2_pass_fwd_core_full_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl2_pass_fwd_core_light_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_fwd_epilog_full_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_fwd_epilog_light_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_fwd_epilog_full_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl2_pass_fwd_epilog_light_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl2_pass_fwd_epilog_full_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl2_pass_fwd_epilog_flush_s_avx512(w, v, l, c, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl2_export_s_avx512(l, &arr[2*steps], dist, 0);
+		}
+	}
+	else
+	{
+		// ****** transform w/o scaling ******
+
+		// not implemented yet
+		dwt_util_abort();
+	}
+}
+
+/**
+ * @brief Shifted Double-Loop implementation of lifting scheme with 6
+ * iterations merger, four signals in parallel.
+ *
+ * Each of the four 128-bit lanes of AVX-512 registers holds one independent
+ * signal. The k-th signal is stored @p k * @p dist floats after the first one.
+ * All of them have to be aligned on 16 bytes.
+ */
+static
+TARGET_AVX512F
+void accel_lift_op4s_main_sdl6_avx512_s(
+	float *restrict arr,
+	int dist,
+	int steps,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	// 6+ coeffs implies 3+ steps
+	assert( steps >= 3 );
+
+	assert( is_aligned_16(arr) && is_aligned_16(arr+dist) && is_aligned_16(arr+2*dist) && is_aligned_16(arr+3*dist) );
+
+	const __m512 w = { delta, gamma, beta, alpha, delta, gamma, beta, alpha, delta, gamma, beta, alpha, delta, gamma, beta, alpha };
+	const __m512 v = { 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta, 1/zeta, zeta };
+	__m512 l = _mm512_setzero_ps();
+	__m512 r = _mm512_setzero_ps();
+	__m512 z = _mm512_setzero_ps();
+	__m512 in;
+	__m512 out;
+
+	const int S = steps-3;
+	const int U = S / 6;
+	const int M = S % 6;
+	const int T = M >> 1;
+
+	if( scaling < 0 )
+	{
+		// ****** inverse transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl6_preload_prolog_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(3)
+		op4s_sdl6_import_s_avx512(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_inv_prolog_full_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(2)
+		op4s_sdl6_import_s_avx512(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl6_pass_inv_prolog_light_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(1)
+		op4s_sdl6_import_s_avx512(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_inv_prolog_full_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(0)
+		op4s_sdl6_import_s_avx512(l, 0, out);
+
+		// *** core ***
+
+		// core: for u = 0 to U
+		for(int u = 0; u < U; u++)
+		{
+			// NOTE: l, r, z
+
+			// core: pass1-core-light
+			op4s_sdl6_pass_inv_core_light_s_avx512(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr, dist);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass1-core-full
+			op4s_sdl6_pass_inv_core_full_s_avx512(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr, dist);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass2-core-light
+			op4s_sdl6_pass_inv_core_light_s_avx512(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr, dist);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+
+			// core: pass2-core-full
+			op4s_sdl6_pass_inv_core_full_s_avx512(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr, dist);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass3-core-light
+			op4s_sdl6_pass_inv_core_light_s_avx512(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr, dist);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass3-core-full
+			op4s_sdl6_pass_inv_core_full_s_avx512(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr, dist);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+		}
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_inv_postcore_light_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// core: pass-core-full
+			op4s_sdl6_pass_inv_postcore_full_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_inv_postcore_light_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_inv_epilog_full_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_inv_epilog_light_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_inv_epilog_full_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_inv_epilog_light_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_inv_epilog_full_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl6_pass_inv_epilog_flush_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 0);
+		}
+	}
+	else if ( scaling > 0 )
+	{
+		// ****** forward transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import-preload
+		op4s_sdl6_preload_prolog_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(3)
+		op4s_sdl6_import_s_avx512(l, 3, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_fwd_prolog_full_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(2)
+		op4s_sdl6_import_s_avx512(l, 2, out);
+
+		// prolog2: pass-prolog-light
+		op4s_sdl6_pass_fwd_prolog_light_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(1)
+		op4s_sdl6_import_s_avx512(l, 1, out);
+
+		// prolog2: pass-prolog-full
+		op4s_sdl6_pass_fwd_prolog_full_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+		// prolog2: import(0)
+		op4s_sdl6_import_s_avx512(l, 0, out);
+
+		// *** core ***
+
+		// core: for u = 0 to U
+		for(int u = 0; u < U; u++)
+		{
+			// NOTE: l, r, z
+
+			// core: pass1-core-light
+			op4s_sdl6_pass_fwd_core_light_s_avx512(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr, dist);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass1-core-full
+			op4s_sdl6_pass_fwd_core_full_s_avx512(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr, dist);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass2-core-light
+			op4s_sdl6_pass_fwd_core_light_s_avx512(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr, dist);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+
+			// core: pass2-core-full
+			op4s_sdl6_pass_fwd_core_full_s_avx512(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr, dist);
+
+			// NOTE: z => l, l => r, r => z
+
+			// core: pass3-core-light
+			op4s_sdl6_pass_fwd_core_light_s_avx512(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr, dist);
+
+			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+
+			// core: pass3-core-full
+			op4s_sdl6_pass_fwd_core_full_s_avx512(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr, dist);
+
+			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+		}
+
+		// core: for t = 0 to T do
+		for(int t = 0; t < T; t++)
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_fwd_postcore_light_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// core: pass-core-full
+			op4s_sdl6_pass_fwd_postcore_full_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+		}
+
+		// core: if odd then
+		if( is_odd(S) )
+		{
+			// core: pass-core-light
+			op4s_sdl6_pass_fwd_postcore_light_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+		}
+
+		// *** epilog2 ***
+
+		if( is_odd(S) )
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_fwd_epilog_full_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_fwd_epilog_light_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_fwd_epilog_full_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 0);
+		}
+		else
+		{
+			// epilog2: export(3)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 3);
+
+			// epilog2: pass-epilog-light
+			op4s_sdl6_pass_fwd_epilog_light_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(2)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 2);
+
+			// epilog2: pass-epilog-full
+			op4s_sdl6_pass_fwd_epilog_full_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(1)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 1);
+
+			// epilog2: pass-epilog-flush
+			op4s_sdl6_pass_fwd_epilog_flush_s_avx512(w, v, l, r, z, in, out, &addr, dist);
+
+			// epilog2: export(0)
+			op4s_sdl6_export_s_avx512(l, &arr[2*steps], dist, 0);
+		}
+	}
+	else
+	{
+		// ****** transform w/o scaling ******
+
+		// not implemented yet
+		dwt_util_abort();
+	}
+}
+#endif /* USE_AVX512F */
+
+/**
+ * @brief Shifted double-loop algorithm.
+ *
+ * This function processes 2 coefficients (even + odd) per one iteration.
+ */
+static
+void accel_lift_op4s_main_sdl_ref_s(
+	float *restrict arr,
+	int steps,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	// 6+ coeffs implies 3+ steps
+	assert( steps >= 3 );
+
+	assert( is_aligned_16(arr) );
+
+	const float w[4] = { delta, gamma, beta, alpha };
+	const float v[4] = { 1/zeta, zeta, 1/zeta, zeta };
+	float l[4];
+	float c[4];
+	float r[4];
+	float z[4];
+	float in[4];
+	float out[4];
+
+	const int S = steps-3;
+
+	if( scaling < 0 )
+	{
+		// ****** inverse transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		// this pointer is needed because of use of arr[] in import and export functions
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import(3)
+		op4s_sdl_import_s_ref(l, arr, 3);
+
+		// prolog2: pass-prolog
+		op4s_sdl_pass_inv_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+	
+		// prolog2: import(2)
+		op4s_sdl_import_s_ref(l, arr, 2);
+
+		// prolog2: pass-prolog
+		op4s_sdl_pass_inv_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(1)
+		op4s_sdl_import_s_ref(l, arr, 1);
+
+		// prolog2: pass-prolog
+		op4s_sdl_pass_inv_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(0)
+		op4s_sdl_import_s_ref(l, arr, 0);
+
+		// *** core ***
+
+		// core: for s = 0 to S do
+		for(int s = 0; s < S; s++)
+		{
+			// core: pass-core
+			op4s_sdl_pass_inv_core_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		}
+
+		// *** epilog2 ***
+
+		// epilog2: export(3)
+		op4s_sdl_export_s_ref(l, &arr[2*steps], 3);
+
+		// epilog2: pass-epilog
+		op4s_sdl_pass_inv_epilog_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// epilog2: export(2)
+		op4s_sdl_export_s_ref(l, &arr[2*steps], 2);
+
+		// epilog2: pass-epilog
+		op4s_sdl_pass_inv_epilog_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// epilog2: export(1)
+		op4s_sdl_export_s_ref(l, &arr[2*steps], 1);
+
+		// epilog2: pass-epilog
+		op4s_sdl_pass_inv_epilog_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// epilog2: export(0)
+		op4s_sdl_export_s_ref(l, &arr[2*steps], 0);
+	}
+	else if ( scaling > 0 )
+	{
+		// ****** forward transform ******
+
+		// FIXME(ASVP): support for several workers
+		assert( 1 == dwt_util_get_num_workers() );
+
+		// *** init ***
+
+		// this pointer is needed because of use of arr[] in import and export functions
+		float *restrict addr = arr;
+
+		// *** prolog2 ***
+
+		// prolog2: import(3)
+		op4s_sdl_import_s_ref(l, arr, 3);
+
+		// prolog2: pass-prolog
+		op4s_sdl_pass_fwd_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+	
+		// prolog2: import(2)
+		op4s_sdl_import_s_ref(l, arr, 2);
+
+		// prolog2: pass-prolog
+		op4s_sdl_pass_fwd_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(1)
+		op4s_sdl_import_s_ref(l, arr, 1);
+
+		// prolog2: pass-prolog
+		op4s_sdl_pass_fwd_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// prolog2: import(0)
+		op4s_sdl_import_s_ref(l, arr, 0);
+
+		// *** core ***
+
+		// core: for s = 0 to S do
+		for(int s = 0; s < S; s++)
+		{
+			// core: pass-core
+			op4s_sdl_pass_fwd_core_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		}
+
+		// *** epilog2 ***
+
+		// epilog2: export(3)
+		op4s_sdl_export_s_ref(l, &arr[2*steps], 3);
+
+		// epilog2: pass-epilog
+		op4s_sdl_pass_fwd_epilog_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// epilog2: export(2)
+		op4s_sdl_export_s_ref(l, &arr[2*steps], 2);
+
+		// epilog2: pass-epilog
+		op4s_sdl_pass_fwd_epilog_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// epilog2: export(1)
+		op4s_sdl_export_s_ref(l, &arr[2*steps], 1);
+
+		// epilog2: pass-epilog
+		op4s_sdl_pass_fwd_epilog_s_ref(w, v, l, c, r, z, in, out, &addr);
+
+		// epilog2: export(0)
+		op4s_sdl_export_s_ref(l, &arr[2*steps], 0);
+	}
+	else
+	{
+		// ****** transform w/o scaling ******
+
+		// not implemented yet
+		dwt_util_abort();
+	}
+}
+
+/**
+ * @brief Double-loop algorithm from Rade Kutil: A Single-Loop Approach to
+ * SIMD Parallelization of 2-D Wavelet Lifting.
+ */
+static
+void accel_lift_op4s_main_dl_s(
+	float *arr,
+	int steps,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	assert( steps >= 0 );
+
+	if( scaling < 0 )
+	{
+		for(int w = 0; w < dwt_util_get_num_workers(); w++)
+		{
+			float *arr_local = calc_temp_offset_s(arr, w);
+
+			const float w[4] = { delta, gamma, beta, alpha };
+
+			// values that have to be passed from iteration to iteration
+			// slide in left border
+			float l[4] = { arr_local[0], arr_local[1], arr_local[2], arr_local[3] };
+
+			// loop by pairs from left to right
+			for(int s = 0; s < steps; s++)
+			{
+				// auxiliary variables
+				float in0;
+				float in1;
+				float out0;
+				float out1;
+
+				// inputs
+				in0 = arr_local[4+0+s*2];
+				in1 = arr_local[4+1+s*2];
+
+				// scales
+				in0 = in0 * 1/zeta;
+				in1 = in1 *   zeta;
+
+				// shuffles
+				float c[4] = { l[1], l[2], l[3], in0 };
+				out0 = l[0];
+
+				float r[4];
+
+				// operation z[] = c[] + { alpha, beta, gamma, delta } * ( l[] + r[] )
+				// by sequential computation from top/right to bottom/left
+				r[3] = in1;
+				r[2] = c[3]+w[3]*(l[3]+r[3]);
+				r[1] = c[2]+w[2]*(l[2]+r[2]);
+				r[0] = c[1]+w[1]*(l[1]+r[1]);
+				out1 = c[0]+w[0]*(l[0]+r[0]);
+
+				// outputs
+				arr_local[0+0+s*2] = out0;
+				arr_local[0+1+s*2] = out1;
+
+				// update l[]
+				l[0] = r[0];
+				l[1] = r[1];
+				l[2] = r[2];
+				l[3] = r[3];
+			}
+
+			// slide out right border
+			arr_local[steps*2+0] = l[0];
+			arr_local[steps*2+1] = l[1];
+			arr_local[steps*2+2] = l[2];
+			arr_local[steps*2+3] = l[3];
+		}
+	}
+	else if ( scaling > 0 )
+	{
+		for(int w = 0; w < dwt_util_get_num_workers(); w++)
+		{
+			float *arr_local = calc_temp_offset_s(arr, w);
+
+			const float w[4] = { delta, gamma, beta, alpha };
+
+			// values that have to be passed from iteration to iteration
+			// slide in left border
+			float l[4] = { arr_local[0], arr_local[1], arr_local[2], arr_local[3] };
+
+			// loop by pairs from left to right
+			for(int s = 0; s < steps; s++)
+			{
+				// auxiliary variables
+				float in0;
+				float in1;
+				float out0;
+				float out1;
+
+				// inputs
+				in0 = arr_local[4+0+s*2];
+				in1 = arr_local[4+1+s*2];
+
+				// shuffles
+				float c[4] = { l[1], l[2], l[3], in0 };
+				out0 = l[0];
+
+				float r[4];
+
+				// operation z[] = c[] + { alpha, beta, gamma, delta } * ( l[] + r[] )
+				// by sequential computation from top/right to bottom/left
+				r[3] = in1;
+				r[2] = c[3]+w[3]*(l[3]+r[3]);
+				r[1] = c[2]+w[2]*(l[2]+r[2]);
+				r[0] = c[1]+w[1]*(l[1]+r[1]);
+				out1 = c[0]+w[0]*(l[0]+r[0]);
+
+				// scales
+				out0 = out0 * 1/zeta;
+				out1 = out1 *   zeta;
+
+				// outputs
+				arr_local[0+0+s*2] = out0;
+				arr_local[0+1+s*2] = out1;
+
+				// update l[]
+				l[0] = r[0];
+				l[1] = r[1];
+				l[2] = r[2];
+				l[3] = r[3];
+			}
+
+			// slide out right border
+			arr_local[steps*2+0] = l[0];
+			arr_local[steps*2+1] = l[1];
+			arr_local[steps*2+2] = l[2];
+			arr_local[steps*2+3] = l[3];
+		}
+	}
+	else
+	{
+		// fallback, not implemented
+		accel_lift_op4s_main_s(arr, steps, alpha, beta, gamma, delta, zeta, scaling);
+	}
+}
+
+int dwt_util_is_aligned_8(
+	const void *ptr)
+{
+	return is_aligned_8(ptr);
+}
+
+int dwt_util_is_aligned_4(
+	const void *ptr)
+{
+	return is_aligned_4(ptr);
+}
+
+/**
+ * @brief Accelerated PicoBlaze operation.
+ *
+ * Two pairs (predict and update) of lifting steps and coefficients scaling
+ * merged together. This function is accelerated on ASVP/EdkDSP.
+ */
+static
+void accel_lift_op4s_main_pb_s(
+	float *arr,
+	int steps,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	FUNC_BEGIN;
+
+	assert( steps >= 0 );
+
+#ifdef microblaze
+	UNUSED(scaling);
+	UNUSED(alpha);
+	UNUSED(beta);
+	UNUSED(gamma);
+	UNUSED(delta);
+	UNUSED(zeta);
+
+	assert( steps <= (BANK_SIZE - 4) / 2 );
+
+	const int size = 2*steps + 4;
+	float *addr = arr; // FIXME: not needed
+
+	assert( is_aligned_8(addr) );
+	assert( is_even(size) );
+
+	for(int w = 0; w < get_active_workers(); w++)
+	{
+		// FIXME(ASVP): channel w according to worker ID; but each worker has independent DMA channels, thus this is not necessary
+		const uint8_t ch = w;
+		float *addr_local = calc_temp_offset_s(addr, w);
+		
+		assert( is_aligned_8(addr_local) );
+
+		WAL_CHECK( wal_dma_configure(worker[w], ch, addr_local, 0, WAL_BCE_JSY_DMEM_A, WAL_BANK_POS(0), size) );
+		WAL_CHECK( wal_dma_start(worker[w], ch, WAL_DMA_REQ_RD) );
+	}
+
+	for(int w = 0; w < get_active_workers(); w++)
+	{
+		// HACK(ASVP): wait for completing memory transfers on all 8 channels; but each worker has independent DMA channels
+		while( wal_dma_isbusy(worker[w], /*WAL_DMA_MASK(ch)*/ 0x0f) )
+			;
+	}
+
+	const uint32_t steps_32 = (uint32_t)steps;
+
+	// start BCE computations
+	for(int w = 0; w < get_active_workers(); w++)
+	{
+		WAL_CHECK( wal_mb2cmem(worker[w], WAL_CMEM_MB2PB, 0x01, &steps_32, 1) );
+
+		WAL_CHECK( wal_mb2pb(worker[w], 1) );
+	}
+
+	// wait for finishing every BCE computation
+	for(int w = 0; w < get_active_workers(); w++)
+	{
+		WAL_CHECK( wal_pb2mb(worker[w], NULL) );
+	}
+
+	assert( is_aligned_8(addr) );
+	assert( is_even(size) );
+
+	for(int w = 0; w < get_active_workers(); w++)
+	{
+		const uint8_t ch = w;
+		float *addr_local = calc_temp_offset_s(addr, w);
+
+		assert( is_aligned_8(addr_local) );
+
+		WAL_CHECK( wal_dma_configure(worker[w], ch, addr_local, 0, WAL_BCE_JSY_DMEM_C, WAL_BANK_POS(0), size) );
+		WAL_CHECK( wal_dma_start(worker[w], ch, WAL_DMA_REQ_WR) );
+	}
+
+	for(int w = 0; w < get_active_workers(); w++)
+	{
+		while( wal_dma_isbusy(worker[w], /*WAL_DMA_MASK(ch)*/ 0x0f) )
+			;
+	}
+
+	for(int w = 0; w < get_active_workers(); w++)
+	{
+		float *addr_local = calc_temp_offset_s(addr, w);
+
+		flush_cache_s(addr_local-1, size); // HACK(ASVP): why -1?
+	}
+#else /* microblaze */
+	// fallback
+	accel_lift_op4s_main_s(arr, steps, alpha, beta, gamma, delta, zeta, scaling);
+#endif /* microblaze */
+
+	FUNC_END;
+}
+
+static
+void accel_lift_op4s_prolog_s(
+	float *arr,
+	int off,
+	int N,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	assert( N-off >= 4 );
+
+#ifdef NDEBUG
+	UNUSED(N);
+#endif
+
+	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+	{
+		float *arr_local = calc_temp_offset_s(arr, w);
+		
+		if(off)
+		{
+			// inv-scaling
+			if( scaling < 0 )
+			{
+				// TODO
+			}
+
+			// alpha
+			arr_local[1] += alpha*(arr_local[0]+arr_local[2]);
+			arr_local[3] += alpha*(arr_local[2]+arr_local[4]);
+
+			// beta
+			arr_local[0] += 2*beta*(arr_local[1]);
+			arr_local[2] += beta*(arr_local[1]+arr_local[3]);
+		
+			// gamma
+			arr_local[1] += gamma*(arr_local[0]+arr_local[2]);
+		
+			// delta
+			arr_local[0] += 2*delta*(arr_local[1]);
+
+			// scaling
+			if( scaling > 0)
+			{
+				arr_local[0] *= zeta;
+			}
+		}
+		else
+		{
+			// inv-scaling
+			if( scaling < 0 )
+			{
+				arr_local[0] *= 1/zeta;
+				arr_local[1] *= zeta;
+				arr_local[2] *= 1/zeta;
+				arr_local[3] *= zeta;
+			}
+
+			// alpha
+			arr_local[0] += 2*alpha*(arr_local[1]);
+			arr_local[2] += alpha*(arr_local[1]+arr_local[3]);
+			
+			// beta
+			arr_local[1] += beta*(arr_local[0]+arr_local[2]);
+		
+			// gamma
+			arr_local[0] += 2*gamma*(arr_local[1]);
+		
+			// delta
+			// none
+
+			// scaling
+			// none
+		}
+	}
+}
+
+static
+void accel_lift_op4s_epilog_s(
+	float *arr,
+	int off,
+	int N,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	assert( N-off >= 4 );
+
+	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+	{
+		float *arr_local = calc_temp_offset_s(arr, w);
+
+		if( is_even(N-off) )
+		{
+			// inv-scaling
+			if( scaling < 0 )
+			{
+				// TODO
+			}
+
+			// alpha
+			// none
+
+			// beta
+			arr_local[N-1] += 2*beta*(arr_local[N-2]);
+
+			// gamma
+			arr_local[N-2] += gamma*(arr_local[N-1]+arr_local[N-3]);
+
+			// delta
+			arr_local[N-1] += 2*delta*(arr_local[N-2]);
+			arr_local[N-3] += delta*(arr_local[N-4]+arr_local[N-2]);
+
+			// scaling
+			if( scaling > 0 )
+			{
+				// FIXME: this is dependend on "off"
+				arr_local[N-4] *= 1/zeta;
+				arr_local[N-3] *= zeta;
+				arr_local[N-2] *= 1/zeta;
+				arr_local[N-1] *= zeta;
+			}
+		}
+		else /* is_odd(N-off) */
+		{
+			// inv-scaling
+			if( scaling < 0 )
+			{
+				arr_local[N-1] *= 1/zeta;
+			}
+
+			// alpha
+			arr_local[N-1] += 2*alpha*(arr_local[N-2]);
+
+			// beta
+			arr_local[N-2] += beta*(arr_local[N-1]+arr_local[N-3]);
+
+			// gamma
+			arr_local[N-1] += 2*gamma*(arr_local[N-2]);
+			arr_local[N-3] += gamma*(arr_local[N-2]+arr_local[N-4]);
+
+			// delta
+			arr_local[N-2] += delta*(arr_local[N-1]+arr_local[N-3]);
+			arr_local[N-4] += delta*(arr_local[N-5]+arr_local[N-3]);
+
+			// scaling
+			if( scaling > 0 )
+			{
+				// FIXME: this is dependend on "off"
+				arr_local[N-5] *= 1/zeta;
+				arr_local[N-4] *= zeta;
+				arr_local[N-3] *= 1/zeta;
+				arr_local[N-2] *= zeta;
+				arr_local[N-1] *= 1/zeta;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Prolog and epilog for N-off < 4.
+ */
+static
+void accel_lift_op4s_short_s(
+	float *arr,
+	int off,
+	int N,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	assert( N-off < 4 );
+
+	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+	{
+		float *arr_local = calc_temp_offset_s(arr, w);
+
+		if(off)
+		{
+			if( N == 2 )
+			{
+				// inv-scaling
+				if( scaling < 0 )
+				{
+					// TODO
+				}
+
+				// alpha
+				arr_local[1] += 2*alpha*(arr_local[0]);
+
+				// beta
+				arr_local[0] += 2*beta*(arr_local[1]);
+
+				// gamma
+				arr_local[1] += 2*gamma*(arr_local[0]);
+
+				// delta
+				arr_local[0] += 2*delta*(arr_local[1]);
+
+				// scaling
+				if( scaling > 0 )
+				{
+					arr_local[0] *= zeta;
+					arr_local[1] *= 1/zeta;
+				}
+			}
+			else
+			if( N == 3 )
+			{
+				// inv-scaling
+				if( scaling < 0 )
+				{
+					// TODO
+				}
+
+				// alpha
+				arr_local[1] += alpha*(arr_local[0]+arr_local[2]);
+
+				// beta
+				arr_local[0] += 2*beta*(arr_local[1]);
+				arr_local[2] += 2*beta*(arr_local[1]);
+
+				// gamma
+				arr_local[1] += gamma*(arr_local[0]+arr_local[2]);
+
+				// delta
+				arr_local[0] += 2*delta*(arr_local[1]);
+				arr_local[2] += 2*delta*(arr_local[1]);
+
+				// scaling
+				if( scaling > 0 )
+				{
+					arr_local[0] *= zeta;
+					arr_local[1] *= 1/zeta;
+					arr_local[2] *= zeta;
+				}
+			}
+			else /* N == 4 */
+			{
+				// inv-scaling
+				if( scaling < 0 )
+				{
+					// TODO
+				}
+
+				// alpha
+				arr_local[1] += alpha*(arr_local[0]+arr_local[2]);
+				arr_local[3] += 2*alpha*(arr_local[2]);
+
+				// beta
+				arr_local[0] += 2*beta*(arr_local[1]);
+				arr_local[2] += beta*(arr_local[1]+arr_local[3]);
+
+				// gamma
+				arr_local[1] += gamma*(arr_local[0]+arr_local[2]);
+				arr_local[3] += 2*gamma*(arr_local[2]);
+
+				// delta
+				arr_local[0] += 2*delta*(arr_local[1]);
+				arr_local[2] += delta*(arr_local[1]+arr_local[3]);
+
+				// scaling
+				if( scaling > 0 )
+				{
+					arr_local[0] *= zeta;
+					arr_local[1] *= 1/zeta;
+					arr_local[2] *= zeta;
+					arr_local[3] *= 1/zeta;
+				}
+			}
+		}
+		else /* !off */
+		{
+			if( N == 2 )
+			{
+				// inv-scaling
+				if( scaling < 0 )
+				{
+					arr_local[0] *= 1/zeta;
+					arr_local[1] *= zeta;
+				}
+
+				// alpha
+				arr_local[0] += 2*alpha*(arr_local[1]);
+
+				// beta
+				arr_local[1] += 2*beta*(arr_local[0]);
+
+				// gamma
+				arr_local[0] += 2*gamma*(arr_local[1]);
+
+				// delta
+				arr_local[1] += 2*delta*(arr_local[0]);
+
+				// scaling
+				if( scaling > 0 )
+				{
+					// TODO
+				}
+			}
+			else /* N == 3 */
+			{
+				// inv-scaling
+				if( scaling < 0 )
+				{
+					arr_local[0] *= 1/zeta;
+					arr_local[1] *= zeta;
+					arr_local[2] *= 1/zeta;
+				}
+
+				// alpha
+				arr_local[0] += 2*alpha*(arr_local[1]);
+				arr_local[2] += 2*alpha*(arr_local[1]);
+
+				// beta
+				arr_local[1] += beta*(arr_local[0]+arr_local[2]);
+
+				// gamma
+				arr_local[0] += 2*gamma*(arr_local[1]);
+				arr_local[2] += 2*gamma*(arr_local[1]);
+
+				// delta
+				arr_local[1] += delta*(arr_local[0]+arr_local[2]);
+
+				// scaling
+				if( scaling > 0 )
+				{
+					// TODO
+				}
+			}
+		}
+	}
+}
+
+static
+void accel_lift_op4s_s(
+	float *restrict arr,
+	int off,
+	int len,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	assert( len >= 2 );
+	assert( 0 == off || 1 == off );
+
+	if( len-off < 4 )
+	{
+		accel_lift_op4s_short_s(arr, off, len, alpha, beta, gamma, delta, zeta, scaling);
+	}
+	else
+	{
+		accel_lift_op4s_prolog_s(arr, off, len, alpha, beta, gamma, delta, zeta, scaling);
+
+		// FIXME: with GCC use (un)likely, i.e. __builtin_expect
+		// the block-acceleration splits signals into its memory banks, it is not in the table of kernels
+		if(1 == get_accel_type())
+		{
+			const int max_inner_len = to_even(BANK_SIZE) - 4;
+			const int inner_len = to_even(len-off) - 4;
+			const int blocks = inner_len / max_inner_len;
+
+			// full length blocks
+			for(int b = 0; b < blocks; b++)
+			{
+				const int left = off + b * max_inner_len;
+				const int steps = max_inner_len/2;
+
+				accel_lift_op4s_main_pb_s(&arr[left], steps, alpha, beta, gamma, delta, zeta, scaling);
+			}
+
+			// last block
+			if( blocks*max_inner_len < inner_len )
+			{
+				const int left = off + blocks * max_inner_len;
+				const int steps = (off + inner_len - left)/2;
+
+				// TODO(ASVP): here should be a test if last block should be accelerated on PicoBlaze or rather computed on MicroBlaze
+				if( steps > 25 )
+					accel_lift_op4s_main_pb_s(&arr[left], steps, alpha, beta, gamma, delta, zeta, scaling);
+				else
+					accel_lift_op4s_main_s(&arr[left], steps, alpha, beta, gamma, delta, zeta, scaling);
+			}
+		}
+		else if(3 == get_accel_type())
+		{
+			off = 0;
+			accel_lift_op4s_main_pb_s(arr+off, (to_even(len-off)-4)/2, alpha, beta, gamma, delta, zeta, scaling);
+		}
+		else
+		{
+			// single signal, see accel_lift_op4s_group_s for groups
+			const struct accel_kernels *accel = get_accel();
+			const int steps = (to_even(len-off)-4)/2;
+
+			if( steps >= 3 && NULL != accel->main_sdl_s )
+				accel->main_sdl_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
+			else if( NULL != accel->main_s )
+				accel->main_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
+			else
+				accel_lift_op4s_main_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
+		}
+
+		accel_lift_op4s_epilog_s(arr, off, len, alpha, beta, gamma, delta, zeta, scaling);
+	}
+}
+
+/**
+ * @brief Number of signals lifted together by the selected acceleration.
+ *
+ * The 2-D transforms process rows (and columns) in groups of this size.
+ */
+static
+int get_accel_group_s()
+{
+	const struct accel_kernels *accel = get_accel();
+
+	return NULL != accel->main_group_s ? accel->group_s : 1;
+}
+
+/**
+ * @brief Lift a group of @p count signals of the same length at once.
+ *
+ * The k-th signal is stored at @p arr + k * @p dist. Groups that do not fit
+ * the selected vector kernel are lifted one signal after another.
+ */
+static
+void accel_lift_op4s_group_s(
+	float *restrict arr,
+	int dist,
+	int count,
+	int off,
+	int len,
+	float alpha,
+	float beta,
+	float gamma,
+	float delta,
+	float zeta,
+	int scaling)
+{
+	assert( count > 0 );
+	assert( len >= 2 );
+	assert( 0 == off || 1 == off );
+
+	const int steps = (to_even(len-off)-4)/2;
+
+	if( count != get_accel_group_s() || len-off < 4 || steps < 3 )
+	{
+		for(int k = 0; k < count; k++)
+			accel_lift_op4s_s(arr+k*dist, off, len, alpha, beta, gamma, delta, zeta, scaling);
+
+		return;
+	}
+
+	for(int k = 0; k < count; k++)
+		accel_lift_op4s_prolog_s(arr+k*dist, off, len, alpha, beta, gamma, delta, zeta, scaling);
+
+	get_accel()->main_group_s(arr+off, dist, steps, alpha, beta, gamma, delta, zeta, scaling);
+
+	for(int k = 0; k < count; k++)
+		accel_lift_op4s_epilog_s(arr+k*dist, off, len, alpha, beta, gamma, delta, zeta, scaling);
+}
+
+static
+void op4s_cols_op_s_ref(float *restrict dst, const float *l, const float *r, float c, int cols)
+{
+	for(int k = 0; k < cols; k++)
+		dst[k] += c * (l[k] + r[k]);
+}
+
+static
+void op4s_cols_scale_s_ref(float *restrict dst, float c, int cols)
+{
+	for(int k = 0; k < cols; k++)
+		dst[k] *= c;
+}
+
+#ifdef __SSE__
+#define op4s_cols_op_s_sse(dst, l, r, c, cols) \
+do { \
+	const __m128 cw = _mm_set1_ps(c); \
+	for(int k = 0; k < (cols); k += 4) \
+	{ \
+		__m128 t = _mm_add_ps(_mm_loadu_ps((l)+k), _mm_loadu_ps((r)+k)); \
+		_mm_storeu_ps((dst)+k, _mm_add_ps(_mm_loadu_ps((dst)+k), _mm_mul_ps(cw, t))); \
+	} \
+} while(0)
+
+#define op4s_cols_scale_s_sse(dst, c, cols) \
+do { \
+	const __m128 cv = _mm_set1_ps(c); \
+	for(int k = 0; k < (cols); k += 4) \
+		_mm_storeu_ps((dst)+k, _mm_mul_ps(_mm_loadu_ps((dst)+k), cv)); \
+} while(0)
+#endif
+
+#ifdef USE_AVX
+#define op4s_cols_op_s_avx(dst, l, r, c, cols) \
+do { \
+	const __m256 cw = _mm256_set1_ps(c); \
+	for(int k = 0; k < (cols); k += 8) \
+	{ \
+		__m256 t = _mm256_add_ps(_mm256_loadu_ps((l)+k), _mm256_loadu_ps((r)+k)); \
+		_mm256_storeu_ps((dst)+k, _mm256_add_ps(_mm256_loadu_ps((dst)+k), _mm256_mul_ps(cw, t))); \
+	} \
+} while(0)
+
+#define op4s_cols_scale_s_avx(dst, c, cols) \
+do { \
+	const __m256 cv = _mm256_set1_ps(c); \
+	for(int k = 0; k < (cols); k += 8) \
+		_mm256_storeu_ps((dst)+k, _mm256_mul_ps(_mm256_loadu_ps((dst)+k), cv)); \
+} while(0)
+#endif
+
+#ifdef USE_AVX512F
+#define op4s_cols_op_s_avx512(dst, l, r, c, cols) \
+do { \
+	const __m512 cw = _mm512_set1_ps(c); \
+	for(int k = 0; k < (cols); k += 16) \
+	{ \
+		__m512 t = _mm512_add_ps(_mm512_loadu_ps((l)+k), _mm512_loadu_ps((r)+k)); \
+		_mm512_storeu_ps((dst)+k, _mm512_add_ps(_mm512_loadu_ps((dst)+k), _mm512_mul_ps(cw, t))); \
+	} \
+} while(0)
+
+#define op4s_cols_scale_s_avx512(dst, c, cols) \
+do { \
+	const __m512 cv = _mm512_set1_ps(c); \
+	for(int k = 0; k < (cols); k += 16) \
+		_mm512_storeu_ps((dst)+k, _mm512_mul_ps(_mm512_loadu_ps((dst)+k), cv)); \
+} while(0)
+#endif
+
+/**
+ * @brief Multi-loop lifting of @p N rows of @p cols floats.
+ *
+ * Each row holds one sample of @p cols independent signals (adjacent
+ * columns of an image), so the lifting steps operate on whole rows. The
+ * rows are @p stride bytes apart. The first lifting step is applied on
+ * rows of parity @p off. Coefficients @p w are { alpha, beta, gamma, delta }.
+ */
+static
+void accel_lift_op4s_cols_ref_s(
+	float *arr,
+	int N,
+	int cols,
+	int stride,
+	int off,
+	const float *w,
+	float zeta,
+	int scaling)
+{
+	if( scaling < 0 )
+	{
+		for(int i = 0; i < N; i++)
+			op4s_cols_scale_s_ref(addr1_s(arr, i, stride), is_even(i) ? 1/zeta : zeta, cols);
+	}
+
+	for(int s = 0; s < 4; s++)
+	{
+		for(int i = (off+s)&1; i < N; i += 2)
+		{
+			// symmetric extension on borders
+			const float *l = addr1_const_s(arr, i > 0   ? i-1 : i+1, stride);
+			const float *r = addr1_const_s(arr, i < N-1 ? i+1 : i-1, stride);
+
+			op4s_cols_op_s_ref(addr1_s(arr, i, stride), l, r, w[s], cols);
+		}
+	}
+
+	if( scaling > 0 )
+	{
+		for(int i = 0; i < N; i++)
+			op4s_cols_scale_s_ref(addr1_s(arr, i, stride), is_even(i) ? zeta : 1/zeta, cols);
+	}
+}
+
+#ifdef __SSE__
+static
+void accel_lift_op4s_cols_sse_s(
+	float *arr,
+	int N,
+	int cols,
+	int stride,
+	int off,
+	const float *w,
+	float zeta,
+	int scaling)
+{
+	assert( 0 == cols % 4 );
+
+	if( scaling < 0 )
+	{
+		for(int i = 0; i < N; i++)
+			op4s_cols_scale_s_sse(addr1_s(arr, i, stride), is_even(i) ? 1/zeta : zeta, cols);
+	}
+
+	for(int s = 0; s < 4; s++)
+	{
+		for(int i = (off+s)&1; i < N; i += 2)
+		{
+			// symmetric extension on borders
+			const float *l = addr1_const_s(arr, i > 0   ? i-1 : i+1, stride);
+			const float *r = addr1_const_s(arr, i < N-1 ? i+1 : i-1, stride);
+
+			op4s_cols_op_s_sse(addr1_s(arr, i, stride), l, r, w[s], cols);
+		}
+	}
+
+	if( scaling > 0 )
+	{
+		for(int i = 0; i < N; i++)
+			op4s_cols_scale_s_sse(addr1_s(arr, i, stride), is_even(i) ? zeta : 1/zeta, cols);
+	}
+}
+#endif
+
+#ifdef USE_AVX
+static
+TARGET_AVX
+void accel_lift_op4s_cols_avx_s(
+	float *arr,
+	int N,
+	int cols,
+	int stride,
+	int off,
+	const float *w,
+	float zeta,
+	int scaling)
+{
+	assert( 0 == cols % 8 );
+
+	if( scaling < 0 )
+	{
+		for(int i = 0; i < N; i++)
+			op4s_cols_scale_s_avx(addr1_s(arr, i, stride), is_even(i) ? 1/zeta : zeta, cols);
+	}
+
+	for(int s = 0; s < 4; s++)
+	{
+		for(int i = (off+s)&1; i < N; i += 2)
+		{
+			// symmetric extension on borders
+			const float *l = addr1_const_s(arr, i > 0   ? i-1 : i+1, stride);
+			const float *r = addr1_const_s(arr, i < N-1 ? i+1 : i-1, stride);
+
+			op4s_cols_op_s_avx(addr1_s(arr, i, stride), l, r, w[s], cols);
+		}
+	}
+
+	if( scaling > 0 )
+	{
+		for(int i = 0; i < N; i++)
+			op4s_cols_scale_s_avx(addr1_s(arr, i, stride), is_even(i) ? zeta : 1/zeta, cols);
+	}
+}
+#endif
+
+#ifdef USE_AVX512F
+static
+TARGET_AVX512F
+void accel_lift_op4s_cols_avx512_s(
+	float *arr,
+	int N,
+	int cols,
+	int stride,
+	int off,
+	const float *w,
+	float zeta,
+	int scaling)
+{
+	assert( 0 == cols % 16 );
+
+	if( scaling < 0 )
+	{
+		for(int i = 0; i < N; i++)
+			op4s_cols_scale_s_avx512(addr1_s(arr, i, stride), is_even(i) ? 1/zeta : zeta, cols);
+	}
+
+	for(int s = 0; s < 4; s++)
+	{
+		for(int i = (off+s)&1; i < N; i += 2)
+		{
+			// symmetric extension on borders
+			const float *l = addr1_const_s(arr, i > 0   ? i-1 : i+1, stride);
+			const float *r = addr1_const_s(arr, i < N-1 ? i+1 : i-1, stride);
+
+			op4s_cols_op_s_avx512(addr1_s(arr, i, stride), l, r, w[s], cols);
+		}
+	}
+
+	if( scaling > 0 )
+	{
+		for(int i = 0; i < N; i++)
+			op4s_cols_scale_s_avx512(addr1_s(arr, i, stride), is_even(i) ? zeta : 1/zeta, cols);
+	}
+}
+#endif
+
+/**
+ * @brief Lift @p N rows of @p cols adjacent columns with the widest vectors available.
+ *
+ * The rows are @p stride bytes apart. Columns not filling the whole vector
+ * are lifted by the reference implementation.
+ */
+static
+void accel_lift_op4s_cols_s(
+	float *arr,
+	int N,
+	int cols,
+	int stride,
 	float alpha,
 	float beta,
 	float gamma,
@@ -3454,2836 +10412,5321 @@ void accel_lift_op4s_main_sdl6_sse_s(
 	float zeta,
 	int scaling)
 {
-	// 6+ coeffs implies 3+ steps
-	assert( steps >= 3 );
+	assert( N >= 2 && cols > 0 );
 
-	assert( is_aligned_16(arr) );
+	const float w[4] = { alpha, beta, gamma, delta };
 
-	const __m128 w = { delta, gamma, beta, alpha };
-	const __m128 v = { 1/zeta, zeta, 1/zeta, zeta };
-	__m128 l;
-	__m128 r;
-	__m128 z;
-	__m128 in;
-	__m128 out;
+	// odd rows are predicted first in forward transform
+	const int off = scaling > 0 ? 1 : 0;
 
-	const int S = steps-3;
-	const int U = S / 6;
-	const int M = S % 6;
-	const int T = M >> 1;
+	// columns lifted by vector implementation
+	int vec = 0;
+
+#ifdef USE_AVX512F
+	if( !vec && cols >= 16 && cpu_has_avx512f() )
+	{
+		vec = cols & ~15;
+		accel_lift_op4s_cols_avx512_s(arr, N, vec, stride, off, w, zeta, scaling);
+	}
+#endif
+#ifdef USE_AVX
+	if( !vec && cols >= 8 && cpu_has_avx() )
+	{
+		vec = cols & ~7;
+		accel_lift_op4s_cols_avx_s(arr, N, vec, stride, off, w, zeta, scaling);
+	}
+#endif
+#ifdef __SSE__
+	if( !vec && cols >= 4 )
+	{
+		vec = cols & ~3;
+		accel_lift_op4s_cols_sse_s(arr, N, vec, stride, off, w, zeta, scaling);
+	}
+#endif
+	if( vec < cols )
+		accel_lift_op4s_cols_ref_s(arr+vec, N, cols-vec, stride, off, w, zeta, scaling);
+}
+
+/**
+ * @brief Number of adjacent columns lifted together in vertical pass.
+ *
+ * Whole cache lines (16 floats) are used when the temporary block of
+ * @p N rows fits into 256 KiB, otherwise the block is narrowed.
+ */
+static
+int get_cols_s(
+	int N)
+{
+	const int cols = (65536 / max(N, 1)) & ~3;
+
+	return max(4, min(16, cols));
+}
+
+/**
+ * @brief Number of short signals of the length @p N transformed together.
+ *
+ * Signals too short for the shifted double-loop (deep levels of the
+ * decomposition) are transposed into blocks of 16 signals (a whole cache
+ * line per sample) and lifted with vector lanes mapped across the signals.
+ * Returns zero for signals long enough.
+ */
+static
+int get_short_s(
+	int N)
+{
+	return N < 32 ? 16 : 0;
+}
+
+/**
+ * @brief Rows (columns) of a pass left to one thread.
+ *
+ * The owner takes blocks from the head, the other threads steal them from
+ * the tail. Each deque occupies its own cache line.
+ */
+struct dwt_deque
+{
+	int head;		///< first row (column) left to the owner
+	int tail;		///< one past the last row (column)
+#ifdef _OPENMP
+	omp_lock_t lock;	///< taken by the owner as well as by the thieves
+#endif
+	char pad[64-2*sizeof(int)
+#ifdef _OPENMP
+		-sizeof(omp_lock_t)
+#endif
+	];
+};
+
+/**
+ * @brief Workspace of the 2-D transforms.
+ *
+ * One slab per thread. Each slab holds a group of temporary signals
+ * followed by a block of transposed columns (see @ref get_cols_s and
+ * @ref get_short_s). The rows staged by @ref DWT_VERT_ROW are kept per
+ * thread aside, see @ref workspace_rows_s.
+ */
+struct dwt_workspace
+{
+	int size;		///< the largest length of a signal (in elements)
+	int threads;		///< number of slabs
+	int temp_dist;		///< distance between temporary signals of one group (in floats)
+	size_t slab;		///< distance between slabs (in floats)
+	float *data;		///< slabs aligned on 64 bytes
+	struct dwt_deque *deque;	///< rows (columns) left to each thread, see @ref sched_next
+	float **rows;		///< staged rows of each thread, allocated on first use
+	size_t *rows_size;	///< size of staged rows of each thread (in floats)
+	int busy;		///< used by a transform, see @ref acquire_workspace
+};
+
+/** workspace set by @ref dwt_util_set_workspace */
+struct dwt_workspace *dwt_util_global_workspace = NULL;
+
+/** workspace of the calling thread set by the batch transforms, takes precedence over @ref dwt_util_global_workspace */
+static struct dwt_workspace *dwt_util_thread_workspace = NULL;
+#pragma omp threadprivate(dwt_util_thread_workspace)
+
+/**
+ * @brief Allocate workspace with @p threads slabs.
+ */
+static
+void alloc_workspace(
+	struct dwt_workspace **pws,
+	int size_x,
+	int size_y,
+	int threads)
+{
+	assert( NULL != pws && threads > 0 );
+
+	struct dwt_workspace *ws = malloc(sizeof(struct dwt_workspace));
+	if( NULL == ws )
+	{
+		dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+		dwt_util_abort();
+	}
+
+	ws->size = max(1, max(size_x, size_y));
+	ws->threads = threads;
+	ws->busy = 0;
+	// preserves alignment on 16 bytes, covers also a signal of doubles
+	ws->temp_dist = (ws->size + 3 + 3) & ~3;
+	// the largest group is lifted by AVX-512
+	const size_t temp = (size_t)4 * ws->temp_dist;
+	const size_t block = max(65536, 4 * ws->size);
+	ws->slab = (temp + block + 15) & ~(size_t)15;
+
+	ws->data = memalign(64, sizeof(float) * ws->slab * ws->threads);
+	ws->deque = memalign(64, sizeof(struct dwt_deque) * ws->threads);
+	ws->rows = calloc(ws->threads, sizeof(float *));
+	ws->rows_size = calloc(ws->threads, sizeof(size_t));
+	if( NULL == ws->data || NULL == ws->deque || NULL == ws->rows || NULL == ws->rows_size )
+	{
+		dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+		dwt_util_abort();
+	}
+
+	for(int t = 0; t < ws->threads; t++)
+	{
+		ws->deque[t].head = 0;
+		ws->deque[t].tail = 0;
+#ifdef _OPENMP
+		omp_init_lock(&ws->deque[t].lock);
+#endif
+	}
+
+	*pws = ws;
+}
+
+void dwt_util_alloc_workspace(
+	struct dwt_workspace **pws,
+	int size_x,
+	int size_y)
+{
+	alloc_workspace(pws, size_x, size_y, dwt_util_get_max_threads());
+}
+
+void dwt_util_free_workspace(
+	struct dwt_workspace **pws)
+{
+	assert( NULL != pws );
+
+	if( NULL != *pws )
+	{
+		if( dwt_util_global_workspace == *pws )
+			dwt_util_global_workspace = NULL;
+
+#ifdef _OPENMP
+		for(int t = 0; t < (*pws)->threads; t++)
+			omp_destroy_lock(&(*pws)->deque[t].lock);
+#endif
+		for(int t = 0; t < (*pws)->threads; t++)
+			free((*pws)->rows[t]);
+		free((*pws)->rows);
+		free((*pws)->rows_size);
+		free((*pws)->deque);
+		free((*pws)->data);
+		free(*pws);
+	}
+
+	*pws = NULL;
+}
+
+void dwt_util_set_workspace(
+	struct dwt_workspace *ws)
+{
+	dwt_util_global_workspace = ws;
+}
+
+/**
+ * @brief Workspace for a transform with signals up to @p size elements.
+ *
+ * Returns the workspace of the calling thread of a batch transform or the
+ * workspace set by @ref dwt_util_set_workspace if it is large enough and
+ * not used by a concurrent transform, otherwise a temporary one. The
+ * workspace has to be released using @ref release_workspace.
+ */
+static
+struct dwt_workspace *acquire_workspace(
+	int size)
+{
+	if( NULL != dwt_util_thread_workspace && dwt_util_thread_workspace->size >= size && dwt_util_thread_workspace->threads >= dwt_util_get_max_threads() )
+		return dwt_util_thread_workspace;
+
+	struct dwt_workspace *ws = dwt_util_global_workspace;
+	int busy = 1;
+
+	if( NULL != ws && ws->size >= size && ws->threads >= dwt_util_get_max_threads() )
+	{
+		// the slabs and the deques cannot be shared by transforms called from several threads
+		#pragma omp critical(dwt_workspace)
+		{
+			busy = ws->busy;
+			ws->busy = 1;
+		}
+	}
+
+	if( busy )
+		dwt_util_alloc_workspace(&ws, size, size);
+
+	return ws;
+}
+
+static
+void release_workspace(
+	struct dwt_workspace *ws)
+{
+	if( dwt_util_thread_workspace == ws )
+		return;
+
+	if( dwt_util_global_workspace == ws )
+	{
+		#pragma omp critical(dwt_workspace)
+		ws->busy = 0;
+	}
+	else
+		dwt_util_free_workspace(&ws);
+}
+
+/** temporary signals of the calling thread */
+static
+float *workspace_temp_s(
+	struct dwt_workspace *ws)
+{
+	return ws->data + ws->slab * dwt_util_get_thread_num();
+}
+
+static
+double *workspace_temp_d(
+	struct dwt_workspace *ws)
+{
+	return (double *)workspace_temp_s(ws);
+}
+
+/** block of transposed columns of the calling thread */
+static
+float *workspace_block_s(
+	struct dwt_workspace *ws)
+{
+	return workspace_temp_s(ws) + 4 * ws->temp_dist;
+}
+
+enum dwt_sched dwt_util_global_sched = DWT_SCHED_STATIC;
+
+/**
+ * @brief Default elements of a level per thread.
+ *
+ * A thread then works for tens of microseconds on current CPUs, many times
+ * longer than a barrier of a small team. See
+ * @ref dwt_util_calibrate_level_grain for the value of the actual machine.
+ */
+#define DWT_LEVEL_GRAIN 16384
+
+/** elements of a level per thread, see @ref dwt_util_set_level_grain */
+int dwt_util_global_level_grain = DWT_LEVEL_GRAIN;
+
+/**
+ * @brief Number of threads taking part in a level of @p size_x times @p size_y elements.
+ *
+ * Each thread gets at least @ref dwt_util_global_level_grain elements, so
+ * the deep levels, whose work does not pay for the barriers of the team,
+ * run on fewer threads or on a single one.
+ */
+static
+int get_level_threads(
+	int size_x,
+	int size_y)
+{
+	const int threads = dwt_util_get_num_threads();
+
+	if( dwt_util_global_level_grain <= 0 )
+		return threads;
+
+	return max(1, min(threads, (int)((long)size_x * size_y / dwt_util_global_level_grain)));
+}
+
+static
+void deque_lock(
+	struct dwt_deque *d)
+{
+#ifdef _OPENMP
+	omp_set_lock(&d->lock);
+#else
+	UNUSED(d);
+#endif
+}
+
+static
+void deque_unlock(
+	struct dwt_deque *d)
+{
+#ifdef _OPENMP
+	omp_unset_lock(&d->lock);
+#else
+	UNUSED(d);
+#endif
+}
+
+/**
+ * @brief Next block of a pass over @p n rows (columns) in blocks of @p step.
+ *
+ * Called by all threads of the team, first with @p i equal to -1, then
+ * with the previously returned row (column). Returns -1 when the pass is
+ * done for the calling thread, which should wait on a barrier then. Each
+ * thread starts with a contiguous range of blocks as in the static
+ * schedule. With @ref DWT_SCHED_STEAL, a thread running out of blocks
+ * steals a half of the blocks left to another thread. Only the first
+ * @p threads threads of the team take part in the pass (see
+ * @ref get_level_threads). Without the workspace (microblaze), the blocks
+ * are simply iterated.
+ */
+static
+int sched_next(
+	struct dwt_workspace *ws,
+	int threads,
+	int i,
+	int n,
+	int step)
+{
+	if( NULL == ws )
+	{
+		i = i < 0 ? 0 : i+step;
+
+		return i < n ? i : -1;
+	}
+
+#ifdef _OPENMP
+	// the team of the transform, one thread if the transform runs serially
+	threads = max(1, min(threads, omp_get_num_threads()));
+#else
+	threads = 1;
+#endif
+	const int thread = dwt_util_get_thread_num();
 
-	if( scaling < 0 )
-	{
-		// ****** inverse transform ******
+	// waits on the barrier
+	if( thread >= threads )
+		return -1;
 
-		// FIXME(ASVP): support for several workers
-		assert( 1 == dwt_util_get_num_workers() );
+	struct dwt_deque *own = &ws->deque[thread];
 
-		// *** init ***
+	if( i < 0 )
+	{
+		const int chunk = ceil_div(ceil_div(n, step), threads) * step;
 
-		float *restrict addr = arr;
+		deque_lock(own);
+		own->head = min(thread * chunk, n);
+		own->tail = min(own->head + chunk, n);
+		deque_unlock(own);
+	}
 
-		// *** prolog2 ***
+	for(;;)
+	{
+		deque_lock(own);
+		if( own->head < own->tail )
+		{
+			i = own->head;
+			own->head += step;
+			deque_unlock(own);
+			return i;
+		}
+		deque_unlock(own);
 
-		// prolog2: import-preload
-		op4s_sdl6_preload_prolog_s_sse(w, v, l, r, z, in, out, &addr);
+		if( DWT_SCHED_STEAL != dwt_util_global_sched )
+			return -1;
 
-		// prolog2: import(3)
-		op4s_sdl6_import_s_sse(l, 3, out);
+		// no blocks of the previous pass are left, all deques were emptied before its barrier
+		int head = 0, tail = 0;
 
-		// prolog2: pass-prolog-full
-		op4s_sdl6_pass_inv_prolog_full_s_sse(w, v, l, r, z, in, out, &addr);
+		// nearest threads first, they are likely to share a cache
+		for(int k = 1; k < threads && head == tail; k++)
+		{
+			struct dwt_deque *victim = &ws->deque[(thread + k) % threads];
 
-		// prolog2: import(2)
-		op4s_sdl6_import_s_sse(l, 2, out);
+			deque_lock(victim);
+			if( victim->head < victim->tail )
+			{
+				const int blocks = ceil_div(victim->tail - victim->head, step);
 
-		// prolog2: pass-prolog-light
-		op4s_sdl6_pass_inv_prolog_light_s_sse(w, v, l, r, z, in, out, &addr);
+				head = victim->head + (blocks - ceil_div2(blocks)) * step;
+				tail = victim->tail;
+				victim->tail = head;
+			}
+			deque_unlock(victim);
+		}
 
-		// prolog2: import(1)
-		op4s_sdl6_import_s_sse(l, 1, out);
+		if( head == tail )
+			return -1;
 
-		// prolog2: pass-prolog-full
-		op4s_sdl6_pass_inv_prolog_full_s_sse(w, v, l, r, z, in, out, &addr);
+		// only one deque is locked at a time
+		deque_lock(own);
+		own->head = head;
+		own->tail = tail;
+		deque_unlock(own);
+	}
+}
 
-		// prolog2: import(0)
-		op4s_sdl6_import_s_sse(l, 0, out);
+/**
+ * @brief Staged rows of at least @p size floats of the calling thread.
+ *
+ * Grown on demand and kept until the workspace is freed, so the first
+ * (largest) level allocates them once per workspace.
+ */
+static
+float *workspace_rows_s(
+	struct dwt_workspace *ws,
+	size_t size)
+{
+	const int thread = dwt_util_get_thread_num();
 
-		// *** core ***
+	if( ws->rows_size[thread] < size )
+	{
+		free(ws->rows[thread]);
 
-		// core: for u = 0 to U
-		for(int u = 0; u < U; u++)
+		ws->rows[thread] = malloc(sizeof(float) * size);
+		if( NULL == ws->rows[thread] )
 		{
-			// NOTE: l, r, z
+			dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+			dwt_util_abort();
+		}
 
-			// core: pass1-core-light
-			op4s_sdl6_pass_inv_core_light_s_sse(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+		ws->rows_size[thread] = size;
+	}
 
-			// NOTE: z => l, l => r, r => z
+	return ws->rows[thread];
+}
 
-			// core: pass1-core-full
-			op4s_sdl6_pass_inv_core_full_s_sse(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+/**
+ * @brief Distance between temporary signals of transposed columns (see @ref DWT_VERT_TRANSPOSE).
+ *
+ * The distance @p temp_dist is shifted by two cache lines so the transposed
+ * samples do not map into the same cache sets.
+ */
+static
+int get_transpose_dist_s(
+	int temp_dist)
+{
+	return ((temp_dist + 15) & ~15) + 32;
+}
 
-			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+/**
+ * @brief Number of adjacent columns transposed into temporary signals
+ * @p transpose_dist floats apart (see @ref DWT_VERT_TRANSPOSE).
+ *
+ * The signals occupy the whole slab, up to 16 columns (a whole cache line)
+ * are transposed at once.
+ */
+static
+int get_transpose_cols_s(
+	struct dwt_workspace *ws,
+	int transpose_dist)
+{
+	// the first signal is shifted by 3 floats
+	const int cols = (int)((ws->slab - 3) / transpose_dist) & ~3;
 
-			// core: pass2-core-light
-			op4s_sdl6_pass_inv_core_light_s_sse(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+	return max(1, min(16, cols));
+}
 
-			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+#ifdef __SSE__
+static
+void op4s_row_op_sse_s(float *restrict dst, const float *l, const float *r, float c, int cols)
+{
+	op4s_cols_op_s_sse(dst, l, r, c, cols);
+}
+#endif
 
-			// core: pass2-core-full
-			op4s_sdl6_pass_inv_core_full_s_sse(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+#ifdef USE_AVX
+static
+TARGET_AVX
+void op4s_row_op_avx_s(float *restrict dst, const float *l, const float *r, float c, int cols)
+{
+	op4s_cols_op_s_avx(dst, l, r, c, cols);
+}
+#endif
 
-			// NOTE: z => l, l => r, r => z
+#ifdef USE_AVX512F
+static
+TARGET_AVX512F
+void op4s_row_op_avx512_s(float *restrict dst, const float *l, const float *r, float c, int cols)
+{
+	op4s_cols_op_s_avx512(dst, l, r, c, cols);
+}
+#endif
 
-			// core: pass3-core-light
-			op4s_sdl6_pass_inv_core_light_s_sse(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+/**
+ * @brief One lifting step on the row @p dst of @p cols floats with neighbouring rows @p l and @p r.
+ */
+static
+void op4s_row_op_s(
+	float *restrict dst,
+	const float *l,
+	const float *r,
+	float c,
+	int cols)
+{
+	// columns processed by vector implementation
+	int vec = 0;
+
+#ifdef USE_AVX512F
+	if( !vec && cols >= 16 && cpu_has_avx512f() )
+	{
+		vec = cols & ~15;
+		op4s_row_op_avx512_s(dst, l, r, c, vec);
+	}
+#endif
+#ifdef USE_AVX
+	if( !vec && cols >= 8 && cpu_has_avx() )
+	{
+		vec = cols & ~7;
+		op4s_row_op_avx_s(dst, l, r, c, vec);
+	}
+#endif
+#ifdef __SSE__
+	if( !vec && cols >= 4 )
+	{
+		vec = cols & ~3;
+		op4s_row_op_sse_s(dst, l, r, c, vec);
+	}
+#endif
+	op4s_cols_op_s_ref(dst+vec, l+vec, r+vec, c, cols-vec);
+}
 
-			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+/**
+ * @brief Multiply the row @p src of @p cols floats by @p c and store it into @p dst.
+ *
+ * The rows @p dst and @p src can be the same.
+ */
+static
+void op4s_row_mul_s(
+	float *dst,
+	const float *src,
+	float c,
+	int cols)
+{
+	if( dst != src )
+		memcpy(dst, src, cols*sizeof(float));
 
-			// core: pass3-core-full
-			op4s_sdl6_pass_inv_core_full_s_sse(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+	// columns processed by vector implementation
+	int vec = 0;
 
-			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
-		}
+#ifdef __SSE__
+	vec = cols & ~3;
+	op4s_cols_scale_s_sse(dst, c, vec);
+#endif
+	op4s_cols_scale_s_ref(dst+vec, c, cols-vec);
+}
 
-		// core: for t = 0 to T do
-		for(int t = 0; t < T; t++)
+/**
+ * @brief Non-accelerated lifting with two lifting steps.
+ *
+ * One pair (predict and update) of lifting steps and coefficients scaling
+ * merged together. Counterpart of accel_lift_op4s_main_s for wavelets with
+ * two lifting steps only (e.g. CDF 5/3).
+ *
+ * @param[in] scaling Perform scaling of coefficients. Possible values are:
+ *   @li s = 0 : without scaling,
+ *   @li s > 0 : scaling after lifting,
+ *   @li s < 0 : scaling before lifting.
+ */
+static
+void accel_lift_op2s_main_s(
+	float *arr,
+	int steps,
+	float alpha,
+	float beta,
+	float zeta,
+	int scaling)
+{
+	assert( steps >= 0 );
+
+	if( scaling < 0 )
+	{
+		for(int s = 0; s < steps; s++)
 		{
-			// core: pass-core-light
-			op4s_sdl6_pass_inv_postcore_light_s_sse(w, v, l, r, z, in, out, &addr);
+			arr[2+s*2] *= 1/zeta;
+		}
 
-			// core: pass-core-full
-			op4s_sdl6_pass_inv_postcore_full_s_sse(w, v, l, r, z, in, out, &addr);
+		for(int s = 0; s < steps; s++)
+		{
+			arr[3+s*2] *= zeta;
 		}
+	}
 
-		// core: if odd then
-		if( is_odd(S) )
+	const float coeffs[2] = {beta, alpha};
+
+	for(int off = 2; off >= 1; off--)
+	{
+		float *out = arr+off;
+
+		const float c = coeffs[off-1];
+
+		for(int s = 0; s < steps; s++)
 		{
-			// core: pass-core-light
-			op4s_sdl6_pass_inv_postcore_light_s_sse(w, v, l, r, z, in, out, &addr);
+			out[0] += c * (out[-1] + out[+1]);
+
+			out += 2;
 		}
+	}
 
-		// *** epilog2 ***
+	if( scaling > 0 )
+	{
+		for(int s = 0; s < steps; s++)
+		{
+			arr[0+s*2] *= 1/zeta;
+		}
 
-		if( is_odd(S) )
+		for(int s = 0; s < steps; s++)
 		{
-			// epilog2: export(3)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 3);
+			arr[1+s*2] *= zeta;
+		}
+	}
+}
 
-			// epilog2: pass-epilog-full
-			op4s_sdl6_pass_inv_epilog_full_s_sse(w, v, l, r, z, in, out, &addr);
+/**
+ * @brief One iteration of two-step double-loop algorithm.
+ *
+ * Loads one pair of coefficients, performs the predict step on it and the
+ * update step on the pair one position to the left, which is then stored.
+ * The values passed from iteration to iteration are kept in @p l.
+ */
+static
+void op2s_dl_pass_s_ref(const float *w, const float *v, float *l, float *restrict addr, int scaling)
+{
+	// inputs
+	float in0 = addr[2];
+	float in1 = addr[3];
 
-			// epilog2: export(2)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 2);
+	// descales
+	if( scaling < 0 )
+	{
+		in0 *= v[0];
+		in1 *= v[1];
+	}
 
-			// epilog2: pass-epilog-light
-			op4s_sdl6_pass_inv_epilog_light_s_sse(w, v, l, r, z, in, out, &addr);
+	// operation: predict of the loaded pair, update of the stored one
+	const float r0 = in0 + w[1] * (l[1] + in1);
+	float out0 = l[0];
+	float out1 = l[1] + w[0] * (l[0] + r0);
 
-			// epilog2: export(1)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 1);
+	// scales
+	if( scaling > 0 )
+	{
+		out0 *= v[0];
+		out1 *= v[1];
+	}
 
-			// epilog2: pass-epilog-full
-			op4s_sdl6_pass_inv_epilog_full_s_sse(w, v, l, r, z, in, out, &addr);
+	// outputs
+	addr[0] = out0;
+	addr[1] = out1;
 
-			// epilog2: export(0)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 0);
-		}
-		else
+	// update l[]
+	l[0] = r0;
+	l[1] = in1;
+}
+
+/**
+ * @brief Double-loop algorithm with two lifting steps.
+ *
+ * Both lifting steps are performed in one loop over the signal. This
+ * function processes 2 coefficients (even + odd) per one iteration.
+ */
+static
+void accel_lift_op2s_main_dl_s(
+	float *restrict arr,
+	int steps,
+	float alpha,
+	float beta,
+	float zeta,
+	int scaling)
+{
+	assert( steps >= 0 );
+
+	const float w[2] = { beta, alpha };
+	const float v[2] = { 1/zeta, zeta };
+
+	// slide in left border
+	float l[2] = { arr[0], arr[1] };
+
+	for(int s = 0; s < steps; s++)
+		op2s_dl_pass_s_ref(w, v, l, arr+2*s, scaling);
+
+	// slide out right border
+	arr[2*steps+0] = l[0];
+	arr[2*steps+1] = l[1];
+}
+
+/**
+ * @brief Shifted double-loop algorithm with two lifting steps.
+ *
+ * This function processes 8 coefficients (4 even + 4 odd) per one
+ * iteration. The loaded coefficients are split into even and odd ones, the
+ * predict step is performed on the even ones and the update step on the
+ * odd ones shifted by one position to the left. The shift makes the
+ * update independent of the last predicted coefficient, which is passed to
+ * the next iteration along with the last odd one. Reference implementation
+ * of accel_lift_op2s_main_sdl_sse_s.
+ */
+static
+void accel_lift_op2s_main_sdl_ref_s(
+	float *restrict arr,
+	int steps,
+	float alpha,
+	float beta,
+	float zeta,
+	int scaling)
+{
+	assert( steps >= 0 );
+
+	const float w[2] = { beta, alpha };
+	const float v[2] = { 1/zeta, zeta };
+
+	// slide in left border
+	float l[2] = { arr[0], arr[1] };
+
+	int s = 0;
+
+	for(; s+4 <= steps; s += 4)
+	{
+		float *restrict addr = arr+2*s;
+
+		float e[4], o[4], el[4], ol[4];
+
+		// load + split
+		for(int k = 0; k < 4; k++)
 		{
-			// epilog2: export(3)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 3);
+			e[k] = addr[2+2*k];
+			o[k] = addr[3+2*k];
+		}
 
-			// epilog2: pass-epilog-light
-			op4s_sdl6_pass_inv_epilog_light_s_sse(w, v, l, r, z, in, out, &addr);
+		// descale
+		if( scaling < 0 )
+		{
+			for(int k = 0; k < 4; k++)
+			{
+				e[k] *= v[0];
+				o[k] *= v[1];
+			}
+		}
 
-			// epilog2: export(2)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 2);
+		// shift odd coefficients
+		ol[0] = l[1];
+		for(int k = 1; k < 4; k++)
+			ol[k] = o[k-1];
 
-			// epilog2: pass-epilog-full
-			op4s_sdl6_pass_inv_epilog_full_s_sse(w, v, l, r, z, in, out, &addr);
+		// predict
+		for(int k = 0; k < 4; k++)
+			e[k] += w[1] * (ol[k] + o[k]);
 
-			// epilog2: export(1)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 1);
+		// shift even coefficients
+		el[0] = l[0];
+		for(int k = 1; k < 4; k++)
+			el[k] = e[k-1];
 
-			// epilog2: pass-epilog-flush
-			op4s_sdl6_pass_inv_epilog_flush_s_sse(w, v, l, r, z, in, out, &addr);
+		// update
+		for(int k = 0; k < 4; k++)
+			ol[k] += w[0] * (el[k] + e[k]);
 
-			// epilog2: export(0)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 0);
+		// scale
+		if( scaling > 0 )
+		{
+			for(int k = 0; k < 4; k++)
+			{
+				el[k] *= v[0];
+				ol[k] *= v[1];
+			}
+		}
+
+		// merge + save
+		for(int k = 0; k < 4; k++)
+		{
+			addr[0+2*k] = el[k];
+			addr[1+2*k] = ol[k];
 		}
-	}
-	else if ( scaling > 0 )
-	{
-		// ****** forward transform ******
 
-		// FIXME(ASVP): support for several workers
-		assert( 1 == dwt_util_get_num_workers() );
+		l[0] = e[3];
+		l[1] = o[3];
+	}
 
-		// *** init ***
+	for(; s < steps; s++)
+		op2s_dl_pass_s_ref(w, v, l, arr+2*s, scaling);
 
-		float *restrict addr = arr;
+	// slide out right border
+	arr[2*steps+0] = l[0];
+	arr[2*steps+1] = l[1];
+}
 
-		// *** prolog2 ***
+#ifdef __SSE__
+/**
+ * @brief Shifted double-loop algorithm with two lifting steps, SSE
+ * implementation.
+ *
+ * See accel_lift_op2s_main_sdl_ref_s. This function processes 8
+ * coefficients per one iteration.
+ */
+static
+void accel_lift_op2s_main_sdl_sse_s(
+	float *restrict arr,
+	int steps,
+	float alpha,
+	float beta,
+	float zeta,
+	int scaling)
+{
+	assert( steps >= 0 );
 
-		// prolog2: import-preload
-		op4s_sdl6_preload_prolog_s_sse(w, v, l, r, z, in, out, &addr);
+	const float w[2] = { beta, alpha };
+	const float v[2] = { 1/zeta, zeta };
 
-		// prolog2: import(3)
-		op4s_sdl6_import_s_sse(l, 3, out);
+	const __m128 wa = _mm_set1_ps(alpha);
+	const __m128 wb = _mm_set1_ps(beta);
+	const __m128 ve = _mm_set1_ps(v[0]);
+	const __m128 vo = _mm_set1_ps(v[1]);
 
-		// prolog2: pass-prolog-full
-		op4s_sdl6_pass_fwd_prolog_full_s_sse(w, v, l, r, z, in, out, &addr);
+	// slide in left border, only the last elements are used
+	__m128 le = _mm_set1_ps(arr[0]);
+	__m128 lo = _mm_set1_ps(arr[1]);
 
-		// prolog2: import(2)
-		op4s_sdl6_import_s_sse(l, 2, out);
+	int s = 0;
 
-		// prolog2: pass-prolog-light
-		op4s_sdl6_pass_fwd_prolog_light_s_sse(w, v, l, r, z, in, out, &addr);
+	for(; s+4 <= steps; s += 4)
+	{
+		float *restrict addr = arr+2*s;
 
-		// prolog2: import(1)
-		op4s_sdl6_import_s_sse(l, 1, out);
+		// load + split
+		const __m128 x0 = _mm_loadu_ps(addr+2);
+		const __m128 x1 = _mm_loadu_ps(addr+6);
 
-		// prolog2: pass-prolog-full
-		op4s_sdl6_pass_fwd_prolog_full_s_sse(w, v, l, r, z, in, out, &addr);
+		__m128 e = _mm_shuffle_ps(x0, x1, _MM_SHUFFLE(2,0,2,0));
+		__m128 o = _mm_shuffle_ps(x0, x1, _MM_SHUFFLE(3,1,3,1));
 
-		// prolog2: import(0)
-		op4s_sdl6_import_s_sse(l, 0, out);
+		// descale
+		if( scaling < 0 )
+		{
+			e = _mm_mul_ps(e, ve);
+			o = _mm_mul_ps(o, vo);
+		}
 
-		// *** core ***
+		// shift odd coefficients: [ lo3 o0 o1 o2 ]
+		__m128 t = _mm_shuffle_ps(lo, o, _MM_SHUFFLE(0,0,3,3));
+		__m128 ol = _mm_shuffle_ps(t, o, _MM_SHUFFLE(2,1,2,0));
 
-		// core: for u = 0 to U
-		for(int u = 0; u < U; u++)
-		{
-			// NOTE: l, r, z
+		// predict
+		e = _mm_add_ps(e, _mm_mul_ps(wa, _mm_add_ps(ol, o)));
 
-			// core: pass1-core-light
-			op4s_sdl6_pass_fwd_core_light_s_sse(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+		// shift even coefficients: [ le3 e0 e1 e2 ]
+		t = _mm_shuffle_ps(le, e, _MM_SHUFFLE(0,0,3,3));
+		__m128 el = _mm_shuffle_ps(t, e, _MM_SHUFFLE(2,1,2,0));
 
-			// NOTE: z => l, l => r, r => z
+		// update
+		ol = _mm_add_ps(ol, _mm_mul_ps(wb, _mm_add_ps(el, e)));
 
-			// core: pass1-core-full
-			op4s_sdl6_pass_fwd_core_full_s_sse(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+		// scale
+		if( scaling > 0 )
+		{
+			el = _mm_mul_ps(el, ve);
+			ol = _mm_mul_ps(ol, vo);
+		}
 
-			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+		// merge + save
+		_mm_storeu_ps(addr+0, _mm_unpacklo_ps(el, ol));
+		_mm_storeu_ps(addr+4, _mm_unpackhi_ps(el, ol));
 
-			// core: pass2-core-light
-			op4s_sdl6_pass_fwd_core_light_s_sse(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+		le = e;
+		lo = o;
+	}
 
-			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+	float l[2] = {
+		_mm_cvtss_f32(_mm_shuffle_ps(le, le, _MM_SHUFFLE(3,3,3,3))),
+		_mm_cvtss_f32(_mm_shuffle_ps(lo, lo, _MM_SHUFFLE(3,3,3,3)))
+	};
 
-			// core: pass2-core-full
-			op4s_sdl6_pass_fwd_core_full_s_sse(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+	for(; s < steps; s++)
+		op2s_dl_pass_s_ref(w, v, l, arr+2*s, scaling);
 
-			// NOTE: z => l, l => r, r => z
+	// slide out right border
+	arr[2*steps+0] = l[0];
+	arr[2*steps+1] = l[1];
+}
+#endif /* __SSE__ */
 
-			// core: pass3-core-light
-			op4s_sdl6_pass_fwd_core_light_s_sse(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+#ifdef USE_AVX
+/**
+ * @brief Shifted double-loop algorithm with two lifting steps, AVX
+ * implementation.
+ *
+ * See accel_lift_op2s_main_sdl_ref_s. This function processes 16
+ * coefficients per one iteration.
+ */
+static
+TARGET_AVX
+void accel_lift_op2s_main_sdl_avx_s(
+	float *restrict arr,
+	int steps,
+	float alpha,
+	float beta,
+	float zeta,
+	int scaling)
+{
+	assert( steps >= 0 );
 
-			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+	const float w[2] = { beta, alpha };
+	const float v[2] = { 1/zeta, zeta };
 
-			// core: pass3-core-full
-			op4s_sdl6_pass_fwd_core_full_s_sse(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+	const __m256 wa = _mm256_set1_ps(alpha);
+	const __m256 wb = _mm256_set1_ps(beta);
+	const __m256 ve = _mm256_set1_ps(v[0]);
+	const __m256 vo = _mm256_set1_ps(v[1]);
 
-			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
-		}
+	// slide in left border, only the last elements are used
+	__m256 le = _mm256_set1_ps(arr[0]);
+	__m256 lo = _mm256_set1_ps(arr[1]);
 
-		// core: for t = 0 to T do
-		for(int t = 0; t < T; t++)
-		{
-			// core: pass-core-light
-			op4s_sdl6_pass_fwd_postcore_light_s_sse(w, v, l, r, z, in, out, &addr);
+	int s = 0;
 
-			// core: pass-core-full
-			op4s_sdl6_pass_fwd_postcore_full_s_sse(w, v, l, r, z, in, out, &addr);
-		}
+	for(; s+8 <= steps; s += 8)
+	{
+		float *restrict addr = arr+2*s;
 
-		// core: if odd then
-		if( is_odd(S) )
-		{
-			// core: pass-core-light
-			op4s_sdl6_pass_fwd_postcore_light_s_sse(w, v, l, r, z, in, out, &addr);
-		}
+		// load + split
+		const __m256 x0 = _mm256_loadu_ps(addr+2);
+		const __m256 x1 = _mm256_loadu_ps(addr+10);
+		const __m256 y0 = _mm256_permute2f128_ps(x0, x1, 0x20);
+		const __m256 y1 = _mm256_permute2f128_ps(x0, x1, 0x31);
 
-		// *** epilog2 ***
+		__m256 e = _mm256_shuffle_ps(y0, y1, _MM_SHUFFLE(2,0,2,0));
+		__m256 o = _mm256_shuffle_ps(y0, y1, _MM_SHUFFLE(3,1,3,1));
 
-		if( is_odd(S) )
+		// descale
+		if( scaling < 0 )
 		{
-			// epilog2: export(3)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 3);
-
-			// epilog2: pass-epilog-full
-			op4s_sdl6_pass_fwd_epilog_full_s_sse(w, v, l, r, z, in, out, &addr);
+			e = _mm256_mul_ps(e, ve);
+			o = _mm256_mul_ps(o, vo);
+		}
 
-			// epilog2: export(2)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 2);
+		// shift odd coefficients: [ lo7 o0 o1 o2 | o3 o4 o5 o6 ]
+		__m256 t = _mm256_permute2f128_ps(lo, o, 0x21);
+		t = _mm256_shuffle_ps(t, o, _MM_SHUFFLE(0,0,3,3));
+		__m256 ol = _mm256_shuffle_ps(t, o, _MM_SHUFFLE(2,1,2,0));
 
-			// epilog2: pass-epilog-light
-			op4s_sdl6_pass_fwd_epilog_light_s_sse(w, v, l, r, z, in, out, &addr);
+		// predict
+		e = _mm256_add_ps(e, _mm256_mul_ps(wa, _mm256_add_ps(ol, o)));
 
-			// epilog2: export(1)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 1);
+		// shift even coefficients: [ le7 e0 e1 e2 | e3 e4 e5 e6 ]
+		t = _mm256_permute2f128_ps(le, e, 0x21);
+		t = _mm256_shuffle_ps(t, e, _MM_SHUFFLE(0,0,3,3));
+		__m256 el = _mm256_shuffle_ps(t, e, _MM_SHUFFLE(2,1,2,0));
 
-			// epilog2: pass-epilog-full
-			op4s_sdl6_pass_fwd_epilog_full_s_sse(w, v, l, r, z, in, out, &addr);
+		// update
+		ol = _mm256_add_ps(ol, _mm256_mul_ps(wb, _mm256_add_ps(el, e)));
 
-			// epilog2: export(0)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 0);
-		}
-		else
+		// scale
+		if( scaling > 0 )
 		{
-			// epilog2: export(3)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 3);
+			el = _mm256_mul_ps(el, ve);
+			ol = _mm256_mul_ps(ol, vo);
+		}
 
-			// epilog2: pass-epilog-light
-			op4s_sdl6_pass_fwd_epilog_light_s_sse(w, v, l, r, z, in, out, &addr);
+		// merge + save
+		const __m256 z0 = _mm256_unpacklo_ps(el, ol);
+		const __m256 z1 = _mm256_unpackhi_ps(el, ol);
 
-			// epilog2: export(2)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 2);
+		_mm256_storeu_ps(addr+0, _mm256_permute2f128_ps(z0, z1, 0x20));
+		_mm256_storeu_ps(addr+8, _mm256_permute2f128_ps(z0, z1, 0x31));
 
-			// epilog2: pass-epilog-full
-			op4s_sdl6_pass_fwd_epilog_full_s_sse(w, v, l, r, z, in, out, &addr);
+		le = e;
+		lo = o;
+	}
 
-			// epilog2: export(1)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 1);
+	const __m128 leh = _mm256_extractf128_ps(le, 1);
+	const __m128 loh = _mm256_extractf128_ps(lo, 1);
 
-			// epilog2: pass-epilog-flush
-			op4s_sdl6_pass_fwd_epilog_flush_s_sse(w, v, l, r, z, in, out, &addr);
+	float l[2] = {
+		_mm_cvtss_f32(_mm_shuffle_ps(leh, leh, _MM_SHUFFLE(3,3,3,3))),
+		_mm_cvtss_f32(_mm_shuffle_ps(loh, loh, _MM_SHUFFLE(3,3,3,3)))
+	};
 
-			// epilog2: export(0)
-			op4s_sdl6_export_s_sse(l, &arr[2*steps], 0);
-		}
-	}
-	else
-	{
-		// ****** transform w/o scaling ******
+	for(; s < steps; s++)
+		op2s_dl_pass_s_ref(w, v, l, arr+2*s, scaling);
 
-		// not implemented yet
-		dwt_util_abort();
-	}
+	// slide out right border
+	arr[2*steps+0] = l[0];
+	arr[2*steps+1] = l[1];
 }
-#endif /* __SSE__ */
+#endif /* USE_AVX */
 
 /**
- * @brief Shifted Double-Loop implementation of lifting scheme with 6
- * iterations merger.
+ * @brief Prolog of the lifting with two lifting steps.
  *
- * i.e. 12 = (6)*(2) = (2*3)*(2) coefficients per one iteration.
+ * The first lifting step is applied on coefficients of parity @p off.
  */
 static
-void accel_lift_op4s_main_sdl6_ref_s(
-	float *restrict arr,
-	int steps,
+void accel_lift_op2s_prolog_s(
+	float *arr,
+	int off,
+	int N,
 	float alpha,
 	float beta,
-	float gamma,
-	float delta,
 	float zeta,
 	int scaling)
 {
-	// 6+ coeffs implies 3+ steps
-	assert( steps >= 3 );
+	assert( N-off >= 2 );
 
-	assert( is_aligned_16(arr) );
+#ifdef NDEBUG
+	UNUSED(N);
+#endif
 
-	const float w[4] = { delta, gamma, beta, alpha };
-	const float v[4] = { 1/zeta, zeta, 1/zeta, zeta };
-	float l[4];
-	float r[4];
-	float z[4];
-	float in[4];
-	float out[4];
+	if(off)
+	{
+		// inv-scaling
+		if( scaling < 0 )
+		{
+			arr[0] *= zeta;
+			arr[1] *= 1/zeta;
+			arr[2] *= zeta;
+		}
 
-	const int S = steps-3;
-	const int U = S / 6;
-	const int M = S % 6;
-	const int T = M >> 1;
+		// alpha
+		arr[1] += alpha*(arr[0]+arr[2]);
 
-	if( scaling < 0 )
+		// beta
+		arr[0] += 2*beta*(arr[1]);
+
+		// scaling
+		if( scaling > 0 )
+		{
+			arr[0] *= zeta;
+		}
+	}
+	else
 	{
-		// ****** inverse transform ******
+		// inv-scaling
+		if( scaling < 0 )
+		{
+			arr[0] *= 1/zeta;
+			arr[1] *= zeta;
+		}
 
-		// FIXME(ASVP): support for several workers
-		assert( 1 == dwt_util_get_num_workers() );
+		// alpha
+		arr[0] += 2*alpha*(arr[1]);
 
-		// *** init ***
+		// beta
+		// none
 
-		float *restrict addr = arr;
+		// scaling
+		// none
+	}
+}
 
-		// *** prolog2 ***
+/**
+ * @brief Epilog of the lifting with two lifting steps.
+ */
+static
+void accel_lift_op2s_epilog_s(
+	float *arr,
+	int off,
+	int N,
+	float alpha,
+	float beta,
+	float zeta,
+	int scaling)
+{
+	assert( N-off >= 2 );
 
-		// prolog2: import-preload
-		op4s_sdl6_preload_prolog_s_ref(w, v, l, r, z, in, out, &addr);
+	if( is_even(N-off) )
+	{
+		// inv-scaling
+		// none
 
-		// prolog2: import(3)
-		op4s_sdl6_import_s_ref(l, 3, out);
+		// alpha
+		// none
 
-		// prolog2: pass-prolog-full
-		op4s_sdl6_pass_inv_prolog_full_s_ref(w, v, l, r, z, in, out, &addr);
+		// beta
+		arr[N-1] += 2*beta*(arr[N-2]);
 
-		// prolog2: import(2)
-		op4s_sdl6_import_s_ref(l, 2, out);
+		// scaling
+		if( scaling > 0 )
+		{
+			arr[N-2] *= 1/zeta;
+			arr[N-1] *= zeta;
+		}
+	}
+	else /* is_odd(N-off) */
+	{
+		// inv-scaling
+		if( scaling < 0 )
+		{
+			arr[N-1] *= 1/zeta;
+		}
 
-		// prolog2: pass-prolog-light
-		op4s_sdl6_pass_inv_prolog_light_s_ref(w, v, l, r, z, in, out, &addr);
+		// alpha
+		arr[N-1] += 2*alpha*(arr[N-2]);
 
-		// prolog2: import(1)
-		op4s_sdl6_import_s_ref(l, 1, out);
+		// beta
+		arr[N-2] += beta*(arr[N-1]+arr[N-3]);
 
-		// prolog2: pass-prolog-full
-		op4s_sdl6_pass_inv_prolog_full_s_ref(w, v, l, r, z, in, out, &addr);
+		// scaling
+		if( scaling > 0 )
+		{
+			arr[N-3] *= 1/zeta;
+			arr[N-2] *= zeta;
+			arr[N-1] *= 1/zeta;
+		}
+	}
+}
 
-		// prolog2: import(0)
-		op4s_sdl6_import_s_ref(l, 0, out);
+/**
+ * @brief Prolog and epilog for N-off < 2.
+ */
+static
+void accel_lift_op2s_short_s(
+	float *arr,
+	int off,
+	int N,
+	float alpha,
+	float beta,
+	float zeta,
+	int scaling)
+{
+	assert( 1 == off && 2 == N );
 
-		// *** core ***
+	UNUSED(off);
+	UNUSED(N);
 
-		// core: for u = 0 to U
-		for(int u = 0; u < U; u++)
-		{
-			// NOTE: l, r, z
+	// inv-scaling
+	if( scaling < 0 )
+	{
+		arr[0] *= zeta;
+		arr[1] *= 1/zeta;
+	}
 
-			// core: pass1-core-light
-			op4s_sdl6_pass_inv_core_light_s_ref(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+	// alpha
+	arr[1] += 2*alpha*(arr[0]);
 
-			// NOTE: z => l, l => r, r => z
+	// beta
+	arr[0] += 2*beta*(arr[1]);
 
-			// core: pass1-core-full
-			op4s_sdl6_pass_inv_core_full_s_ref(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+	// scaling
+	if( scaling > 0 )
+	{
+		arr[0] *= zeta;
+		arr[1] *= 1/zeta;
+	}
+}
 
-			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+/**
+ * @brief Lifting with two lifting steps using the selected acceleration.
+ *
+ * Counterpart of accel_lift_op4s_s for wavelets with one pair of lifting
+ * steps (predict and update). The block-acceleration (BCE) is not
+ * available for this scheme, the multi-loop algorithm is used instead.
+ */
+static
+void accel_lift_op2s_s(
+	float *restrict arr,
+	int off,
+	int len,
+	float alpha,
+	float beta,
+	float zeta,
+	int scaling)
+{
+	assert( len >= 2 );
+	assert( 0 == off || 1 == off );
 
-			// core: pass2-core-light
-			op4s_sdl6_pass_inv_core_light_s_ref(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+	if( len-off < 2 )
+	{
+		accel_lift_op2s_short_s(arr, off, len, alpha, beta, zeta, scaling);
+	}
+	else
+	{
+		accel_lift_op2s_prolog_s(arr, off, len, alpha, beta, zeta, scaling);
 
-			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+		const struct accel_kernels *accel = get_accel();
+		const int steps = (to_even(len-off)-2)/2;
 
-			// core: pass2-core-full
-			op4s_sdl6_pass_inv_core_full_s_ref(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+		if( NULL != accel->main_op2s_s )
+			accel->main_op2s_s(arr+off, steps, alpha, beta, zeta, scaling);
+		else
+			accel_lift_op2s_main_s(arr+off, steps, alpha, beta, zeta, scaling);
 
-			// NOTE: z => l, l => r, r => z
+		accel_lift_op2s_epilog_s(arr, off, len, alpha, beta, zeta, scaling);
+	}
+}
 
-			// core: pass3-core-light
-			op4s_sdl6_pass_inv_core_light_s_ref(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+void dwt_cdf97_f_ex_stride_s(
+	const float *src,
+	float *dst_l,
+	float *dst_h,
+	float *tmp,
+	int N,
+	int stride)
+{
+	assert( N >= 0 && NULL != src && NULL != dst_l && NULL != dst_h && NULL != tmp && 0 != stride );
 
-			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+	// fix for small N
+	if(N < 2)
+	{
+		if(1 == N)
+			dst_l[0] = src[0] * dwt_cdf97_s1_s;
+		return;
+	}
 
-			// core: pass3-core-full
-			op4s_sdl6_pass_inv_core_full_s_ref(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+	// copy src into tmp
+	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+	{
+		float *tmp_local = calc_temp_offset_s(tmp, w);
+		const float *src_local = calc_data_offset_const_s(src, w);
 
-			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+		if( is_valid_data_step_s( src_local ) )
+		{
+			dwt_util_memcpy_stride_s(tmp_local, sizeof(float), src_local, stride, N);
 		}
+	}
 
-		// core: for t = 0 to T do
-		for(int t = 0; t < T; t++)
-		{
-			// core: pass-core-light
-			op4s_sdl6_pass_inv_postcore_light_s_ref(w, v, l, r, z, in, out, &addr);
+	accel_lift_op4s_s(tmp, 1, N, -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s, dwt_cdf97_s1_s, +1);
 
-			// core: pass-core-full
-			op4s_sdl6_pass_inv_postcore_full_s_ref(w, v, l, r, z, in, out, &addr);
-		}
+	// copy tmp into dst
+	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+	{
+		float *tmp_local = calc_temp_offset_s(tmp, w);
+		float *dst_l_local = calc_data_offset_s(dst_l, w);
+		float *dst_h_local = calc_data_offset_s(dst_h, w);
 
-		// core: if odd then
-		if( is_odd(S) )
+		if( is_valid_data_step_s( dst_l_local ) )
 		{
-			// core: pass-core-light
-			op4s_sdl6_pass_inv_postcore_light_s_ref(w, v, l, r, z, in, out, &addr);
+			dwt_util_split_s(dst_l_local, dst_h_local, stride, tmp_local, N, 1.f, 1.f);
 		}
+	}
+}
 
-		// *** epilog2 ***
+/**
+ * @brief Forward transform of a group of @p count rows (or columns) at once.
+ *
+ * The k-th signal starts @p k * @p group_stride bytes after @p dst_l and
+ * @p dst_h, and @p k * @p src_group_stride bytes after @p src. Its temporary
+ * copy is placed @p k * @p tmp_dist floats after @p tmp.
+ */
+static
+void dwt_cdf97_f_ex_stride_group_s(
+	const float *src,
+	float *dst_l,
+	float *dst_h,
+	float *tmp,
+	int tmp_dist,
+	int N,
+	int stride,
+	int count,
+	int group_stride,
+	int src_group_stride)
+{
+	assert( N >= 0 && NULL != src && NULL != dst_l && NULL != dst_h && NULL != tmp && 0 != stride && count > 0 );
 
-		if( is_odd(S) )
-		{
-			// epilog2: export(3)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 3);
+	if( 1 == count || N < 2 )
+	{
+		for(int k = 0; k < count; k++)
+			dwt_cdf97_f_ex_stride_s(
+				addr1_const_s(src, k, src_group_stride),
+				addr1_s(dst_l, k, group_stride),
+				addr1_s(dst_h, k, group_stride),
+				tmp,
+				N,
+				stride);
+		return;
+	}
 
-			// epilog2: pass-epilog-full
-			op4s_sdl6_pass_inv_epilog_full_s_ref(w, v, l, r, z, in, out, &addr);
+	// copy src into tmp
+	for(int k = 0; k < count; k++)
+		dwt_util_memcpy_stride_s(tmp+k*tmp_dist, sizeof(float), addr1_const_s(src, k, src_group_stride), stride, N);
 
-			// epilog2: export(2)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 2);
+	accel_lift_op4s_group_s(tmp, tmp_dist, count, 1, N, -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s, dwt_cdf97_s1_s, +1);
 
-			// epilog2: pass-epilog-light
-			op4s_sdl6_pass_inv_epilog_light_s_ref(w, v, l, r, z, in, out, &addr);
+	// copy tmp into dst
+	for(int k = 0; k < count; k++)
+		dwt_util_split_s(addr1_s(dst_l, k, group_stride), addr1_s(dst_h, k, group_stride), stride, tmp+k*tmp_dist, N, 1.f, 1.f);
+}
 
-			// epilog2: export(1)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 1);
+/**
+ * @brief Forward transform of @p cols adjacent columns at once.
+ *
+ * Unlike dwt_cdf97_f_ex_stride_s, samples of all columns are gathered row
+ * by row into @p tmp (@p N rows of @p cols floats), so each cache line of
+ * the image is fully used. Adjacent columns have to be stored contiguously.
+ */
+static
+void dwt_cdf97_f_ex_stride_cols_s(
+	const float *src,
+	float *dst_l,
+	float *dst_h,
+	float *tmp,
+	int N,
+	int stride,
+	int cols)
+{
+	assert( N >= 2 && NULL != src && NULL != dst_l && NULL != dst_h && NULL != tmp && 0 != stride && cols > 0 );
 
-			// epilog2: pass-epilog-full
-			op4s_sdl6_pass_inv_epilog_full_s_ref(w, v, l, r, z, in, out, &addr);
+	// copy src into tmp
+	for(int y = 0; y < N; y++)
+		memcpy(tmp+y*cols, addr1_const_s(src, y, stride), cols*sizeof(float));
 
-			// epilog2: export(0)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 0);
-		}
-		else
-		{
-			// epilog2: export(3)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 3);
+	accel_lift_op4s_cols_s(tmp, N, cols, cols*sizeof(float), -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s, dwt_cdf97_s1_s, +1);
 
-			// epilog2: pass-epilog-light
-			op4s_sdl6_pass_inv_epilog_light_s_ref(w, v, l, r, z, in, out, &addr);
+	// copy tmp into dst
+	for(int y = 0; y < ceil_div2(N); y++)
+		memcpy(addr1_s(dst_l, y, stride), tmp+(2*y+0)*cols, cols*sizeof(float));
+	for(int y = 0; y < floor_div2(N); y++)
+		memcpy(addr1_s(dst_h, y, stride), tmp+(2*y+1)*cols, cols*sizeof(float));
+}
 
-			// epilog2: export(2)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 2);
+/**
+ * @brief Forward transform of @p cols adjacent columns lifted in place on whole rows.
+ *
+ * The lifting steps are applied directly on @p N image rows @p stride bytes
+ * apart. Afterwards, the even rows are moved to the top of @p ptr and the odd
+ * rows (staged in @p tmp of floor(N/2) rows of @p cols floats) to @p dst_h.
+ */
+static
+void dwt_cdf97_f_ex_rows_s(
+	float *ptr,
+	float *dst_h,
+	float *tmp,
+	int N,
+	int stride,
+	int cols)
+{
+	assert( N >= 2 && NULL != ptr && NULL != dst_h && NULL != tmp && 0 != stride && cols > 0 );
 
-			// epilog2: pass-epilog-full
-			op4s_sdl6_pass_inv_epilog_full_s_ref(w, v, l, r, z, in, out, &addr);
+	accel_lift_op4s_cols_s(ptr, N, cols, stride, -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s, dwt_cdf97_s1_s, +1);
 
-			// epilog2: export(1)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 1);
+	// odd rows into tmp
+	for(int y = 0; y < floor_div2(N); y++)
+		memcpy(tmp+y*cols, addr1_const_s(ptr, 2*y+1, stride), cols*sizeof(float));
+	// even rows upwards
+	for(int y = 1; y < ceil_div2(N); y++)
+		memcpy(addr1_s(ptr, y, stride), addr1_const_s(ptr, 2*y, stride), cols*sizeof(float));
+	// tmp into dst_h
+	for(int y = 0; y < floor_div2(N); y++)
+		memcpy(addr1_s(dst_h, y, stride), tmp+y*cols, cols*sizeof(float));
+}
 
-			// epilog2: pass-epilog-flush
-			op4s_sdl6_pass_inv_epilog_flush_s_ref(w, v, l, r, z, in, out, &addr);
+/**
+ * @brief Forward transform of @p count short signals at once.
+ *
+ * The k-th signal starts @p k * @p group_stride bytes after @p dst_l and
+ * @p dst_h, and @p k * @p src_group_stride bytes after @p src, its samples
+ * are @p stride bytes apart. The signals are transposed into @p tmp (@p N
+ * rows of @p count floats) and lifted with vector lanes mapped across the
+ * signals.
+ */
+static
+void dwt_cdf97_f_ex_stride_short_s(
+	const float *src,
+	float *dst_l,
+	float *dst_h,
+	float *tmp,
+	int N,
+	int stride,
+	int count,
+	int group_stride,
+	int src_group_stride)
+{
+	assert( N >= 2 && NULL != src && NULL != dst_l && NULL != dst_h && NULL != tmp && 0 != stride && count > 0 );
 
-			// epilog2: export(0)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 0);
-		}
-	}
-	else if ( scaling > 0 )
+	// copy src into tmp
+	for(int k = 0; k < count; k++)
 	{
-		// ****** forward transform ******
+		const float *src_k = addr1_const_s(src, k, src_group_stride);
 
-		// FIXME(ASVP): support for several workers
-		assert( 1 == dwt_util_get_num_workers() );
+		for(int i = 0; i < N; i++)
+			tmp[i*count+k] = *addr1_const_s(src_k, i, stride);
+	}
 
-		// *** init ***
+	accel_lift_op4s_cols_s(tmp, N, count, count*sizeof(float), -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s, dwt_cdf97_s1_s, +1);
 
-		float *restrict addr = arr;
+	// copy tmp into dst
+	for(int k = 0; k < count; k++)
+	{
+		float *dst_l_k = addr1_s(dst_l, k, group_stride);
+		float *dst_h_k = addr1_s(dst_h, k, group_stride);
 
-		// *** prolog2 ***
+		for(int i = 0; i < ceil_div2(N); i++)
+			*addr1_s(dst_l_k, i, stride) = tmp[(2*i+0)*count+k];
+		for(int i = 0; i < floor_div2(N); i++)
+			*addr1_s(dst_h_k, i, stride) = tmp[(2*i+1)*count+k];
+	}
+}
 
-		// prolog2: import-preload
-		op4s_sdl6_preload_prolog_s_ref(w, v, l, r, z, in, out, &addr);
+void dwt_cdf53_f_ex_stride_s(
+	const float *src,
+	float *dst_l,
+	float *dst_h,
+	float *tmp,
+	int N,
+	int stride)
+{
+	assert( N >= 0 && NULL != src && NULL != dst_l && NULL != dst_h && NULL != tmp && 0 != stride );
 
-		// prolog2: import(3)
-		op4s_sdl6_import_s_ref(l, 3, out);
+	// fix for small N
+	if(N < 2)
+	{
+		if(1 == N)
+			dst_l[0] = src[0] * dwt_cdf53_s1_s;
+		return;
+	}
 
-		// prolog2: pass-prolog-full
-		op4s_sdl6_pass_fwd_prolog_full_s_ref(w, v, l, r, z, in, out, &addr);
+	// copy src into tmp
+	dwt_util_memcpy_stride_s(tmp, sizeof(float), src, stride, N);
 
-		// prolog2: import(2)
-		op4s_sdl6_import_s_ref(l, 2, out);
+	accel_lift_op2s_s(tmp, 1, N, -dwt_cdf53_p1_s, dwt_cdf53_u1_s, dwt_cdf53_s1_s, +1);
 
-		// prolog2: pass-prolog-light
-		op4s_sdl6_pass_fwd_prolog_light_s_ref(w, v, l, r, z, in, out, &addr);
+	// copy tmp into dst
+	dwt_util_split_s(dst_l, dst_h, stride, tmp, N, 1.f, 1.f);
+}
 
-		// prolog2: import(1)
-		op4s_sdl6_import_s_ref(l, 1, out);
+void dwt_cdf97_i_ex_d(
+	const double *src_l,
+	const double *src_h,
+	double *dst,
+	double *tmp,
+	int N)
+{
+	dwt_cdf97_i_ex_stride_d(
+		src_l,
+		src_h,
+		dst,
+		tmp,
+		N,
+		sizeof(double)
+	);
+}
 
-		// prolog2: pass-prolog-full
-		op4s_sdl6_pass_fwd_prolog_full_s_ref(w, v, l, r, z, in, out, &addr);
+void dwt_cdf53_i_ex_d(
+	const double *src_l,
+	const double *src_h,
+	double *dst,
+	double *tmp,
+	int N)
+{
+	dwt_cdf53_i_ex_stride_d(
+		src_l,
+		src_h,
+		dst,
+		tmp,
+		N,
+		sizeof(double)
+	);
+}
 
-		// prolog2: import(0)
-		op4s_sdl6_import_s_ref(l, 0, out);
+void dwt_cdf97_i_ex_s(
+	const float *src_l,
+	const float *src_h,
+	float *dst,
+	float *tmp,
+	int N)
+{
+	dwt_cdf97_i_ex_stride_s(
+		src_l,
+		src_h,
+		dst,
+		tmp,
+		N,
+		sizeof(float)
+	);
+}
 
-		// *** core ***
+void dwt_cdf53_i_ex_s(
+	const float *src_l,
+	const float *src_h,
+	float *dst,
+	float *tmp,
+	int N)
+{
+	dwt_cdf53_i_ex_stride_s(
+		src_l,
+		src_h,
+		dst,
+		tmp,
+		N,
+		sizeof(float)
+	);
+}
 
-		// core: for u = 0 to U
-		for(int u = 0; u < U; u++)
-		{
-			// NOTE: l, r, z
+void dwt_cdf97_i_ex_stride_d(
+	const double *src_l,
+	const double *src_h,
+	double *dst,
+	double *tmp,
+	int N,
+	int stride)
+{
+	assert( N >= 0 && NULL != src_l && NULL != src_h && NULL != dst && NULL != tmp && 0 != stride );
 
-			// core: pass1-core-light
-			op4s_sdl6_pass_fwd_core_light_s_ref(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+	// fix for small N
+	if(N < 2)
+	{
+		if(1 == N)
+			dst[0] = src_l[0] * dwt_cdf97_s2_d;
+		return;
+	}
 
-			// NOTE: z => l, l => r, r => z
+	// copy src into tmp
+	dwt_util_memcpy_stride_d(tmp+0, 2*sizeof(double), src_l, stride,  ceil_div2(N));
+	dwt_util_memcpy_stride_d(tmp+1, 2*sizeof(double), src_h, stride, floor_div2(N));
 
-			// core: pass1-core-full
-			op4s_sdl6_pass_fwd_core_full_s_ref(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+	accel_lift_op4s_d(tmp, 0, N, -dwt_cdf97_u2_d, dwt_cdf97_p2_d, -dwt_cdf97_u1_d, dwt_cdf97_p1_d, dwt_cdf97_s1_d, -1);
 
-			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+	// copy tmp into dst
+	dwt_util_memcpy_stride_d(dst, stride, tmp, sizeof(double), N);
+}
 
-			// core: pass2-core-light
-			op4s_sdl6_pass_fwd_core_light_s_ref(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+void dwt_cdf53_i_ex_stride_d(
+	const double *src_l,
+	const double *src_h,
+	double *dst,
+	double *tmp,
+	int N,
+	int stride)
+{
+	assert( N >= 0 && NULL != src_l && NULL != src_h && NULL != dst && NULL != tmp && 0 != stride );
 
-			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
+	// fix for small N
+	if(N < 2)
+	{
+		if(1 == N)
+			dst[0] = src_l[0] * dwt_cdf53_s2_d;
+		return;
+	}
 
-			// core: pass2-core-full
-			op4s_sdl6_pass_fwd_core_full_s_ref(w, v, /*l*/l, /*r*/r, /*z*/z, in, out, &addr);
+	// copy src into tmp
+	dwt_util_memcpy_stride_d(tmp+0, 2*sizeof(double), src_l, stride,  ceil_div2(N));
+	dwt_util_memcpy_stride_d(tmp+1, 2*sizeof(double), src_h, stride, floor_div2(N));
 
-			// NOTE: z => l, l => r, r => z
+	accel_lift_op2s_d(tmp, 0, N, -dwt_cdf53_u1_d, dwt_cdf53_p1_d, dwt_cdf53_s1_d, -1);
 
-			// core: pass3-core-light
-			op4s_sdl6_pass_fwd_core_light_s_ref(w, v, /*l*/r, /*r*/z, /*z*/l, in, out, &addr);
+	// copy tmp into dst
+	dwt_util_memcpy_stride_d(dst, stride, tmp, sizeof(double), N);
+}
 
-			// NOTE: (r => z) => l, (z => l) => r, (l => r) => z
+void dwt_cdf97_i_ex_stride_s(
+	const float *src_l,
+	const float *src_h,
+	float *dst,
+	float *tmp,
+	int N,
+	int stride)
+{
+	assert( N >= 0 && NULL != src_l && NULL != src_h && NULL != dst && NULL != tmp && 0 != stride );
 
-			// core: pass3-core-full
-			op4s_sdl6_pass_fwd_core_full_s_ref(w, v, /*l*/z, /*r*/l, /*z*/r, in, out, &addr);
+	// fix for small N
+	if(N < 2)
+	{
+		if(1 == N)
+			dst[0] = src_l[0] * dwt_cdf97_s2_s; // FIXME: 1/zeta
+		return;
+	}
 
-			// NOTE: ((l => r) => z) => l, ((r => z) => l) => r, ((z => l) => r) => z
-		}
+	// copy src into tmp
+	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+	{
+		float *tmp_local = calc_temp_offset_s(tmp, w);
+		const float *src_l_local = calc_data_offset_const_s(src_l, w);
+		const float *src_h_local = calc_data_offset_const_s(src_h, w);
 
-		// core: for t = 0 to T do
-		for(int t = 0; t < T; t++)
+		if( is_valid_data_step_s(src_l_local) )
 		{
-			// core: pass-core-light
-			op4s_sdl6_pass_fwd_postcore_light_s_ref(w, v, l, r, z, in, out, &addr);
-
-			// core: pass-core-full
-			op4s_sdl6_pass_fwd_postcore_full_s_ref(w, v, l, r, z, in, out, &addr);
+			dwt_util_merge_s(tmp_local, src_l_local, src_h_local, stride, N, 1.f, 1.f);
 		}
+	}
 
-		// core: if odd then
-		if( is_odd(S) )
-		{
-			// core: pass-core-light
-			op4s_sdl6_pass_fwd_postcore_light_s_ref(w, v, l, r, z, in, out, &addr);
-		}
+	accel_lift_op4s_s(tmp, 0, N, -dwt_cdf97_u2_s, dwt_cdf97_p2_s, -dwt_cdf97_u1_s, dwt_cdf97_p1_s, dwt_cdf97_s1_s, -1);
 
-		// *** epilog2 ***
+	// copy tmp into dst
+	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+	{
+		float *tmp_local = calc_temp_offset_s(tmp, w);
+		float *dst_local = calc_data_offset_s(dst, w);
 
-		if( is_odd(S) )
+		if( is_valid_data_step_s(dst_local) )
 		{
-			// epilog2: export(3)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 3);
-
-			// epilog2: pass-epilog-full
-			op4s_sdl6_pass_fwd_epilog_full_s_ref(w, v, l, r, z, in, out, &addr);
-
-			// epilog2: export(2)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 2);
-
-			// epilog2: pass-epilog-light
-			op4s_sdl6_pass_fwd_epilog_light_s_ref(w, v, l, r, z, in, out, &addr);
-
-			// epilog2: export(1)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 1);
-
-			// epilog2: pass-epilog-full
-			op4s_sdl6_pass_fwd_epilog_full_s_ref(w, v, l, r, z, in, out, &addr);
-
-			// epilog2: export(0)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 0);
+			dwt_util_memcpy_stride_s(dst_local, stride, tmp_local, sizeof(float), N);
 		}
-		else
-		{
-			// epilog2: export(3)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 3);
-
-			// epilog2: pass-epilog-light
-			op4s_sdl6_pass_fwd_epilog_light_s_ref(w, v, l, r, z, in, out, &addr);
-
-			// epilog2: export(2)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 2);
+	}
+}
 
-			// epilog2: pass-epilog-full
-			op4s_sdl6_pass_fwd_epilog_full_s_ref(w, v, l, r, z, in, out, &addr);
+/**
+ * @brief Inverse transform of a group of @p count rows (or columns) at once.
+ *
+ * The k-th signal starts @p k * @p group_stride bytes after @p src_l,
+ * @p src_h and @p dst. Its temporary copy is placed @p k * @p tmp_dist floats
+ * after @p tmp.
+ */
+static
+void dwt_cdf97_i_ex_stride_group_s(
+	const float *src_l,
+	const float *src_h,
+	float *dst,
+	float *tmp,
+	int tmp_dist,
+	int N,
+	int stride,
+	int count,
+	int group_stride)
+{
+	assert( N >= 0 && NULL != src_l && NULL != src_h && NULL != dst && NULL != tmp && 0 != stride && count > 0 );
 
-			// epilog2: export(1)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 1);
+	if( 1 == count || N < 2 )
+	{
+		for(int k = 0; k < count; k++)
+			dwt_cdf97_i_ex_stride_s(
+				addr1_const_s(src_l, k, group_stride),
+				addr1_const_s(src_h, k, group_stride),
+				addr1_s(dst, k, group_stride),
+				tmp,
+				N,
+				stride);
+		return;
+	}
 
-			// epilog2: pass-epilog-flush
-			op4s_sdl6_pass_fwd_epilog_flush_s_ref(w, v, l, r, z, in, out, &addr);
+	// copy src into tmp
+	for(int k = 0; k < count; k++)
+		dwt_util_merge_s(tmp+k*tmp_dist, addr1_const_s(src_l, k, group_stride), addr1_const_s(src_h, k, group_stride), stride, N, 1.f, 1.f);
 
-			// epilog2: export(0)
-			op4s_sdl6_export_s_ref(l, &arr[2*steps], 0);
-		}
-	}
-	else
-	{
-		// ****** transform w/o scaling ******
+	accel_lift_op4s_group_s(tmp, tmp_dist, count, 0, N, -dwt_cdf97_u2_s, dwt_cdf97_p2_s, -dwt_cdf97_u1_s, dwt_cdf97_p1_s, dwt_cdf97_s1_s, -1);
 
-		// not implemented yet
-		dwt_util_abort();
-	}
+	// copy tmp into dst
+	for(int k = 0; k < count; k++)
+		dwt_util_memcpy_stride_s(addr1_s(dst, k, group_stride), stride, tmp+k*tmp_dist, sizeof(float), N);
 }
 
 /**
- * @brief SDL with 2 iterations merged.
+ * @brief Inverse transform of @p cols adjacent columns at once.
  *
- * i.e. loads and stores 4 = (2)*(2) coefficients in every iteration.
+ * Counterpart of dwt_cdf97_f_ex_stride_cols_s.
  */
 static
-void accel_lift_op4s_main_sdl2_ref_s(
-	float *restrict arr,
-	int steps,
-	float alpha,
-	float beta,
-	float gamma,
-	float delta,
-	float zeta,
-	int scaling)
+void dwt_cdf97_i_ex_stride_cols_s(
+	const float *src_l,
+	const float *src_h,
+	float *dst,
+	float *tmp,
+	int N,
+	int stride,
+	int cols)
 {
-	// 6+ coeffs implies 3+ steps
-	assert( steps >= 3 );
+	assert( N >= 2 && NULL != src_l && NULL != src_h && NULL != dst && NULL != tmp && 0 != stride && cols > 0 );
 
-	assert( is_aligned_16(arr) );
+	// copy src into tmp
+	for(int y = 0; y < ceil_div2(N); y++)
+		memcpy(tmp+(2*y+0)*cols, addr1_const_s(src_l, y, stride), cols*sizeof(float));
+	for(int y = 0; y < floor_div2(N); y++)
+		memcpy(tmp+(2*y+1)*cols, addr1_const_s(src_h, y, stride), cols*sizeof(float));
 
-	const float w[4] = { delta, gamma, beta, alpha };
-	const float v[4] = { 1/zeta, zeta, 1/zeta, zeta };
-	float l[4];
-	float c[4];
-	float r[4];
-	float z[4];
-	float in[4];
-	float out[4];
+	accel_lift_op4s_cols_s(tmp, N, cols, cols*sizeof(float), -dwt_cdf97_u2_s, dwt_cdf97_p2_s, -dwt_cdf97_u1_s, dwt_cdf97_p1_s, dwt_cdf97_s1_s, -1);
 
-	const int S = steps-3;
-	const int T = S >> 1;
+	// copy tmp into dst
+	for(int y = 0; y < N; y++)
+		memcpy(addr1_s(dst, y, stride), tmp+y*cols, cols*sizeof(float));
+}
+
+/**
+ * @brief Transpose @p rows rows of @p cols floats.
+ *
+ * The y-th row of @p src starts @p y * @p src_stride bytes after @p src, the
+ * x-th row of @p dst starts @p x * @p dst_stride bytes after @p dst. The
+ * floats of a row are contiguous. Inner 4x4 blocks are transposed in SSE
+ * registers.
+ */
+static
+void dwt_util_transpose_s(
+	float *dst,
+	int dst_stride,
+	const float *src,
+	int src_stride,
+	int rows,
+	int cols)
+{
+	int y = 0;
 
-	if( scaling < 0 )
+#ifdef __SSE__
+	for(; y+4 <= rows; y += 4)
 	{
-		// ****** inverse transform ******
+		int x = 0;
 
-		// FIXME(ASVP): support for several workers
-		assert( 1 == dwt_util_get_num_workers() );
+		for(; x+4 <= cols; x += 4)
+		{
+			__m128 r0 = _mm_loadu_ps(addr2_const_s(src, y+0, x, src_stride, sizeof(float)));
+			__m128 r1 = _mm_loadu_ps(addr2_const_s(src, y+1, x, src_stride, sizeof(float)));
+			__m128 r2 = _mm_loadu_ps(addr2_const_s(src, y+2, x, src_stride, sizeof(float)));
+			__m128 r3 = _mm_loadu_ps(addr2_const_s(src, y+3, x, src_stride, sizeof(float)));
 
-		// *** init ***
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
 
-		float *restrict addr = arr;
+			_mm_storeu_ps(addr2_s(dst, x+0, y, dst_stride, sizeof(float)), r0);
+			_mm_storeu_ps(addr2_s(dst, x+1, y, dst_stride, sizeof(float)), r1);
+			_mm_storeu_ps(addr2_s(dst, x+2, y, dst_stride, sizeof(float)), r2);
+			_mm_storeu_ps(addr2_s(dst, x+3, y, dst_stride, sizeof(float)), r3);
+		}
 
-		// *** prolog2 ***
+		for(; x < cols; x++)
+			for(int i = 0; i < 4; i++)
+				*addr2_s(dst, x, y+i, dst_stride, sizeof(float)) = *addr2_const_s(src, y+i, x, src_stride, sizeof(float));
+	}
+#endif
 
-		// prolog2: import-preload
-		op4s_sdl2_preload_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+	for(; y < rows; y++)
+		for(int x = 0; x < cols; x++)
+			*addr2_s(dst, x, y, dst_stride, sizeof(float)) = *addr2_const_s(src, y, x, src_stride, sizeof(float));
+}
 
-		// prolog2: import(3)
-		op4s_sdl2_import_s_ref(l, 3, out);
+/**
+ * @brief Forward transform of @p cols adjacent columns transposed into rows.
+ *
+ * The columns are transposed into @p cols temporary signals @p tmp_dist
+ * floats apart, lifted by the horizontal kernels in groups of @p group
+ * signals and transposed back. The even samples are stored into @p dst_l,
+ * the odd ones into @p dst_h, the split is fused into the transposition.
+ */
+static
+void dwt_cdf97_f_ex_stride_transpose_s(
+	const float *src,
+	float *dst_l,
+	float *dst_h,
+	float *tmp,
+	int tmp_dist,
+	int N,
+	int stride,
+	int cols,
+	int group)
+{
+	assert( N >= 2 && NULL != src && NULL != dst_l && NULL != dst_h && NULL != tmp && 0 != stride && cols > 0 );
 
-		// prolog2: pass-prolog-full
-		op4s_sdl2_pass_inv_prolog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+	// columns into rows of tmp
+	dwt_util_transpose_s(tmp, tmp_dist*sizeof(float), src, stride, N, cols);
 
-		// prolog2: import(2)
-		op4s_sdl2_import_s_ref(l, 2, out);
+	for(int k = 0; k < cols; k += group)
+	{
+		const int count = min(group, cols-k);
 
-		// prolog2: pass-prolog-light
-		op4s_sdl2_pass_inv_prolog_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+		if( 1 == count )
+			accel_lift_op4s_s(tmp+k*tmp_dist, 1, N, -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s, dwt_cdf97_s1_s, +1);
+		else
+			accel_lift_op4s_group_s(tmp+k*tmp_dist, tmp_dist, count, 1, N, -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s, dwt_cdf97_s1_s, +1);
+	}
 
-		// prolog2: import(1)
-		op4s_sdl2_import_s_ref(l, 1, out);
+	// rows of tmp into dst_l and dst_h
+	int y = 0;
 
-		// prolog2: pass-prolog-full
-		op4s_sdl2_pass_inv_prolog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+#ifdef __SSE__
+	for(; 2*y+8 <= N; y += 4)
+	{
+		int x = 0;
 
-		// prolog2: import(0)
-		op4s_sdl2_import_s_ref(l, 0, out);
+		for(; x+4 <= cols; x += 4)
+		{
+			__m128 l[4], h[4];
 
-		// *** core ***
+			for(int c = 0; c < 4; c++)
+			{
+				const __m128 a = _mm_loadu_ps(tmp+(x+c)*tmp_dist+2*y+0);
+				const __m128 b = _mm_loadu_ps(tmp+(x+c)*tmp_dist+2*y+4);
 
-		// core: for t = 0 to T do
-		for(int t = 0; t < T; t++)
-		{
-			// core: pass-core-light
-			op4s_sdl2_pass_inv_core_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+				l[c] = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0));
+				h[c] = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3,1,3,1));
+			}
 
-			// core: pass-core-full
-			op4s_sdl2_pass_inv_core_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+			_MM_TRANSPOSE4_PS(l[0], l[1], l[2], l[3]);
+			_MM_TRANSPOSE4_PS(h[0], h[1], h[2], h[3]);
+
+			for(int i = 0; i < 4; i++)
+			{
+				_mm_storeu_ps(addr2_s(dst_l, y+i, x, stride, sizeof(float)), l[i]);
+				_mm_storeu_ps(addr2_s(dst_h, y+i, x, stride, sizeof(float)), h[i]);
+			}
 		}
 
-		// core: if odd then
-		if( is_odd(S) )
+		for(; x < cols; x++)
 		{
-			// core: pass-core-light
-			op4s_sdl2_pass_inv_core_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+			for(int i = 0; i < 4; i++)
+			{
+				*addr2_s(dst_l, y+i, x, stride, sizeof(float)) = tmp[x*tmp_dist+2*(y+i)+0];
+				*addr2_s(dst_h, y+i, x, stride, sizeof(float)) = tmp[x*tmp_dist+2*(y+i)+1];
+			}
 		}
+	}
+#endif
 
-		// *** epilog2 ***
+	for(int i = y; i < ceil_div2(N); i++)
+		for(int x = 0; x < cols; x++)
+			*addr2_s(dst_l, i, x, stride, sizeof(float)) = tmp[x*tmp_dist+2*i+0];
+	for(int i = y; i < floor_div2(N); i++)
+		for(int x = 0; x < cols; x++)
+			*addr2_s(dst_h, i, x, stride, sizeof(float)) = tmp[x*tmp_dist+2*i+1];
+}
 
-		if( is_odd(S) )
-		{
-			// epilog2: export(3)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 3);
+/**
+ * @brief Inverse transform of @p cols adjacent columns transposed into rows.
+ *
+ * Counterpart of dwt_cdf97_f_ex_stride_transpose_s. The merge of @p src_l
+ * and @p src_h is fused into the transposition.
+ */
+static
+void dwt_cdf97_i_ex_stride_transpose_s(
+	const float *src_l,
+	const float *src_h,
+	float *dst,
+	float *tmp,
+	int tmp_dist,
+	int N,
+	int stride,
+	int cols,
+	int group)
+{
+	assert( N >= 2 && NULL != src_l && NULL != src_h && NULL != dst && NULL != tmp && 0 != stride && cols > 0 );
 
-			// epilog2: pass-epilog-full
-			op4s_sdl2_pass_inv_epilog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+	// src_l and src_h into rows of tmp
+	int y = 0;
 
-			// epilog2: export(2)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 2);
+#ifdef __SSE__
+	for(; 2*y+8 <= N; y += 4)
+	{
+		int x = 0;
 
-			// epilog2: pass-epilog-light
-			op4s_sdl2_pass_inv_epilog_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+		for(; x+4 <= cols; x += 4)
+		{
+			__m128 l[4], h[4];
 
-			// epilog2: export(1)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 1);
+			for(int i = 0; i < 4; i++)
+			{
+				l[i] = _mm_loadu_ps(addr2_const_s(src_l, y+i, x, stride, sizeof(float)));
+				h[i] = _mm_loadu_ps(addr2_const_s(src_h, y+i, x, stride, sizeof(float)));
+			}
 
-			// epilog2: pass-epilog-full
-			op4s_sdl2_pass_inv_epilog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+			_MM_TRANSPOSE4_PS(l[0], l[1], l[2], l[3]);
+			_MM_TRANSPOSE4_PS(h[0], h[1], h[2], h[3]);
 
-			// epilog2: export(0)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 0);
+			for(int c = 0; c < 4; c++)
+			{
+				_mm_storeu_ps(tmp+(x+c)*tmp_dist+2*y+0, _mm_unpacklo_ps(l[c], h[c]));
+				_mm_storeu_ps(tmp+(x+c)*tmp_dist+2*y+4, _mm_unpackhi_ps(l[c], h[c]));
+			}
 		}
-		else
+
+		for(; x < cols; x++)
 		{
-			// epilog2: export(3)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 3);
+			for(int i = 0; i < 4; i++)
+			{
+				tmp[x*tmp_dist+2*(y+i)+0] = *addr2_const_s(src_l, y+i, x, stride, sizeof(float));
+				tmp[x*tmp_dist+2*(y+i)+1] = *addr2_const_s(src_h, y+i, x, stride, sizeof(float));
+			}
+		}
+	}
+#endif
 
-			// epilog2: pass-epilog-light
-			op4s_sdl2_pass_inv_epilog_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+	for(int i = y; i < ceil_div2(N); i++)
+		for(int x = 0; x < cols; x++)
+			tmp[x*tmp_dist+2*i+0] = *addr2_const_s(src_l, i, x, stride, sizeof(float));
+	for(int i = y; i < floor_div2(N); i++)
+		for(int x = 0; x < cols; x++)
+			tmp[x*tmp_dist+2*i+1] = *addr2_const_s(src_h, i, x, stride, sizeof(float));
 
-			// epilog2: export(2)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 2);
+	for(int k = 0; k < cols; k += group)
+	{
+		const int count = min(group, cols-k);
 
-			// epilog2: pass-epilog-full
-			op4s_sdl2_pass_inv_epilog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+		if( 1 == count )
+			accel_lift_op4s_s(tmp+k*tmp_dist, 0, N, -dwt_cdf97_u2_s, dwt_cdf97_p2_s, -dwt_cdf97_u1_s, dwt_cdf97_p1_s, dwt_cdf97_s1_s, -1);
+		else
+			accel_lift_op4s_group_s(tmp+k*tmp_dist, tmp_dist, count, 0, N, -dwt_cdf97_u2_s, dwt_cdf97_p2_s, -dwt_cdf97_u1_s, dwt_cdf97_p1_s, dwt_cdf97_s1_s, -1);
+	}
 
-			// epilog2: export(1)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 1);
+	// rows of tmp into columns
+	dwt_util_transpose_s(dst, stride, tmp, tmp_dist*sizeof(float), cols, N);
+}
 
-			// epilog2: pass-epilog-flush
-			op4s_sdl2_pass_inv_epilog_flush_s_ref(w, v, l, c, r, z, in, out, &addr);
+/**
+ * @brief Inverse transform of @p cols adjacent columns lifted in place on whole rows.
+ *
+ * Counterpart of dwt_cdf97_f_ex_rows_s. The rows of @p src_h are staged
+ * in @p tmp, the rows of @p ptr are spread to even rows and the staged rows
+ * are put into odd rows before the lifting.
+ */
+static
+void dwt_cdf97_i_ex_rows_s(
+	float *ptr,
+	const float *src_h,
+	float *tmp,
+	int N,
+	int stride,
+	int cols)
+{
+	assert( N >= 2 && NULL != ptr && NULL != src_h && NULL != tmp && 0 != stride && cols > 0 );
 
-			// epilog2: export(0)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 0);
-		}
+	// src_h into tmp
+	for(int y = 0; y < floor_div2(N); y++)
+		memcpy(tmp+y*cols, addr1_const_s(src_h, y, stride), cols*sizeof(float));
+	// rows downwards into even rows
+	for(int y = ceil_div2(N)-1; y > 0; y--)
+		memcpy(addr1_s(ptr, 2*y, stride), addr1_const_s(ptr, y, stride), cols*sizeof(float));
+	// tmp into odd rows
+	for(int y = 0; y < floor_div2(N); y++)
+		memcpy(addr1_s(ptr, 2*y+1, stride), tmp+y*cols, cols*sizeof(float));
+
+	accel_lift_op4s_cols_s(ptr, N, cols, stride, -dwt_cdf97_u2_s, dwt_cdf97_p2_s, -dwt_cdf97_u1_s, dwt_cdf97_p1_s, dwt_cdf97_s1_s, -1);
+}
+
+/**
+ * @brief Inverse transform of @p count short signals at once.
+ *
+ * Counterpart of dwt_cdf97_f_ex_stride_short_s.
+ */
+static
+void dwt_cdf97_i_ex_stride_short_s(
+	const float *src_l,
+	const float *src_h,
+	float *dst,
+	float *tmp,
+	int N,
+	int stride,
+	int count,
+	int group_stride)
+{
+	assert( N >= 2 && NULL != src_l && NULL != src_h && NULL != dst && NULL != tmp && 0 != stride && count > 0 );
+
+	// copy src into tmp
+	for(int k = 0; k < count; k++)
+	{
+		const float *src_l_k = addr1_const_s(src_l, k, group_stride);
+		const float *src_h_k = addr1_const_s(src_h, k, group_stride);
+
+		for(int i = 0; i < ceil_div2(N); i++)
+			tmp[(2*i+0)*count+k] = *addr1_const_s(src_l_k, i, stride);
+		for(int i = 0; i < floor_div2(N); i++)
+			tmp[(2*i+1)*count+k] = *addr1_const_s(src_h_k, i, stride);
 	}
-	else if ( scaling > 0 )
+
+	accel_lift_op4s_cols_s(tmp, N, count, count*sizeof(float), -dwt_cdf97_u2_s, dwt_cdf97_p2_s, -dwt_cdf97_u1_s, dwt_cdf97_p1_s, dwt_cdf97_s1_s, -1);
+
+	// copy tmp into dst
+	for(int k = 0; k < count; k++)
 	{
-		// ****** forward transform ******
+		float *dst_k = addr1_s(dst, k, group_stride);
 
-		// FIXME(ASVP): support for several workers
-		assert( 1 == dwt_util_get_num_workers() );
+		for(int i = 0; i < N; i++)
+			*addr1_s(dst_k, i, stride) = tmp[i*count+k];
+	}
+}
 
-		// *** init ***
+/**
+ * @brief Forward transform of a group of @p count rows in place without
+ * splitting them into the low-pass and high-pass parts.
+ *
+ * The k-th row starts @p k * @p group_stride bytes after @p ptr, its
+ * temporary copy is placed @p k * @p tmp_dist floats after @p tmp.
+ */
+static
+void dwt_cdf97_f_inter_group_s(
+	float *ptr,
+	float *tmp,
+	int tmp_dist,
+	int N,
+	int stride,
+	int count,
+	int group_stride)
+{
+	assert( N >= 0 && NULL != ptr && NULL != tmp && 0 != stride && count > 0 );
 
-		float *restrict addr = arr;
+	// fix for small N
+	if(N < 2)
+	{
+		if(1 == N)
+			for(int k = 0; k < count; k++)
+				*addr1_s(ptr, k, group_stride) *= dwt_cdf97_s1_s;
+		return;
+	}
 
-		// *** prolog2 ***
+	// copy ptr into tmp
+	for(int k = 0; k < count; k++)
+		dwt_util_memcpy_stride_s(tmp+k*tmp_dist, sizeof(float), addr1_const_s(ptr, k, group_stride), stride, N);
 
-		// prolog2: import-preload
-		op4s_sdl2_preload_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+	if( 1 == count )
+		accel_lift_op4s_s(tmp, 1, N, -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s, dwt_cdf97_s1_s, +1);
+	else
+		accel_lift_op4s_group_s(tmp, tmp_dist, count, 1, N, -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s, dwt_cdf97_s1_s, +1);
 
-		// prolog2: import(3)
-		op4s_sdl2_import_s_ref(l, 3, out);
+	// copy tmp back into ptr
+	for(int k = 0; k < count; k++)
+		dwt_util_memcpy_stride_s(addr1_s(ptr, k, group_stride), stride, tmp+k*tmp_dist, sizeof(float), N);
+}
 
-		// prolog2: pass-prolog-full
-		op4s_sdl2_pass_fwd_prolog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+/**
+ * @brief Inverse transform of a group of @p count interleaved rows in place.
+ *
+ * Counterpart of dwt_cdf97_f_inter_group_s.
+ */
+static
+void dwt_cdf97_i_inter_group_s(
+	float *ptr,
+	float *tmp,
+	int tmp_dist,
+	int N,
+	int stride,
+	int count,
+	int group_stride)
+{
+	assert( N >= 0 && NULL != ptr && NULL != tmp && 0 != stride && count > 0 );
 
-		// prolog2: import(2)
-		op4s_sdl2_import_s_ref(l, 2, out);
+	// fix for small N
+	if(N < 2)
+	{
+		if(1 == N)
+			for(int k = 0; k < count; k++)
+				*addr1_s(ptr, k, group_stride) *= dwt_cdf97_s2_s;
+		return;
+	}
 
-		// prolog2: pass-prolog-light
-		op4s_sdl2_pass_fwd_prolog_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+	// copy ptr into tmp
+	for(int k = 0; k < count; k++)
+		dwt_util_memcpy_stride_s(tmp+k*tmp_dist, sizeof(float), addr1_const_s(ptr, k, group_stride), stride, N);
 
-		// prolog2: import(1)
-		op4s_sdl2_import_s_ref(l, 1, out);
+	if( 1 == count )
+		accel_lift_op4s_s(tmp, 0, N, -dwt_cdf97_u2_s, dwt_cdf97_p2_s, -dwt_cdf97_u1_s, dwt_cdf97_p1_s, dwt_cdf97_s1_s, -1);
+	else
+		accel_lift_op4s_group_s(tmp, tmp_dist, count, 0, N, -dwt_cdf97_u2_s, dwt_cdf97_p2_s, -dwt_cdf97_u1_s, dwt_cdf97_p1_s, dwt_cdf97_s1_s, -1);
 
-		// prolog2: pass-prolog-full
-		op4s_sdl2_pass_fwd_prolog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+	// copy tmp back into ptr
+	for(int k = 0; k < count; k++)
+		dwt_util_memcpy_stride_s(addr1_s(ptr, k, group_stride), stride, tmp+k*tmp_dist, sizeof(float), N);
+}
 
-		// prolog2: import(0)
-		op4s_sdl2_import_s_ref(l, 0, out);
+/**
+ * @brief Forward transform of @p count columns in place without splitting
+ * them into the low-pass and high-pass parts.
+ *
+ * The k-th column starts @p k * @p group_stride bytes after @p ptr, its
+ * samples are @p stride bytes apart. The coefficients stay interleaved at
+ * the positions of the lifting scheme. The columns are gathered row by row
+ * into @p tmp (@p N rows of @p count floats) and scattered back.
+ */
+static
+void dwt_cdf97_f_inter_cols_s(
+	float *ptr,
+	float *tmp,
+	int N,
+	int stride,
+	int count,
+	int group_stride)
+{
+	assert( N >= 0 && NULL != ptr && NULL != tmp && 0 != stride && count > 0 );
 
-		// *** core ***
+	// fix for small N
+	if(N < 2)
+	{
+		if(1 == N)
+			for(int k = 0; k < count; k++)
+				*addr1_s(ptr, k, group_stride) *= dwt_cdf97_s1_s;
+		return;
+	}
 
-		// core: for t = 0 to T do
-		for(int t = 0; t < T; t++)
-		{
-			// core: pass-core-light
-			op4s_sdl2_pass_fwd_core_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+	// copy ptr into tmp
+	for(int i = 0; i < N; i++)
+		dwt_util_memcpy_stride_s(tmp+i*count, sizeof(float), addr1_const_s(ptr, i, stride), group_stride, count);
 
-			// core: pass-core-full
-			op4s_sdl2_pass_fwd_core_full_s_ref(w, v, l, c, r, z, in, out, &addr);
-		}
+	accel_lift_op4s_cols_s(tmp, N, count, count*sizeof(float), -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s, dwt_cdf97_s1_s, +1);
 
-		// core: if odd then
-		if( is_odd(S) )
-		{
-			// core: pass-core-light
-			op4s_sdl2_pass_fwd_core_light_s_ref(w, v, l, c, r, z, in, out, &addr);
-		}
+	// copy tmp back into ptr
+	for(int i = 0; i < N; i++)
+		dwt_util_memcpy_stride_s(addr1_s(ptr, i, stride), group_stride, tmp+i*count, sizeof(float), count);
+}
 
-		// *** epilog2 ***
+/**
+ * @brief Inverse transform of @p count interleaved columns in place.
+ *
+ * Counterpart of dwt_cdf97_f_inter_cols_s.
+ */
+static
+void dwt_cdf97_i_inter_cols_s(
+	float *ptr,
+	float *tmp,
+	int N,
+	int stride,
+	int count,
+	int group_stride)
+{
+	assert( N >= 0 && NULL != ptr && NULL != tmp && 0 != stride && count > 0 );
 
-		if( is_odd(S) )
-		{
-			// epilog2: export(3)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 3);
+	// fix for small N
+	if(N < 2)
+	{
+		if(1 == N)
+			for(int k = 0; k < count; k++)
+				*addr1_s(ptr, k, group_stride) *= dwt_cdf97_s2_s;
+		return;
+	}
 
-			// epilog2: pass-epilog-full
-			op4s_sdl2_pass_fwd_epilog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+	// copy ptr into tmp
+	for(int i = 0; i < N; i++)
+		dwt_util_memcpy_stride_s(tmp+i*count, sizeof(float), addr1_const_s(ptr, i, stride), group_stride, count);
 
-			// epilog2: export(2)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 2);
+	accel_lift_op4s_cols_s(tmp, N, count, count*sizeof(float), -dwt_cdf97_u2_s, dwt_cdf97_p2_s, -dwt_cdf97_u1_s, dwt_cdf97_p1_s, dwt_cdf97_s1_s, -1);
 
-			// epilog2: pass-epilog-light
-			op4s_sdl2_pass_fwd_epilog_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+	// copy tmp back into ptr
+	for(int i = 0; i < N; i++)
+		dwt_util_memcpy_stride_s(addr1_s(ptr, i, stride), group_stride, tmp+i*count, sizeof(float), count);
+}
 
-			// epilog2: export(1)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 1);
+void dwt_cdf53_i_ex_stride_s(
+	const float *src_l,
+	const float *src_h,
+	float *dst,
+	float *tmp,
+	int N,
+	int stride)
+{
+	assert( N >= 0 && NULL != src_l && NULL != src_h && NULL != dst && NULL != tmp && 0 != stride );
 
-			// epilog2: pass-epilog-full
-			op4s_sdl2_pass_fwd_epilog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+	// fix for small N
+	if(N < 2)
+	{
+		if(1 == N)
+			dst[0] = src_l[0] * dwt_cdf53_s2_s;
+		return;
+	}
 
-			// epilog2: export(0)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 0);
-		}
-		else
-		{
-			// epilog2: export(3)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 3);
+	// copy src into tmp
+	dwt_util_merge_s(tmp, src_l, src_h, stride, N, 1.f, 1.f);
 
-			// epilog2: pass-epilog-light
-			op4s_sdl2_pass_fwd_epilog_light_s_ref(w, v, l, c, r, z, in, out, &addr);
+	accel_lift_op2s_s(tmp, 0, N, -dwt_cdf53_u1_s, dwt_cdf53_p1_s, dwt_cdf53_s1_s, -1);
 
-			// epilog2: export(2)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 2);
+	// copy tmp into dst
+	dwt_util_memcpy_stride_s(dst, stride, tmp, sizeof(float), N);
+}
 
-			// epilog2: pass-epilog-full
-			op4s_sdl2_pass_fwd_epilog_full_s_ref(w, v, l, c, r, z, in, out, &addr);
+void dwt_zero_padding_f_d(
+	double *dst_l,
+	double *dst_h,
+	int N,
+	int N_dst_L,
+	int N_dst_H)
+{
+	dwt_zero_padding_f_stride_d(
+		dst_l,
+		dst_h,
+		N,
+		N_dst_L,
+		N_dst_H,
+		sizeof(double)
+	);
+}
 
-			// epilog2: export(1)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 1);
+void dwt_zero_padding_f_s(
+	float *dst_l,
+	float *dst_h,
+	int N,
+	int N_dst_L,
+	int N_dst_H)
+{
+	dwt_zero_padding_f_stride_s(
+		dst_l,
+		dst_h,
+		N,
+		N_dst_L,
+		N_dst_H,
+		sizeof(float)
+	);
+}
 
-			// epilog2: pass-epilog-flush
-			op4s_sdl2_pass_fwd_epilog_flush_s_ref(w, v, l, c, r, z, in, out, &addr);
+void dwt_zero_padding_f_stride_d(
+	double *dst_l,
+	double *dst_h,
+	int N,
+	int N_dst_L,
+	int N_dst_H,
+	int stride)
+{
+	assert( N >= 0 && N_dst_L >= 0 && N_dst_H >= 0 && 0 == ((N_dst_L-N_dst_H)&~1) && NULL != dst_l && NULL != dst_h && 0 != stride ); // FIXME: 0 == ((N_dst_L-N_dst_H)&~1)
 
-			// epilog2: export(0)
-			op4s_sdl2_export_s_ref(l, &arr[2*steps], 0);
-		}
-	}
-	else
+	if(N_dst_L || N_dst_H)
 	{
-		// ****** transform w/o scaling ******
-
-		// not implemented yet
-		dwt_util_abort();
+		dwt_util_zero_stride_d(addr1_d(dst_l,  ceil_div2(N), stride), stride, N_dst_L -  ceil_div2(N));
+		dwt_util_zero_stride_d(addr1_d(dst_h, floor_div2(N), stride), stride, N_dst_H - floor_div2(N));
 	}
 }
 
-#ifdef __SSE__
-static
-void accel_lift_op4s_main_sdl2_sse_s(
-	float *restrict arr,
-	int steps,
-	float alpha,
-	float beta,
-	float gamma,
-	float delta,
-	float zeta,
-	int scaling)
+void dwt_zero_padding_f_stride_s(
+	float *dst_l,
+	float *dst_h,
+	int N,
+	int N_dst_L,
+	int N_dst_H,
+	int stride)
 {
-	// 6+ coeffs implies 3+ steps
-	assert( steps >= 3 );
-
-	assert( is_aligned_16(arr) );
-
-	// FIXME: global variables?
-	const __m128 w = { delta, gamma, beta, alpha };
-	const __m128 v = { 1/zeta, zeta, 1/zeta, zeta };
-	__m128 l;
-	__m128 c;
-	__m128 r;
-	__m128 z;
-	__m128 in;
-	__m128 out;
-
-	const int S = steps-3;
-	const int T = S >> 1;
+	assert( N >= 0 && N_dst_L >= 0 && N_dst_H >= 0 && 0 == ((N_dst_L-N_dst_H)&~1) && NULL != dst_l && NULL != dst_h && 0 != stride ); // FIXME: 0 == ((N_dst_L-N_dst_H)&~1)
 
-	if( scaling < 0 )
+	if(N_dst_L || N_dst_H)
 	{
-		// ****** inverse transform ******
-
-		// FIXME(ASVP): support for several workers
-		assert( 1 == dwt_util_get_num_workers() );
-
-		// *** init ***
+		dwt_util_zero_stride_s(addr1_s(dst_l,  ceil_div2(N), stride), stride, N_dst_L -  ceil_div2(N));
+		dwt_util_zero_stride_s(addr1_s(dst_h, floor_div2(N), stride), stride, N_dst_H - floor_div2(N));
+	}
+}
 
-		float *restrict addr = arr;
+void dwt_zero_padding_i_d(
+	double *dst_l,
+	int N,
+	int N_dst)
+{
+	dwt_zero_padding_i_stride_d(
+		dst_l,
+		N,
+		N_dst,
+		sizeof(double)
+	);
+}
 
-		// *** prolog2 ***
+void dwt_zero_padding_i_s(
+	float *dst_l,
+	int N,
+	int N_dst)
+{
+	dwt_zero_padding_i_stride_s(
+		dst_l,
+		N,
+		N_dst,
+		sizeof(float)
+	);
+}
 
-		// prolog2: import-preload
-		op4s_sdl2_preload_prolog_s_sse(w, v, l, c, r, z, in, out, &addr);
+void dwt_zero_padding_i_stride_d(
+	double *dst_l,
+	int N,
+	int N_dst,
+	int stride)
+{
+	assert( N >= 0 && N_dst >= 0 && NULL != dst_l && 0 != stride );
 
-		// prolog2: import(3)
-		op4s_sdl2_import_s_sse(l, 3, out);
+	dwt_util_zero_stride_d(
+		addr1_d(dst_l, N, stride),
+		stride,
+		N_dst - N);
+}
 
-		// prolog2: pass-prolog-full
-		op4s_sdl2_pass_inv_prolog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+void dwt_zero_padding_i_stride_s(
+	float *dst_l,
+	int N,
+	int N_dst,
+	int stride)
+{
+	assert( N >= 0 && N_dst >= 0 && NULL != dst_l && 0 != stride );
 
-		// prolog2: import(2)
-		op4s_sdl2_import_s_sse(l, 2, out);
+	dwt_util_zero_stride_s(
+		addr1_s(dst_l, N, stride),
+		stride,
+		N_dst - N);
+}
 
-		// prolog2: pass-prolog-light
-		op4s_sdl2_pass_inv_prolog_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+/**
+ * @brief Zero padding of one level of the forward image transform.
+ *
+ * Both the padding of rows and of columns is zeroed in a single sweep over
+ * the rows. The rows lying in the padding of columns are zeroed whole, other
+ * rows only behind their coefficients. Nothing is touched on levels without
+ * padding. An axis whose size is not halved on this level (see
+ * @ref dwt_cdf97_2f_aniso_s) keeps its data in front of the padding.
+ */
+static
+void dwt_zero_padding_2f_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_src_x,
+	int size_o_src_y,
+	int size_o_dst_x,
+	int size_o_dst_y,
+	int size_i_src_x,
+	int size_i_src_y)
+{
+	if( size_o_src_x == size_i_src_x && size_o_src_y == size_i_src_y )
+		return;
 
-		// prolog2: import(1)
-		op4s_sdl2_import_s_sse(l, 1, out);
+	// extents of the low-pass and high-pass data
+	const int lo_x = size_o_dst_x == size_o_src_x ? size_i_src_x :  ceil_div2(size_i_src_x);
+	const int hi_x = size_o_dst_x == size_o_src_x ?            0 : floor_div2(size_i_src_x);
+	const int lo_y = size_o_dst_y == size_o_src_y ? size_i_src_y :  ceil_div2(size_i_src_y);
+	const int hi_y = size_o_dst_y == size_o_src_y ?            0 : floor_div2(size_i_src_y);
 
-		// prolog2: pass-prolog-full
-		op4s_sdl2_pass_inv_prolog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+	#pragma omp for schedule(static)
+	for(int y = 0; y < size_o_src_y; y++)
+	{
+		if( (y >= lo_y && y < size_o_dst_y) || y >= size_o_dst_y + hi_y )
+			dwt_util_zero_stride_d(
+				addr2_d(ptr,y,0,stride_x,stride_y),
+				stride_y,
+				size_o_src_x);
+		else
+		{
+			dwt_util_zero_stride_d(
+				addr2_d(ptr,y,lo_x,stride_x,stride_y),
+				stride_y,
+				size_o_dst_x-lo_x);
+			dwt_util_zero_stride_d(
+				addr2_d(ptr,y,size_o_dst_x+hi_x,stride_x,stride_y),
+				stride_y,
+				size_o_src_x-size_o_dst_x-hi_x);
+		}
+	}
+}
 
-		// prolog2: import(0)
-		op4s_sdl2_import_s_sse(l, 0, out);
+/**
+ * @brief Zero padding of one level of the inverse image transform.
+ *
+ * Counterpart of dwt_zero_padding_2f_d.
+ */
+static
+void dwt_zero_padding_2i_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_dst_x,
+	int size_o_dst_y,
+	int size_i_dst_x,
+	int size_i_dst_y)
+{
+	if( size_o_dst_x == size_i_dst_x && size_o_dst_y == size_i_dst_y )
+		return;
 
-		// *** core ***
+	#pragma omp for schedule(static)
+	for(int y = 0; y < size_o_dst_y; y++)
+		dwt_zero_padding_i_stride_d(
+			addr2_d(ptr,y,0,stride_x,stride_y),
+			y < size_i_dst_y ? size_i_dst_x : 0,
+			size_o_dst_x,
+			stride_y);
+}
 
-		// core: for t = 0 to T do
-		for(int t = 0; t < T; t++)
-		{
-			// core: pass-core-light
-			op4s_sdl2_pass_inv_core_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+/**
+ * @brief Zero padding of one level of the forward image transform.
+ *
+ * Both the padding of rows and of columns is zeroed in a single sweep over
+ * the rows. The rows lying in the padding of columns are zeroed whole, other
+ * rows only behind their coefficients. Nothing is touched on levels without
+ * padding. An axis whose size is not halved on this level (see
+ * @ref dwt_cdf97_2f_aniso_s) keeps its data in front of the padding.
+ */
+static
+void dwt_zero_padding_2f_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_src_x,
+	int size_o_src_y,
+	int size_o_dst_x,
+	int size_o_dst_y,
+	int size_i_src_x,
+	int size_i_src_y)
+{
+	if( size_o_src_x == size_i_src_x && size_o_src_y == size_i_src_y )
+		return;
 
-			// core: pass-core-full
-			op4s_sdl2_pass_inv_core_full_s_sse(w, v, l, c, r, z, in, out, &addr);
-		}
+	// extents of the low-pass and high-pass data
+	const int lo_x = size_o_dst_x == size_o_src_x ? size_i_src_x :  ceil_div2(size_i_src_x);
+	const int hi_x = size_o_dst_x == size_o_src_x ?            0 : floor_div2(size_i_src_x);
+	const int lo_y = size_o_dst_y == size_o_src_y ? size_i_src_y :  ceil_div2(size_i_src_y);
+	const int hi_y = size_o_dst_y == size_o_src_y ?            0 : floor_div2(size_i_src_y);
 
-		// core: if odd then
-		if( is_odd(S) )
+	#pragma omp for schedule(static)
+	for(int y = 0; y < size_o_src_y; y++)
+	{
+		if( (y >= lo_y && y < size_o_dst_y) || y >= size_o_dst_y + hi_y )
+			dwt_util_zero_stride_s(
+				addr2_s(ptr,y,0,stride_x,stride_y),
+				stride_y,
+				size_o_src_x);
+		else
 		{
-			// core: pass-core-light
-			op4s_sdl2_pass_inv_core_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+			dwt_util_zero_stride_s(
+				addr2_s(ptr,y,lo_x,stride_x,stride_y),
+				stride_y,
+				size_o_dst_x-lo_x);
+			dwt_util_zero_stride_s(
+				addr2_s(ptr,y,size_o_dst_x+hi_x,stride_x,stride_y),
+				stride_y,
+				size_o_src_x-size_o_dst_x-hi_x);
 		}
+	}
+}
 
-		// *** epilog2 ***
+/**
+ * @brief Zero padding of one level of the inverse image transform.
+ *
+ * Counterpart of dwt_zero_padding_2f_s.
+ */
+static
+void dwt_zero_padding_2i_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_dst_x,
+	int size_o_dst_y,
+	int size_i_dst_x,
+	int size_i_dst_y)
+{
+	if( size_o_dst_x == size_i_dst_x && size_o_dst_y == size_i_dst_y )
+		return;
 
-		if( is_odd(S) )
-		{
-			// epilog2: export(3)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 3);
+	#pragma omp for schedule(static)
+	for(int y = 0; y < size_o_dst_y; y++)
+		dwt_zero_padding_i_stride_s(
+			addr2_s(ptr,y,0,stride_x,stride_y),
+			y < size_i_dst_y ? size_i_dst_x : 0,
+			size_o_dst_x,
+			stride_y);
+}
 
-			// epilog2: pass-epilog-full
-			op4s_sdl2_pass_inv_epilog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+void dwt_util_switch_op(
+	enum dwt_op op)
+{
+	FUNC_BEGIN;
 
-			// epilog2: export(2)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 2);
+#ifdef microblaze
+	if( op == dwt_util_global_active_op )
+		return;
 
-			// epilog2: pass-epilog-light
-			op4s_sdl2_pass_inv_epilog_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+	//WAL_CHECK( wal_mb2pb(worker, 0) );
 
-			// epilog2: export(1)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 1);
+	//WAL_CHECK( wal_bce_jk_sync_operation(worker) );
 
-			// epilog2: pass-epilog-full
-			op4s_sdl2_pass_inv_epilog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+	for(int w = 0; w < get_total_workers(); w++)
+	{
+		WAL_CHECK( wal_reset_worker(worker[w]) );
+	}
 
-			// epilog2: export(0)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 0);
-		}
-		else
+	switch(op)
+	{
+		case DWT_OP_LIFT4SA:
 		{
-			// epilog2: export(3)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 3);
-
-			// epilog2: pass-epilog-light
-			op4s_sdl2_pass_inv_epilog_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+			for(int w = 0; w < get_total_workers(); w++)
+			{
+				WAL_CHECK( wal_start_operation(worker[w], WAL_PBID_P0) );
+			}
 
-			// epilog2: export(2)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 2);
+			float alpha = -dwt_cdf97_p1_s,
+				beta = dwt_cdf97_u1_s,
+				gamma = -dwt_cdf97_p2_s,
+				delta = dwt_cdf97_u2_s,
+				zeta = dwt_cdf97_s1_s;
 
-			// epilog2: pass-epilog-full
-			op4s_sdl2_pass_inv_epilog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+			const int size = 12;
+			// FIXME(ASVP): for these coeeficients, use memory bank "D"
+			const float coeffs[12] = {delta, 0.0f, gamma, 0.0f, beta, 0.0f, alpha, 0.0f, zeta, 0.0f, 1/zeta, 0.0f};
+			float *addr = dwt_util_allocate_vec_s(size);
+			if(!addr)
+			{
+				dwt_util_log(LOG_ERR, "Failed to allocate vector of %i floats.\n", size);
+				dwt_util_abort();
+			}
+			if( dwt_util_copy_vec_s(coeffs, addr, size) )
+				dwt_util_abort();
 
-			// epilog2: export(1)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 1);
+			assert( is_even(size) );
+			assert( is_aligned_8(addr) );
 
-			// epilog2: pass-epilog-flush
-			op4s_sdl2_pass_inv_epilog_flush_s_sse(w, v, l, c, r, z, in, out, &addr);
+			for(int w = 0; w < get_total_workers(); w++)
+			{
+				WAL_CHECK( wal_dma_configure(worker[w], 0, addr, 0, WAL_BCE_JSY_DMEM_B, 0, size) );
+				WAL_CHECK( wal_dma_start(worker[w], 0, WAL_DMA_REQ_RD) );
+				while( wal_dma_isbusy(worker[w], 0x01) )
+					;
+			}
 
-			// epilog2: export(0)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 0);
+			free(addr);
 		}
-	}
-	else if ( scaling > 0 )
-	{
-		// ****** forward transform ******
+		break;
+		case DWT_OP_LIFT4SB:
+		{
+			for(int w = 0; w < get_total_workers(); w++)
+			{
+				WAL_CHECK( wal_start_operation(worker[w], WAL_PBID_P1) );
+			}
 
-		// FIXME(ASVP): support for several workers
-		assert( 1 == dwt_util_get_num_workers() );
+			float alpha = -dwt_cdf97_u2_s,
+				beta = dwt_cdf97_p2_s,
+				gamma = -dwt_cdf97_u1_s,
+				delta = dwt_cdf97_p1_s,
+				zeta = dwt_cdf97_s1_s;
 
-		// *** init ***
+			const int size = 12;
+			// FIXME(ASVP): for these coeeficients, use memory bank "D"
+			const float coeffs[12] = {delta, 0.0f, gamma, 0.0f, beta, 0.0f, alpha, 0.0f, zeta, 0.0f, 1/zeta, 0.0f};
+			float *addr = dwt_util_allocate_vec_s(size);
+			if(!addr)
+			{
+				dwt_util_log(LOG_ERR, "Failed to allocate vector of %i floats.\n", size);
+				dwt_util_abort();
+			}
+			if( dwt_util_copy_vec_s(coeffs, addr, size) )
+				dwt_util_abort();
 
-		float *restrict addr = arr;
+			assert( is_even(size) );
+			assert( is_aligned_8(addr) );
 
-		// *** prolog2 ***
+			for(int w = 0; w < get_total_workers(); w++)
+			{
+				WAL_CHECK( wal_dma_configure(worker[w], 0, addr, 0, WAL_BCE_JSY_DMEM_B, 0, size) );
+				WAL_CHECK( wal_dma_start(worker[w], 0, WAL_DMA_REQ_RD) );
+				while( wal_dma_isbusy(worker[w], 0x01) )
+					;
+			}
 
-		// prolog2: import-preload
-		op4s_sdl2_preload_prolog_s_sse(w, v, l, c, r, z, in, out, &addr);
+			free(addr);
+		}
+		break;
+		default:
+		{
+			dwt_util_log(LOG_ERR, "Unknown operation.\n");
+	
+			dwt_util_abort();
+		}
+	}
 
-		// prolog2: import(3)
-		op4s_sdl2_import_s_sse(l, 3, out);
+	dwt_util_global_active_op = op;
+#else
+	UNUSED(op);
+#endif
 
-		// prolog2: pass-prolog-full
-		op4s_sdl2_pass_fwd_prolog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+	FUNC_END;
+}
 
-		// prolog2: import(2)
-		op4s_sdl2_import_s_sse(l, 2, out);
+static
+void dwt_cdf97_2f_core_d(
+	const void *src,
+	int src_stride_x,
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max_x,
+	int j_max_y,
+	int zero_padding)
+{
+	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-		// prolog2: pass-prolog-light
-		op4s_sdl2_pass_fwd_prolog_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+	struct dwt_workspace *workspace = acquire_workspace(size_o_big_max);
 
-		// prolog2: import(1)
-		op4s_sdl2_import_s_sse(l, 1, out);
+	int j = 0;
 
-		// prolog2: pass-prolog-full
-		op4s_sdl2_pass_fwd_prolog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+	// no horizontal pass to fuse the copy into
+	if( src != ptr && 0 == j_max_x )
+	{
+		for(int y = 0; y < size_i_big_y; y++)
+			dwt_util_memcpy_stride_d(
+				addr2_d(ptr,y,0,stride_x,stride_y),
+				stride_y,
+				addr2_const_d(src,y,0,src_stride_x,stride_y),
+				stride_y,
+				size_i_big_x);
+	}
 
-		// prolog2: import(0)
-		op4s_sdl2_import_s_sse(l, 0, out);
+	// one team for all levels, separated only by the barriers of the work-sharing loops
+	#pragma omp parallel firstprivate(j, src, src_stride_x)
+	for(;;)
+	{
+		if( max(j_max_x, j_max_y) == j )
+			break;
 
-		// *** core ***
+		const int size_o_src_x = ceil_div_pow2(size_o_big_x, min(j,   j_max_x));
+		const int size_o_src_y = ceil_div_pow2(size_o_big_y, min(j,   j_max_y));
+		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, min(j+1, j_max_x));
+		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, min(j+1, j_max_y));
+		const int size_i_src_x = ceil_div_pow2(size_i_big_x, min(j,   j_max_x));
+		const int size_i_src_y = ceil_div_pow2(size_i_big_y, min(j,   j_max_y));
+		// only rows of the nested image are read from the source
+		const int rows_y = src != ptr ? size_i_src_y : size_o_src_y;
 
-		// core: for t = 0 to T do
-		for(int t = 0; t < T; t++)
+		if( j < j_max_x )
 		{
-			// core: pass-core-light
-			op4s_sdl2_pass_fwd_core_light_s_sse(w, v, l, c, r, z, in, out, &addr);
-
-			// core: pass-core-full
-			op4s_sdl2_pass_fwd_core_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+			#pragma omp for schedule(static, ceil_div(rows_y, omp_get_num_threads()))
+			for(int y = 0; y < rows_y; y++)
+				dwt_cdf97_f_ex_stride_d(
+					addr2_const_d(src,y,0,src_stride_x,stride_y),
+					addr2_d(ptr,y,0,stride_x,stride_y),
+					addr2_d(ptr,y,size_o_dst_x,stride_x,stride_y),
+					workspace_temp_d(workspace),
+					size_i_src_x,
+					stride_y);
 		}
-
-		// core: if odd then
-		if( is_odd(S) )
+		if( j < j_max_y )
 		{
-			// core: pass-core-light
-			op4s_sdl2_pass_fwd_core_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+			#pragma omp for schedule(static, ceil_div(size_o_src_x, omp_get_num_threads()))
+			for(int x = 0; x < size_o_src_x; x++)
+				dwt_cdf97_f_ex_stride_d(
+					addr2_d(ptr,0,x,stride_x,stride_y),
+					addr2_d(ptr,0,x,stride_x,stride_y),
+					addr2_d(ptr,size_o_dst_y,x,stride_x,stride_y),
+					workspace_temp_d(workspace),
+					size_i_src_y,
+					stride_x);
 		}
 
-		// *** epilog2 ***
-
-		if( is_odd(S) )
-		{
-			// epilog2: export(3)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 3);
-
-			// epilog2: pass-epilog-full
-			op4s_sdl2_pass_fwd_epilog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
-
-			// epilog2: export(2)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 2);
+		if(zero_padding)
+			dwt_zero_padding_2f_d(
+				ptr,
+				stride_x,
+				stride_y,
+				size_o_src_x,
+				size_o_src_y,
+				size_o_dst_x,
+				size_o_dst_y,
+				size_i_src_x,
+				size_i_src_y);
 
-			// epilog2: pass-epilog-light
-			op4s_sdl2_pass_fwd_epilog_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+		// subsequent levels are in place
+		src = ptr;
+		src_stride_x = stride_x;
 
-			// epilog2: export(1)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 1);
+		j++;
+	}
 
-			// epilog2: pass-epilog-full
-			op4s_sdl2_pass_fwd_epilog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+	release_workspace(workspace);
+}
 
-			// epilog2: export(0)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 0);
-		}
-		else
-		{
-			// epilog2: export(3)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 3);
+void dwt_cdf97_2f_ex_d(
+	const void *src,
+	int src_stride_x,
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int *j_max_ptr,
+	int decompose_one,
+	int zero_padding)
+{
+	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
+	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-			// epilog2: pass-epilog-light
-			op4s_sdl2_pass_fwd_epilog_light_s_sse(w, v, l, c, r, z, in, out, &addr);
+	const int j_limit = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
 
-			// epilog2: export(2)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 2);
+	if( *j_max_ptr < 0 || *j_max_ptr > j_limit )
+		*j_max_ptr = j_limit;
 
-			// epilog2: pass-epilog-full
-			op4s_sdl2_pass_fwd_epilog_full_s_sse(w, v, l, c, r, z, in, out, &addr);
+	dwt_cdf97_2f_core_d(
+		src,
+		src_stride_x,
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		*j_max_ptr,
+		*j_max_ptr,
+		zero_padding);
+}
 
-			// epilog2: export(1)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 1);
+void dwt_cdf97_2f_aniso_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int *j_max_x_ptr,
+	int *j_max_y_ptr,
+	int zero_padding)
+{
+	const int j_limit_x = ceil_log2(size_o_big_x);
+	const int j_limit_y = ceil_log2(size_o_big_y);
 
-			// epilog2: pass-epilog-flush
-			op4s_sdl2_pass_fwd_epilog_flush_s_sse(w, v, l, c, r, z, in, out, &addr);
+	if( *j_max_x_ptr < 0 || *j_max_x_ptr > j_limit_x )
+		*j_max_x_ptr = j_limit_x;
+	if( *j_max_y_ptr < 0 || *j_max_y_ptr > j_limit_y )
+		*j_max_y_ptr = j_limit_y;
 
-			// epilog2: export(0)
-			op4s_sdl2_export_s_sse(l, &arr[2*steps], 0);
-		}
-	}
-	else
-	{
-		// ****** transform w/o scaling ******
+	dwt_cdf97_2f_core_d(
+		ptr,
+		stride_x,
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		*j_max_x_ptr,
+		*j_max_y_ptr,
+		zero_padding);
+}
 
-		// not implemented yet
-		dwt_util_abort();
-	}
+void dwt_cdf97_2f_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int *j_max_ptr,
+	int decompose_one,
+	int zero_padding)
+{
+	dwt_cdf97_2f_ex_d(
+		ptr,
+		stride_x,
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j_max_ptr,
+		decompose_one,
+		zero_padding);
 }
-#endif /* __SSE__ */
 
-/**
- * @brief Shifted double-loop algorithm.
- *
- * This function processes 2 coefficients (even + odd) per one iteration.
- */
 static
-void accel_lift_op4s_main_sdl_ref_s(
-	float *restrict arr,
-	int steps,
-	float alpha,
-	float beta,
-	float gamma,
-	float delta,
-	float zeta,
-	int scaling)
+void dwt_cdf53_2f_core_d(
+	const void *src,
+	int src_stride_x,
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max_x,
+	int j_max_y,
+	int zero_padding)
 {
-	// 6+ coeffs implies 3+ steps
-	assert( steps >= 3 );
-
-	assert( is_aligned_16(arr) );
+	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-	const float w[4] = { delta, gamma, beta, alpha };
-	const float v[4] = { 1/zeta, zeta, 1/zeta, zeta };
-	float l[4];
-	float c[4];
-	float r[4];
-	float z[4];
-	float in[4];
-	float out[4];
+	struct dwt_workspace *workspace = acquire_workspace(size_o_big_max);
 
-	const int S = steps-3;
+	int j = 0;
 
-	if( scaling < 0 )
+	// no horizontal pass to fuse the copy into
+	if( src != ptr && 0 == j_max_x )
 	{
-		// ****** inverse transform ******
-
-		// FIXME(ASVP): support for several workers
-		assert( 1 == dwt_util_get_num_workers() );
-
-		// *** init ***
-
-		// this pointer is needed because of use of arr[] in import and export functions
-		float *restrict addr = arr;
+		for(int y = 0; y < size_i_big_y; y++)
+			dwt_util_memcpy_stride_d(
+				addr2_d(ptr,y,0,stride_x,stride_y),
+				stride_y,
+				addr2_const_d(src,y,0,src_stride_x,stride_y),
+				stride_y,
+				size_i_big_x);
+	}
 
-		// *** prolog2 ***
+	// one team for all levels, separated only by the barriers of the work-sharing loops
+	#pragma omp parallel firstprivate(j, src, src_stride_x)
+	for(;;)
+	{
+		if( max(j_max_x, j_max_y) == j )
+			break;
 
-		// prolog2: import(3)
-		op4s_sdl_import_s_ref(l, arr, 3);
+		const int size_o_src_x = ceil_div_pow2(size_o_big_x, min(j,   j_max_x));
+		const int size_o_src_y = ceil_div_pow2(size_o_big_y, min(j,   j_max_y));
+		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, min(j+1, j_max_x));
+		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, min(j+1, j_max_y));
+		const int size_i_src_x = ceil_div_pow2(size_i_big_x, min(j,   j_max_x));
+		const int size_i_src_y = ceil_div_pow2(size_i_big_y, min(j,   j_max_y));
+		// only rows of the nested image are read from the source
+		const int rows_y = src != ptr ? size_i_src_y : size_o_src_y;
 
-		// prolog2: pass-prolog
-		op4s_sdl_pass_inv_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
-	
-		// prolog2: import(2)
-		op4s_sdl_import_s_ref(l, arr, 2);
+		if( j < j_max_x )
+		{
+			#pragma omp for schedule(static, ceil_div(rows_y, omp_get_num_threads()))
+			for(int y = 0; y < rows_y; y++)
+				dwt_cdf53_f_ex_stride_d(
+					addr2_const_d(src,y,0,src_stride_x,stride_y),
+					addr2_d(ptr,y,0,stride_x,stride_y),
+					addr2_d(ptr,y,size_o_dst_x,stride_x,stride_y),
+					workspace_temp_d(workspace),
+					size_i_src_x,
+					stride_y);
+		}
+		if( j < j_max_y )
+		{
+			#pragma omp for schedule(static, ceil_div(size_o_src_x, omp_get_num_threads()))
+			for(int x = 0; x < size_o_src_x; x++)
+				dwt_cdf53_f_ex_stride_d(
+					addr2_d(ptr,0,x,stride_x,stride_y),
+					addr2_d(ptr,0,x,stride_x,stride_y),
+					addr2_d(ptr,size_o_dst_y,x,stride_x,stride_y),
+					workspace_temp_d(workspace),
+					size_i_src_y,
+					stride_x);
+		}
 
-		// prolog2: pass-prolog
-		op4s_sdl_pass_inv_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+		if(zero_padding)
+			dwt_zero_padding_2f_d(
+				ptr,
+				stride_x,
+				stride_y,
+				size_o_src_x,
+				size_o_src_y,
+				size_o_dst_x,
+				size_o_dst_y,
+				size_i_src_x,
+				size_i_src_y);
 
-		// prolog2: import(1)
-		op4s_sdl_import_s_ref(l, arr, 1);
+		// subsequent levels are in place
+		src = ptr;
+		src_stride_x = stride_x;
 
-		// prolog2: pass-prolog
-		op4s_sdl_pass_inv_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+		j++;
+	}
 
-		// prolog2: import(0)
-		op4s_sdl_import_s_ref(l, arr, 0);
+	release_workspace(workspace);
+}
 
-		// *** core ***
+void dwt_cdf53_2f_ex_d(
+	const void *src,
+	int src_stride_x,
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int *j_max_ptr,
+	int decompose_one,
+	int zero_padding)
+{
+	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
+	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-		// core: for s = 0 to S do
-		for(int s = 0; s < S; s++)
-		{
-			// core: pass-core
-			op4s_sdl_pass_inv_core_s_ref(w, v, l, c, r, z, in, out, &addr);
+	const int j_limit = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
 
-		}
+	if( *j_max_ptr < 0 || *j_max_ptr > j_limit )
+		*j_max_ptr = j_limit;
 
-		// *** epilog2 ***
+	dwt_cdf53_2f_core_d(
+		src,
+		src_stride_x,
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		*j_max_ptr,
+		*j_max_ptr,
+		zero_padding);
+}
 
-		// epilog2: export(3)
-		op4s_sdl_export_s_ref(l, &arr[2*steps], 3);
+void dwt_cdf53_2f_aniso_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int *j_max_x_ptr,
+	int *j_max_y_ptr,
+	int zero_padding)
+{
+	const int j_limit_x = ceil_log2(size_o_big_x);
+	const int j_limit_y = ceil_log2(size_o_big_y);
 
-		// epilog2: pass-epilog
-		op4s_sdl_pass_inv_epilog_s_ref(w, v, l, c, r, z, in, out, &addr);
+	if( *j_max_x_ptr < 0 || *j_max_x_ptr > j_limit_x )
+		*j_max_x_ptr = j_limit_x;
+	if( *j_max_y_ptr < 0 || *j_max_y_ptr > j_limit_y )
+		*j_max_y_ptr = j_limit_y;
 
-		// epilog2: export(2)
-		op4s_sdl_export_s_ref(l, &arr[2*steps], 2);
+	dwt_cdf53_2f_core_d(
+		ptr,
+		stride_x,
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		*j_max_x_ptr,
+		*j_max_y_ptr,
+		zero_padding);
+}
 
-		// epilog2: pass-epilog
-		op4s_sdl_pass_inv_epilog_s_ref(w, v, l, c, r, z, in, out, &addr);
+void dwt_cdf53_2f_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int *j_max_ptr,
+	int decompose_one,
+	int zero_padding)
+{
+	dwt_cdf53_2f_ex_d(
+		ptr,
+		stride_x,
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j_max_ptr,
+		decompose_one,
+		zero_padding);
+}
 
-		// epilog2: export(1)
-		op4s_sdl_export_s_ref(l, &arr[2*steps], 1);
+/**
+ * @brief Mirror the row index @p i into the range [0; @p N) by the symmetric extension.
+ */
+static
+int mirror_row(
+	int i,
+	int N)
+{
+	return i < 0 ? -i : (i >= N ? 2*(N-1)-i : i);
+}
 
-		// epilog2: pass-epilog
-		op4s_sdl_pass_inv_epilog_s_ref(w, v, l, c, r, z, in, out, &addr);
+/**
+ * @brief Lifting steps of the single-loop approach at the time @p t.
+ *
+ * The step s is applied on the row t-1-s of the @p ring of sixteen rows of
+ * @p cols floats. The rows are processed in chunks of columns, so that the
+ * chunks of all rows involved stay in the L1 cache.
+ */
+static
+void op4s_ring_steps_s(
+	float *ring,
+	int cols,
+	int t,
+	int N,
+	const float *w)
+{
+	for(int x = 0; x < cols; x += 512)
+	{
+		const int chunk = min(512, cols-x);
 
-		// epilog2: export(0)
-		op4s_sdl_export_s_ref(l, &arr[2*steps], 0);
+		for(int s = 0; s < 4; s++)
+		{
+			const int i = t-1-s;
+
+			if( i >= 0 && i < N )
+				op4s_row_op_s(
+					ring + (i&15)*cols + x,
+					ring + (mirror_row(i-1, N)&15)*cols + x,
+					ring + (mirror_row(i+1, N)&15)*cols + x,
+					w[s],
+					chunk);
+		}
 	}
-	else if ( scaling > 0 )
-	{
-		// ****** forward transform ******
+}
 
-		// FIXME(ASVP): support for several workers
-		assert( 1 == dwt_util_get_num_workers() );
+/**
+ * @brief One level of forward 2-D CDF 9/7 transform using the single-loop approach.
+ *
+ * Image rows are transformed horizontally in groups of @p group rows as
+ * needed and copied into a small ring of working rows, which immediately
+ * feeds the vertical lifting. The vertical lifting steps proceed row by row
+ * (a shifted loop over rows), so each row leaves the ring as soon as all
+ * four steps have been applied on it and its neighbours. The low-pass rows
+ * are written directly into their place. The high-pass rows are staged
+ * until their place has been read. Thus, the image is streamed through the
+ * memory only once per level.
+ */
+static
+void dwt_cdf97_2f_single_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_src_x,
+	int size_o_src_y,
+	int size_o_dst_x,
+	int size_o_dst_y,
+	int size_i_src_x,
+	int size_i_src_y,
+	float *tmp,
+	int tmp_dist,
+	int group)
+{
+	assert( size_i_src_y >= 2 && (int)sizeof(float) == stride_y && group <= 4 );
 
-		// *** init ***
+	const int N = size_i_src_y;
+	const int cols = size_o_src_x;
+	const float w[4] = { -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s };
+	const float zeta = dwt_cdf97_s1_s;
 
-		// this pointer is needed because of use of arr[] in import and export functions
-		float *restrict addr = arr;
+	// working rows
+	float *ring = malloc(sizeof(float) * 16 * cols);
+	// high-pass rows waiting for their place
+	float *stage = malloc(sizeof(float) * floor_div2(N) * cols);
 
-		// *** prolog2 ***
+	if( NULL == ring || NULL == stage )
+	{
+		dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+		dwt_util_abort();
+	}
 
-		// prolog2: import(3)
-		op4s_sdl_import_s_ref(l, arr, 3);
+#define SLOT(i) (ring + ((i)&15)*cols)
+#define ROW(i) addr2_s(ptr,(i),0,stride_x,stride_y)
+#define HORIZ(y, count) dwt_cdf97_f_ex_stride_group_s(ROW(y), ROW(y), addr2_s(ptr,(y),size_o_dst_x,stride_x,stride_y), tmp, tmp_dist, size_i_src_x, stride_y, (count), stride_x, stride_x)
 
-		// prolog2: pass-prolog
-		op4s_sdl_pass_fwd_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
-	
-		// prolog2: import(2)
-		op4s_sdl_import_s_ref(l, arr, 2);
+	// rows out of the vertical transform are transformed horizontally only
+	for(int y = N; y < size_o_src_y; y += group)
+		HORIZ(y, min(group, size_o_src_y-y));
 
-		// prolog2: pass-prolog
-		op4s_sdl_pass_fwd_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+	// rows read into the ring
+	int loaded = 0;
+	// high-pass rows in the stage
+	int staged = 0;
 
-		// prolog2: import(1)
-		op4s_sdl_import_s_ref(l, arr, 1);
+	// the step s is applied on the row t-1-s at time t, the rows up to t have to be loaded
+	for(int t = 0; t <= N+4; t += 2)
+	{
+		while( loaded <= min(t, N-1) )
+		{
+			const int count = min(group, N-loaded);
 
-		// prolog2: pass-prolog
-		op4s_sdl_pass_fwd_prolog_s_ref(w, v, l, c, r, z, in, out, &addr);
+			HORIZ(loaded, count);
 
-		// prolog2: import(0)
-		op4s_sdl_import_s_ref(l, arr, 0);
+			for(int k = 0; k < count; k++, loaded++)
+				memcpy(SLOT(loaded), ROW(loaded), sizeof(float) * cols);
+		}
 
-		// *** core ***
+		op4s_ring_steps_s(ring, cols, t, N, w);
 
-		// core: for s = 0 to S do
-		for(int s = 0; s < S; s++)
+		// odd rows are final after time i+5, even rows after time i+4
+		for(int i = max(t-5, 0); i <= min(t-4, N-1); i++)
 		{
-			// core: pass-core
-			op4s_sdl_pass_fwd_core_s_ref(w, v, l, c, r, z, in, out, &addr);
+			if( is_even(i) )
+			{
+				op4s_row_mul_s(ROW(i/2), SLOT(i), zeta, cols);
+			}
+			else
+			{
+				const int y = size_o_dst_y + i/2;
 
+				// the rows up to t have been read
+				if( y <= t || y >= N )
+				{
+					op4s_row_mul_s(ROW(y), SLOT(i), 1/zeta, cols);
+				}
+				else
+				{
+					op4s_row_mul_s(stage + (i/2)*cols, SLOT(i), 1/zeta, cols);
+					staged = i/2+1;
+				}
+			}
 		}
+	}
 
-		// *** epilog2 ***
-
-		// epilog2: export(3)
-		op4s_sdl_export_s_ref(l, &arr[2*steps], 3);
-
-		// epilog2: pass-epilog
-		op4s_sdl_pass_fwd_epilog_s_ref(w, v, l, c, r, z, in, out, &addr);
-
-		// epilog2: export(2)
-		op4s_sdl_export_s_ref(l, &arr[2*steps], 2);
+	for(int k = 0; k < staged; k++)
+		memcpy(ROW(size_o_dst_y+k), stage + k*cols, sizeof(float) * cols);
 
-		// epilog2: pass-epilog
-		op4s_sdl_pass_fwd_epilog_s_ref(w, v, l, c, r, z, in, out, &addr);
+#undef HORIZ
+#undef SLOT
+#undef ROW
 
-		// epilog2: export(1)
-		op4s_sdl_export_s_ref(l, &arr[2*steps], 1);
+	free(stage);
+	free(ring);
+}
 
-		// epilog2: pass-epilog
-		op4s_sdl_pass_fwd_epilog_s_ref(w, v, l, c, r, z, in, out, &addr);
+/**
+ * @brief Last row (exclusive) of the band of tiles containing the row @p y.
+ */
+static
+int tile_band_end(
+	int y,
+	int tile,
+	int N)
+{
+	return min((y/tile+1)*tile, N);
+}
 
-		// epilog2: export(0)
-		op4s_sdl_export_s_ref(l, &arr[2*steps], 0);
-	}
-	else
-	{
-		// ****** transform w/o scaling ******
+/**
+ * @brief Whether the row @p y is read by the bands following the band ending at the row @p y1 (forward tiled strategy).
+ */
+static
+int tile_row_needed_f(
+	int y,
+	int y1,
+	int N)
+{
+	return y1 < N && y >= y1-DWT_TILE_HALO;
+}
 
-		// not implemented yet
-		dwt_util_abort();
-	}
+/**
+ * @brief Forward 2-D CDF 9/7 transform of a tile of @p n columns and @p m rows.
+ *
+ * The rows of the tile are @p pitch floats apart in @p block. The temporary
+ * buffer @p tmp holds @p group signals @p tmp_dist floats apart, or 16 rows
+ * of the tile.
+ */
+static
+void dwt_cdf97_2f_block_s(
+	float *block,
+	float *tmp,
+	int tmp_dist,
+	int n,
+	int m,
+	int pitch,
+	int group)
+{
+	for(int i = 0; i < m; i += group)
+		dwt_cdf97_f_ex_stride_group_s(
+			block + i*pitch,
+			block + i*pitch,
+			block + i*pitch + ceil_div2(n),
+			tmp + 3,
+			tmp_dist,
+			n,
+			sizeof(float),
+			min(group, m-i),
+			sizeof(float) * pitch,
+			sizeof(float) * pitch);
+
+	for(int x = 0; x < n; x += get_cols_s(m))
+		dwt_cdf97_f_ex_stride_cols_s(
+			block + x,
+			block + x,
+			block + ceil_div2(m)*pitch + x,
+			tmp,
+			m,
+			sizeof(float) * pitch,
+			min(get_cols_s(m), n-x));
 }
 
 /**
- * @brief Double-loop algorithm from Rade Kutil: A Single-Loop Approach to
- * SIMD Parallelization of 2-D Wavelet Lifting.
+ * @brief One level of forward 2-D CDF 9/7 transform using the tiled strategy.
+ *
+ * The image is processed in bands of @p tile rows, each band in tiles of
+ * @p tile columns. Every tile is copied into a small buffer together with
+ * its halo, transformed horizontally and vertically, and its interior is
+ * collected into the band. The tiles of a band are processed in parallel.
+ * When the band is complete, it is written into its place. Rows which are
+ * still to be read by the following bands are saved before.
  */
 static
-void accel_lift_op4s_main_dl_s(
-	float *arr,
-	int steps,
-	float alpha,
-	float beta,
-	float gamma,
-	float delta,
-	float zeta,
-	int scaling)
-{
-	assert( steps >= 0 );
+void dwt_cdf97_2f_tile_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int tile,
+	int group)
+{
+	assert( size_x >= 2 && size_y >= 2 && (int)sizeof(float) == stride_y && is_even(tile) && tile >= 2*DWT_TILE_HALO );
+
+	const int N = size_y;
+	const int cols = size_x;
+	const int size_dst_x = ceil_div2(size_x);
+	const int size_dst_y = ceil_div2(size_y);
+	// distance between rows of a tile, preserves alignment on 16 bytes
+	const int pitch = (tile + 2*DWT_TILE_HALO + 3) & ~3;
+	const int tmp_dist = (calc_and_set_temp_size(pitch)+3) & ~3;
+
+	// rows to be saved
+	int saves = 0;
+	for(int y = 0; y < N; y++)
+	{
+		const int k = y < size_dst_y ? y : y-size_dst_y;
 
-	if( scaling < 0 )
+		if( tile_row_needed_f(y, tile_band_end(2*k, tile, N), N) )
+			saves++;
+	}
+
+	float *band, *stage;
+	int *slot;
+
+	// buffers shared by the team
+	#pragma omp single copyprivate(band, stage, slot)
 	{
-		for(int w = 0; w < dwt_util_get_num_workers(); w++)
+		// rows of the current band
+		band = malloc(sizeof(float) * tile * cols);
+		// saved rows
+		stage = malloc(sizeof(float) * saves * cols);
+		// index of the saved row or -1
+		slot = malloc(sizeof(int) * N);
+
+		if( NULL == band || (NULL == stage && saves) || NULL == slot )
 		{
-			float *arr_local = calc_temp_offset_s(arr, w);
+			dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+			dwt_util_abort();
+		}
 
-			const float w[4] = { delta, gamma, beta, alpha };
+		for(int y = 0; y < N; y++)
+			slot[y] = -1;
+	}
 
-			// values that have to be passed from iteration to iteration
-			// slide in left border
-			float l[4] = { arr_local[0], arr_local[1], arr_local[2], arr_local[3] };
+	saves = 0;
 
-			// loop by pairs from left to right
-			for(int s = 0; s < steps; s++)
-			{
-				// auxiliary variables
-				float in0;
-				float in1;
-				float out0;
-				float out1;
+#define ROW(y) addr2_s(ptr,(y),0,stride_x,stride_y)
+#define SRC(y) (slot[(y)] < 0 ? ROW(y) : stage + slot[(y)]*cols)
 
-				// inputs
-				in0 = arr_local[4+0+s*2];
-				in1 = arr_local[4+1+s*2];
+	for(int y0 = 0; y0 < N; y0 += tile)
+	{
+		const int y1 = min(y0+tile, N);
+		const int ys = max(y0-DWT_TILE_HALO, 0);
+		const int ye = min(y1+DWT_TILE_HALO, N);
+		const int m = ye-ys;
+		// low-pass and high-pass rows of the band
+		const int band_l = ceil_div2(y1)-y0/2;
+		const int band_h = floor_div2(y1)-y0/2;
+
+		#pragma omp for schedule(static)
+		for(int x0 = 0; x0 < cols; x0 += tile)
+		{
+			const int x1 = min(x0+tile, cols);
+			const int xs = max(x0-DWT_TILE_HALO, 0);
+			const int xe = min(x1+DWT_TILE_HALO, cols);
+			const int n = xe-xs;
 
-				// scales
-				in0 = in0 * 1/zeta;
-				in1 = in1 *   zeta;
+			float *block = memalign(16, sizeof(float) * (m*pitch + max(group*tmp_dist, 16*pitch)));
+			if( NULL == block )
+			{
+				dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+				dwt_util_abort();
+			}
+			float *tmp = block + m*pitch;
 
-				// shuffles
-				float c[4] = { l[1], l[2], l[3], in0 };
-				out0 = l[0];
+			for(int i = 0; i < m; i++)
+				memcpy(block + i*pitch, SRC(ys+i) + xs, sizeof(float) * n);
 
-				float r[4];
+			dwt_cdf97_2f_block_s(block, tmp, tmp_dist, n, m, pitch, group);
 
-				// operation z[] = c[] + { alpha, beta, gamma, delta } * ( l[] + r[] )
-				// by sequential computation from top/right to bottom/left
-				r[3] = in1;
-				r[2] = c[3]+w[3]*(l[3]+r[3]);
-				r[1] = c[2]+w[2]*(l[2]+r[2]);
-				r[0] = c[1]+w[1]*(l[1]+r[1]);
-				out1 = c[0]+w[0]*(l[0]+r[0]);
+			// interior of the tile
+			const int tile_l = ceil_div2(x1)-x0/2;
+			const int tile_h = floor_div2(x1)-x0/2;
 
-				// outputs
-				arr_local[0+0+s*2] = out0;
-				arr_local[0+1+s*2] = out1;
+			for(int k = 0; k < band_l + band_h; k++)
+			{
+				const float *row = block + (k < band_l ? (y0-ys)/2 + k : ceil_div2(m) + (y0-ys)/2 + k-band_l) * pitch;
 
-				// update l[]
-				l[0] = r[0];
-				l[1] = r[1];
-				l[2] = r[2];
-				l[3] = r[3];
+				memcpy(band + k*cols + x0/2, row + (x0-xs)/2, sizeof(float) * tile_l);
+				memcpy(band + k*cols + size_dst_x + x0/2, row + ceil_div2(n) + (x0-xs)/2, sizeof(float) * tile_h);
 			}
 
-			// slide out right border
-			arr_local[steps*2+0] = l[0];
-			arr_local[steps*2+1] = l[1];
-			arr_local[steps*2+2] = l[2];
-			arr_local[steps*2+3] = l[3];
+			free(block);
 		}
-	}
-	else if ( scaling > 0 )
-	{
-		for(int w = 0; w < dwt_util_get_num_workers(); w++)
+
+		// the band is put back by one thread
+		#pragma omp master
 		{
-			float *arr_local = calc_temp_offset_s(arr, w);
+			for(int k = 0; k < band_l + band_h; k++)
+			{
+				const int y = k < band_l ? y0/2 + k : size_dst_y + y0/2 + k-band_l;
 
-			const float w[4] = { delta, gamma, beta, alpha };
+				if( slot[y] < 0 && tile_row_needed_f(y, y1, N) )
+				{
+					memcpy(stage + saves*cols, ROW(y), sizeof(float) * cols);
+					slot[y] = saves++;
+				}
 
-			// values that have to be passed from iteration to iteration
-			// slide in left border
-			float l[4] = { arr_local[0], arr_local[1], arr_local[2], arr_local[3] };
+				memcpy(ROW(y), band + k*cols, sizeof(float) * cols);
+			}
+		}
 
-			// loop by pairs from left to right
-			for(int s = 0; s < steps; s++)
-			{
-				// auxiliary variables
-				float in0;
-				float in1;
-				float out0;
-				float out1;
+		#pragma omp barrier
+	}
 
-				// inputs
-				in0 = arr_local[4+0+s*2];
-				in1 = arr_local[4+1+s*2];
+#undef SRC
+#undef ROW
 
-				// shuffles
-				float c[4] = { l[1], l[2], l[3], in0 };
-				out0 = l[0];
+	#pragma omp master
+	{
+		free(slot);
+		free(stage);
+		free(band);
+	}
+}
 
-				float r[4];
+/**
+ * @brief One level of the line-based forward 2-D CDF 9/7 transform.
+ */
+struct dwt_cdf97_2f_line_level_s
+{
+	int size_x;		///< width of the level
+	int size_y;		///< height of the level
+	int loaded;		///< rows pushed into the ring
+	int ready;		///< rows transformed horizontally
+	int t;			///< time of the next lifting steps (see op4s_ring_steps_s)
+	float *ring;		///< sixteen working rows
+	float *out;		///< final low-pass row
+	float *tmp;		///< temporary signals of the horizontal transform
+	int tmp_dist;		///< distance between the temporary signals
+};
 
-				// operation z[] = c[] + { alpha, beta, gamma, delta } * ( l[] + r[] )
-				// by sequential computation from top/right to bottom/left
-				r[3] = in1;
-				r[2] = c[3]+w[3]*(l[3]+r[3]);
-				r[1] = c[2]+w[2]*(l[2]+r[2]);
-				r[0] = c[1]+w[1]*(l[1]+r[1]);
-				out1 = c[0]+w[0]*(l[0]+r[0]);
+/**
+ * @brief Finished part of a row waiting to be pulled.
+ */
+struct dwt_cdf97_2f_line_row_s
+{
+	int y;			///< row in the layout of dwt_cdf97_2f_s
+	int x;			///< first column in the layout of dwt_cdf97_2f_s
+	int n;			///< number of coefficients
+	float *data;		///< coefficients, buffer of the width of the image
+};
+
+struct dwt_cdf97_2f_line_s
+{
+	int size_x;					///< width of the image
+	int size_y;					///< height of the image
+	int pushed;					///< rows pushed by the caller
+	int levels;					///< number of decomposition levels
+	int group;					///< rows transformed horizontally together
+	struct dwt_cdf97_2f_line_level_s *level;	///< state of each level
+	struct dwt_cdf97_2f_line_row_s *queue;		///< finished rows
+	int queue_head;					///< next row to be pulled
+	int queue_tail;					///< next free place
+	int queue_size;					///< capacity of the queue
+};
+
+/**
+ * @brief Put a copy of @p n coefficients finished at the position (@p y, @p x) into the queue.
+ *
+ * Each place of the queue owns a buffer of the width of the image, so the
+ * buffers of pulled rows are reused.
+ */
+static
+void line_queue_s(
+	struct dwt_cdf97_2f_line_s *line,
+	int y,
+	int x,
+	int n,
+	const float *data)
+{
+	if( line->queue_tail == line->queue_size )
+	{
+		if( line->queue_head > 0 )
+		{
+			// move the rows to the beginning, the buffers of pulled rows to the end
+			for(int i = 0; i < line->queue_tail - line->queue_head; i++)
+			{
+				const struct dwt_cdf97_2f_line_row_s row = line->queue[i];
 
-				// scales
-				out0 = out0 * 1/zeta;
-				out1 = out1 *   zeta;
+				line->queue[i] = line->queue[line->queue_head + i];
+				line->queue[line->queue_head + i] = row;
+			}
 
-				// outputs
-				arr_local[0+0+s*2] = out0;
-				arr_local[0+1+s*2] = out1;
+			line->queue_tail -= line->queue_head;
+			line->queue_head = 0;
+		}
+		else
+		{
+			const int size = max(2*line->queue_size, 16);
 
-				// update l[]
-				l[0] = r[0];
-				l[1] = r[1];
-				l[2] = r[2];
-				l[3] = r[3];
+			line->queue = realloc(line->queue, sizeof(struct dwt_cdf97_2f_line_row_s) * size);
+
+			if( NULL == line->queue )
+			{
+				dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+				dwt_util_abort();
 			}
 
-			// slide out right border
-			arr_local[steps*2+0] = l[0];
-			arr_local[steps*2+1] = l[1];
-			arr_local[steps*2+2] = l[2];
-			arr_local[steps*2+3] = l[3];
+			for(; line->queue_size < size; line->queue_size++)
+			{
+				line->queue[line->queue_size].data = malloc(sizeof(float) * line->size_x);
+
+				if( NULL == line->queue[line->queue_size].data )
+				{
+					dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+					dwt_util_abort();
+				}
+			}
 		}
 	}
-	else
-	{
-		// fallback, not implemented
-		accel_lift_op4s_main_s(arr, steps, alpha, beta, gamma, delta, zeta, scaling);
-	}
-}
 
-int dwt_util_is_aligned_8(
-	const void *ptr)
-{
-	return is_aligned_8(ptr);
-}
+	struct dwt_cdf97_2f_line_row_s *row = &line->queue[line->queue_tail++];
 
-int dwt_util_is_aligned_4(
-	const void *ptr)
-{
-	return is_aligned_4(ptr);
+	row->y = y;
+	row->x = x;
+	row->n = n;
+
+	memcpy(row->data, data, sizeof(float) * n);
 }
 
 /**
- * @brief Accelerated PicoBlaze operation.
+ * @brief Push the row @p src into the level @p j and emit all rows finished by it.
  *
- * Two pairs (predict and update) of lifting steps and coefficients scaling
- * merged together. This function is accelerated on ASVP/EdkDSP.
+ * The row is copied into the ring of the level. The rows are transformed
+ * horizontally in groups as in dwt_cdf97_2f_single_s, and the vertical
+ * lifting steps proceed as soon as the rows they need are available. Each final low-pass row is passed into the
+ * next level, its high-pass part and final high-pass rows are queued.
  */
 static
-void accel_lift_op4s_main_pb_s(
-	float *arr,
-	int steps,
-	float alpha,
-	float beta,
-	float gamma,
-	float delta,
-	float zeta,
-	int scaling)
+void line_push_s(
+	struct dwt_cdf97_2f_line_s *line,
+	int j,
+	const float *src)
 {
-	FUNC_BEGIN;
+	struct dwt_cdf97_2f_line_level_s *level = &line->level[j];
 
-	assert( steps >= 0 );
-
-#ifdef microblaze
-	UNUSED(scaling);
-	UNUSED(alpha);
-	UNUSED(beta);
-	UNUSED(gamma);
-	UNUSED(delta);
-	UNUSED(zeta);
+	const int N = level->size_y;
+	const int cols = level->size_x;
+	const float w[4] = { -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s };
+	const float zeta = dwt_cdf97_s1_s;
 
-	assert( steps <= (BANK_SIZE - 4) / 2 );
+#define SLOT(i) (level->ring + ((i)&15)*cols)
 
-	const int size = 2*steps + 4;
-	float *addr = arr; // FIXME: not needed
+	memcpy(SLOT(level->loaded), src, sizeof(float) * cols);
 
-	assert( is_aligned_8(addr) );
-	assert( is_even(size) );
+	level->loaded++;
 
-	for(int w = 0; w < get_active_workers(); w++)
+	// a group never wraps around the ring
+	if( level->loaded - level->ready == line->group || level->loaded == N )
 	{
-		// FIXME(ASVP): channel w according to worker ID; but each worker has independent DMA channels, thus this is not necessary
-		const uint8_t ch = w;
-		float *addr_local = calc_temp_offset_s(addr, w);
-		
-		assert( is_aligned_8(addr_local) );
-
-		WAL_CHECK( wal_dma_configure(worker[w], ch, addr_local, 0, WAL_BCE_JSY_DMEM_A, WAL_BANK_POS(0), size) );
-		WAL_CHECK( wal_dma_start(worker[w], ch, WAL_DMA_REQ_RD) );
+		dwt_cdf97_f_ex_stride_group_s(
+			SLOT(level->ready),
+			SLOT(level->ready),
+			SLOT(level->ready) + ceil_div2(cols),
+			level->tmp + 3, // HACK: +3 as in dwt_cdf97_2f_s
+			level->tmp_dist,
+			cols,
+			sizeof(float),
+			level->loaded - level->ready,
+			sizeof(float) * cols,
+			sizeof(float) * cols);
+
+		level->ready = level->loaded;
 	}
 
-	for(int w = 0; w < get_active_workers(); w++)
+	// the step s is applied on the row t-1-s at time t, the rows up to t have to be ready
+	while( level->t <= N+4 && min(level->t, N-1) < level->ready )
 	{
-		// HACK(ASVP): wait for completing memory transfers on all 8 channels; but each worker has independent DMA channels
-		while( wal_dma_isbusy(worker[w], /*WAL_DMA_MASK(ch)*/ 0x0f) )
-			;
-	}
+		if( N >= 2 )
+			op4s_ring_steps_s(level->ring, cols, level->t, N, w);
 
-	const uint32_t steps_32 = (uint32_t)steps;
+		// odd rows are final after time i+5, even rows after time i+4
+		for(int i = max(level->t-5, 0); i <= min(level->t-4, N-1); i++)
+		{
+			if( is_even(i) )
+			{
+				op4s_row_mul_s(level->out, SLOT(i), zeta, cols);
 
-	// start BCE computations
-	for(int w = 0; w < get_active_workers(); w++)
-	{
-		WAL_CHECK( wal_mb2cmem(worker[w], WAL_CMEM_MB2PB, 0x01, &steps_32, 1) );
+				if( j+1 < line->levels )
+				{
+					// nothing is left in a column
+					if( cols > 1 )
+						line_queue_s(line, i/2, ceil_div2(cols), floor_div2(cols), level->out + ceil_div2(cols));
+					line_push_s(line, j+1, level->out);
+				}
+				else
+					line_queue_s(line, i/2, 0, cols, level->out);
+			}
+			else
+			{
+				op4s_row_mul_s(SLOT(i), SLOT(i), 1/zeta, cols);
+				line_queue_s(line, ceil_div2(N) + i/2, 0, cols, SLOT(i));
+			}
+		}
 
-		WAL_CHECK( wal_mb2pb(worker[w], 1) );
+		level->t += 2;
 	}
 
-	// wait for finishing every BCE computation
-	for(int w = 0; w < get_active_workers(); w++)
-	{
-		WAL_CHECK( wal_pb2mb(worker[w], NULL) );
-	}
+#undef SLOT
+}
 
-	assert( is_aligned_8(addr) );
-	assert( is_even(size) );
+struct dwt_cdf97_2f_line_s *dwt_cdf97_2f_line_init_s(
+	int size_x,
+	int size_y,
+	int *j_max_ptr,
+	int decompose_one)
+{
+	assert( size_x > 0 && size_y > 0 && NULL != j_max_ptr );
 
-	for(int w = 0; w < get_active_workers(); w++)
-	{
-		const uint8_t ch = w;
-		float *addr_local = calc_temp_offset_s(addr, w);
+	const int j_limit = ceil_log2(decompose_one ? max(size_x, size_y) : min(size_x, size_y));
 
-		assert( is_aligned_8(addr_local) );
+	if( *j_max_ptr < 0 || *j_max_ptr > j_limit )
+		*j_max_ptr = j_limit;
 
-		WAL_CHECK( wal_dma_configure(worker[w], ch, addr_local, 0, WAL_BCE_JSY_DMEM_C, WAL_BANK_POS(0), size) );
-		WAL_CHECK( wal_dma_start(worker[w], ch, WAL_DMA_REQ_WR) );
+	struct dwt_cdf97_2f_line_s *line = malloc(sizeof(struct dwt_cdf97_2f_line_s));
+
+	if( NULL == line )
+	{
+		dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+		dwt_util_abort();
 	}
 
-	for(int w = 0; w < get_active_workers(); w++)
+	line->size_x = size_x;
+	line->size_y = size_y;
+	line->pushed = 0;
+	line->levels = *j_max_ptr;
+	line->group = get_accel_group_s();
+	// zeroed, the counters of the levels start at zero
+	line->level = calloc(max(line->levels, 1), sizeof(struct dwt_cdf97_2f_line_level_s));
+	line->queue = NULL;
+	line->queue_head = 0;
+	line->queue_tail = 0;
+	line->queue_size = 0;
+
+	if( NULL == line->level )
 	{
-		while( wal_dma_isbusy(worker[w], /*WAL_DMA_MASK(ch)*/ 0x0f) )
-			;
+		dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+		dwt_util_abort();
 	}
 
-	for(int w = 0; w < get_active_workers(); w++)
+	for(int j = 0; j < line->levels; j++)
 	{
-		float *addr_local = calc_temp_offset_s(addr, w);
+		struct dwt_cdf97_2f_line_level_s *level = &line->level[j];
 
-		flush_cache_s(addr_local-1, size); // HACK(ASVP): why -1?
+		level->size_x = ceil_div_pow2(size_x, j);
+		level->size_y = ceil_div_pow2(size_y, j);
+		level->ring = malloc(sizeof(float) * 16 * level->size_x);
+		level->out = malloc(sizeof(float) * level->size_x);
+		level->tmp_dist = (calc_and_set_temp_size(level->size_x)+3) & ~3;
+		level->tmp = memalign(16, sizeof(float) * line->group * level->tmp_dist);
+
+		if( NULL == level->ring || NULL == level->out || NULL == level->tmp )
+		{
+			dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+			dwt_util_abort();
+		}
 	}
-#else /* microblaze */
-	// fallback
-	accel_lift_op4s_main_s(arr, steps, alpha, beta, gamma, delta, zeta, scaling);
-#endif /* microblaze */
 
-	FUNC_END;
+	return line;
 }
 
-static
-void accel_lift_op4s_prolog_s(
-	float *arr,
-	int off,
-	int N,
-	float alpha,
-	float beta,
-	float gamma,
-	float delta,
-	float zeta,
-	int scaling)
+void dwt_cdf97_2f_line_push_row_s(
+	struct dwt_cdf97_2f_line_s *line,
+	const float *row)
 {
-	assert( N-off >= 4 );
+	assert( NULL != line && NULL != row );
+	assert( line->pushed < line->size_y );
 
-#ifdef NDEBUG
-	UNUSED(N);
-#endif
+	// no decomposition, the row is final
+	if( 0 == line->levels )
+		line_queue_s(line, line->pushed, 0, line->size_x, row);
+	else
+		line_push_s(line, 0, row);
 
-	for(int w = 0; w < dwt_util_get_num_workers(); w++)
-	{
-		float *arr_local = calc_temp_offset_s(arr, w);
-		
-		if(off)
-		{
-			// inv-scaling
-			if( scaling < 0 )
-			{
-				// TODO
-			}
+	line->pushed++;
+}
 
-			// alpha
-			arr_local[1] += alpha*(arr_local[0]+arr_local[2]);
-			arr_local[3] += alpha*(arr_local[2]+arr_local[4]);
+int dwt_cdf97_2f_line_pull_rows_s(
+	struct dwt_cdf97_2f_line_s *line,
+	float *row,
+	int *y,
+	int *x)
+{
+	assert( NULL != line && NULL != row && NULL != y && NULL != x );
 
-			// beta
-			arr_local[0] += 2*beta*(arr_local[1]);
-			arr_local[2] += beta*(arr_local[1]+arr_local[3]);
-		
-			// gamma
-			arr_local[1] += gamma*(arr_local[0]+arr_local[2]);
-		
-			// delta
-			arr_local[0] += 2*delta*(arr_local[1]);
+	if( line->queue_head == line->queue_tail )
+		return 0;
 
-			// scaling
-			if( scaling > 0)
-			{
-				arr_local[0] *= zeta;
-			}
-		}
-		else
-		{
-			// inv-scaling
-			if( scaling < 0 )
-			{
-				arr_local[0] *= 1/zeta;
-				arr_local[1] *= zeta;
-				arr_local[2] *= 1/zeta;
-				arr_local[3] *= zeta;
-			}
+	struct dwt_cdf97_2f_line_row_s *head = &line->queue[line->queue_head++];
+	const int n = head->n;
 
-			// alpha
-			arr_local[0] += 2*alpha*(arr_local[1]);
-			arr_local[2] += alpha*(arr_local[1]+arr_local[3]);
-			
-			// beta
-			arr_local[1] += beta*(arr_local[0]+arr_local[2]);
-		
-			// gamma
-			arr_local[0] += 2*gamma*(arr_local[1]);
-		
-			// delta
-			// none
+	memcpy(row, head->data, sizeof(float) * n);
+	*y = head->y;
+	*x = head->x;
 
-			// scaling
-			// none
-		}
+	if( line->queue_head == line->queue_tail )
+	{
+		line->queue_head = 0;
+		line->queue_tail = 0;
+	}
+
+	return n;
+}
+
+void dwt_cdf97_2f_line_finish_s(
+	struct dwt_cdf97_2f_line_s *line)
+{
+	if( NULL == line )
+		return;
+
+	for(int i = 0; i < line->queue_size; i++)
+		free(line->queue[i].data);
+
+	for(int j = 0; j < line->levels; j++)
+	{
+		free(line->level[j].ring);
+		free(line->level[j].out);
+		free(line->level[j].tmp);
 	}
+
+	free(line->queue);
+	free(line->level);
+	free(line);
 }
 
+/**
+ * @brief All levels of forward 2-D CDF 9/7 transform in a single loop over rows.
+ *
+ * The image rows are pushed into the line-based transform (see
+ * dwt_cdf97_2f_line_init_s) which feeds the low-pass rows of each level
+ * into the next level as soon as they are final. Thus, the whole
+ * decomposition streams the image through the memory only once. The
+ * coefficients are written into their place when it has been read, the
+ * others are staged until then.
+ *
+ * @returns the number of decomposition levels
+ */
 static
-void accel_lift_op4s_epilog_s(
-	float *arr,
-	int off,
-	int N,
-	float alpha,
-	float beta,
-	float gamma,
-	float delta,
-	float zeta,
-	int scaling)
+int dwt_cdf97_2f_pyramid_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int j_max,
+	int decompose_one)
 {
-	assert( N-off >= 4 );
+	assert( (int)sizeof(float) == stride_y );
 
-	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+	struct dwt_cdf97_2f_line_s *line = dwt_cdf97_2f_line_init_s(size_x, size_y, &j_max, decompose_one);
+
+	// a row is staged only until it is read, i.e. less than a half of rows at once
+	const int slots = ceil_div2(size_y);
+
+	// a pulled row followed by the staged rows, allocated at once
+	float *row = malloc(sizeof(float) * (size_t)(1 + slots) * size_x);
+
+	// place of each row in the staged rows (-1 if not staged) and its staged columns
+	int *stage = malloc(sizeof(int) * size_y);
+	int *stage_x0 = malloc(sizeof(int) * size_y);
+	int *stage_x1 = malloc(sizeof(int) * size_y);
+	// unused places
+	int *unused = malloc(sizeof(int) * slots);
+
+	if( NULL == row || NULL == stage || NULL == stage_x0 || NULL == stage_x1 || NULL == unused )
 	{
-		float *arr_local = calc_temp_offset_s(arr, w);
+		dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+		dwt_util_abort();
+	}
 
-		if( is_even(N-off) )
-		{
-			// inv-scaling
-			if( scaling < 0 )
-			{
-				// TODO
-			}
+	for(int y = 0; y < size_y; y++)
+		stage[y] = -1;
 
-			// alpha
-			// none
+	int unused_count = 0;
 
-			// beta
-			arr_local[N-1] += 2*beta*(arr_local[N-2]);
+	for(int s = slots-1; s >= 0; s--)
+		unused[unused_count++] = s;
 
-			// gamma
-			arr_local[N-2] += gamma*(arr_local[N-1]+arr_local[N-3]);
+#define ROW(y) addr2_s(ptr,(y),0,stride_x,stride_y)
+#define SLOT(s) (row + (size_t)(1+(s))*size_x)
 
-			// delta
-			arr_local[N-1] += 2*delta*(arr_local[N-2]);
-			arr_local[N-3] += delta*(arr_local[N-4]+arr_local[N-2]);
+	for(int r = 0; r < size_y; r++)
+	{
+		dwt_cdf97_2f_line_push_row_s(line, ROW(r));
 
-			// scaling
-			if( scaling > 0 )
-			{
-				// FIXME: this is dependend on "off"
-				arr_local[N-4] *= 1/zeta;
-				arr_local[N-3] *= zeta;
-				arr_local[N-2] *= 1/zeta;
-				arr_local[N-1] *= zeta;
-			}
+		// the row has been read
+		if( stage[r] >= 0 )
+		{
+			memcpy(ROW(r) + stage_x0[r], SLOT(stage[r]) + stage_x0[r], sizeof(float) * (stage_x1[r]-stage_x0[r]));
+			unused[unused_count++] = stage[r];
+			stage[r] = -1;
 		}
-		else /* is_odd(N-off) */
+
+		int n, y, x;
+
+		while( (n = dwt_cdf97_2f_line_pull_rows_s(line, row, &y, &x)) )
 		{
-			// inv-scaling
-			if( scaling < 0 )
+			if( y <= r )
 			{
-				arr_local[N-1] *= 1/zeta;
+				memcpy(ROW(y) + x, row, sizeof(float) * n);
 			}
+			else
+			{
+				if( stage[y] < 0 )
+				{
+					assert( unused_count > 0 );
 
-			// alpha
-			arr_local[N-1] += 2*alpha*(arr_local[N-2]);
-
-			// beta
-			arr_local[N-2] += beta*(arr_local[N-1]+arr_local[N-3]);
-
-			// gamma
-			arr_local[N-1] += 2*gamma*(arr_local[N-2]);
-			arr_local[N-3] += gamma*(arr_local[N-2]+arr_local[N-4]);
-
-			// delta
-			arr_local[N-2] += delta*(arr_local[N-1]+arr_local[N-3]);
-			arr_local[N-4] += delta*(arr_local[N-5]+arr_local[N-3]);
+					stage[y] = unused[--unused_count];
+					stage_x0[y] = x;
+					stage_x1[y] = x + n;
+				}
 
-			// scaling
-			if( scaling > 0 )
-			{
-				// FIXME: this is dependend on "off"
-				arr_local[N-5] *= 1/zeta;
-				arr_local[N-4] *= zeta;
-				arr_local[N-3] *= 1/zeta;
-				arr_local[N-2] *= zeta;
-				arr_local[N-1] *= 1/zeta;
+				// the parts of a row are adjacent
+				memcpy(SLOT(stage[y]) + x, row, sizeof(float) * n);
+				stage_x0[y] = min(stage_x0[y], x);
+				stage_x1[y] = max(stage_x1[y], x + n);
 			}
 		}
 	}
+
+#undef SLOT
+#undef ROW
+
+	free(unused);
+	free(stage_x1);
+	free(stage_x0);
+	free(stage);
+	free(row);
+
+	dwt_cdf97_2f_line_finish_s(line);
+
+	return j_max;
 }
 
 /**
- * @brief Prolog and epilog for N-off < 4.
+ * @brief One level of the task-graph forward 2-D CDF 9/7 transform.
+ */
+struct dwt_cdf97_2f_task_level_s
+{
+	int size_x;		///< width of the level
+	int size_y;		///< height of the level
+	int tiles_x;		///< tiles in a row
+	int tiles_y;		///< tiles in a column
+	int first;		///< index of the first tile
+	float *in;		///< low-pass coefficients of the previous level
+	int pitch;		///< distance between rows of @p in (in elements)
+};
+
+/**
+ * @brief Tiles producing the low-pass rows (columns) @p ys to @p ye (exclusive) of the next level.
+ *
+ * Stores the range of these tiles into @p a0 and @p a1 (inclusive).
  */
 static
-void accel_lift_op4s_short_s(
-	float *arr,
-	int off,
+void tile_task_preds(
+	int ys,
+	int ye,
+	int tile,
+	int *a0,
+	int *a1)
+{
+	*a0 = ys / (tile/2);
+	*a1 = (ye-1) / (tile/2);
+}
+
+/**
+ * @brief Rows (columns) of the tile @p t read together with the halo.
+ */
+static
+void tile_task_reads(
+	int t,
+	int tile,
 	int N,
-	float alpha,
-	float beta,
-	float gamma,
-	float delta,
-	float zeta,
-	int scaling)
+	int *ys,
+	int *ye)
 {
-	assert( N-off < 4 );
+	*ys = max(t*tile-DWT_TILE_HALO, 0);
+	*ye = min((t+1)*tile+DWT_TILE_HALO, N);
+}
 
-	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+/**
+ * @brief Tiles of the next level reading the low-pass output of the tile @p t.
+ *
+ * The next level has @p N rows (columns) in @p tiles tiles. Stores the range
+ * of these tiles into @p b0 and @p b1 (inclusive).
+ */
+static
+void tile_task_succs(
+	int t,
+	int tile,
+	int N,
+	int tiles,
+	int *b0,
+	int *b1)
+{
+	*b0 = tiles;
+	*b1 = -1;
+
+	// the halo reaches at most one tile on each side
+	for(int b = max(t/2-1, 0); b <= min(t/2+1, tiles-1); b++)
 	{
-		float *arr_local = calc_temp_offset_s(arr, w);
+		int ys, ye, a0, a1;
 
-		if(off)
+		tile_task_reads(b, tile, N, &ys, &ye);
+		tile_task_preds(ys, ye, tile, &a0, &a1);
+
+		if( t >= a0 && t <= a1 )
 		{
-			if( N == 2 )
-			{
-				// inv-scaling
-				if( scaling < 0 )
-				{
-					// TODO
-				}
+			*b0 = min(*b0, b);
+			*b1 = max(*b1, b);
+		}
+	}
+}
 
-				// alpha
-				arr_local[1] += 2*alpha*(arr_local[0]);
+/**
+ * @brief Both passes of the tile @p ty, @p tx of the level @p j and the write of its coefficients.
+ */
+static
+void dwt_cdf97_2f_task_tile_s(
+	const struct dwt_cdf97_2f_task_level_s *level,
+	int levels,
+	int j,
+	int ty,
+	int tx,
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int tile,
+	int pitch,
+	float *block,
+	int tmp_dist,
+	int group)
+{
+	const struct dwt_cdf97_2f_task_level_s *l = &level[j];
 
-				// beta
-				arr_local[0] += 2*beta*(arr_local[1]);
+	const int size_dst_x = ceil_div2(l->size_x);
+	const int size_dst_y = ceil_div2(l->size_y);
 
-				// gamma
-				arr_local[1] += 2*gamma*(arr_local[0]);
+	const int x0 = tx*tile, x1 = min(x0+tile, l->size_x);
+	const int y0 = ty*tile, y1 = min(y0+tile, l->size_y);
 
-				// delta
-				arr_local[0] += 2*delta*(arr_local[1]);
+	int xs, xe, ys, ye;
 
-				// scaling
-				if( scaling > 0 )
-				{
-					arr_local[0] *= zeta;
-					arr_local[1] *= 1/zeta;
-				}
-			}
-			else
-			if( N == 3 )
-			{
-				// inv-scaling
-				if( scaling < 0 )
-				{
-					// TODO
-				}
+	tile_task_reads(tx, tile, l->size_x, &xs, &xe);
+	tile_task_reads(ty, tile, l->size_y, &ys, &ye);
 
-				// alpha
-				arr_local[1] += alpha*(arr_local[0]+arr_local[2]);
+	const int n = xe-xs;
+	const int m = ye-ys;
 
-				// beta
-				arr_local[0] += 2*beta*(arr_local[1]);
-				arr_local[2] += 2*beta*(arr_local[1]);
+	float *tmp = block + (tile+2*DWT_TILE_HALO)*pitch;
 
-				// gamma
-				arr_local[1] += gamma*(arr_local[0]+arr_local[2]);
+	for(int i = 0; i < m; i++)
+		memcpy(block + i*pitch, l->in + (ys+i)*l->pitch + xs, sizeof(float) * n);
 
-				// delta
-				arr_local[0] += 2*delta*(arr_local[1]);
-				arr_local[2] += 2*delta*(arr_local[1]);
+	dwt_cdf97_2f_block_s(block, tmp, tmp_dist, n, m, pitch, group);
 
-				// scaling
-				if( scaling > 0 )
-				{
-					arr_local[0] *= zeta;
-					arr_local[1] *= 1/zeta;
-					arr_local[2] *= zeta;
-				}
-			}
-			else /* N == 4 */
-			{
-				// inv-scaling
-				if( scaling < 0 )
-				{
-					// TODO
-				}
+	// interior of the tile
+	const int tile_l = ceil_div2(x1)-x0/2;
+	const int tile_h = floor_div2(x1)-x0/2;
+	const int band_l = ceil_div2(y1)-y0/2;
+	const int band_h = floor_div2(y1)-y0/2;
 
-				// alpha
-				arr_local[1] += alpha*(arr_local[0]+arr_local[2]);
-				arr_local[3] += 2*alpha*(arr_local[2]);
+#define ROW(y) addr2_s(ptr,(y),0,stride_x,stride_y)
 
-				// beta
-				arr_local[0] += 2*beta*(arr_local[1]);
-				arr_local[2] += beta*(arr_local[1]+arr_local[3]);
+	for(int k = 0; k < band_l; k++)
+	{
+		const float *row = block + ((y0-ys)/2 + k) * pitch;
 
-				// gamma
-				arr_local[1] += gamma*(arr_local[0]+arr_local[2]);
-				arr_local[3] += 2*gamma*(arr_local[2]);
+		// the low-pass coefficients are the input of the next level
+		float *ll = j+1 < levels ? level[j+1].in + (y0/2 + k)*level[j+1].pitch : ROW(y0/2 + k);
 
-				// delta
-				arr_local[0] += 2*delta*(arr_local[1]);
-				arr_local[2] += delta*(arr_local[1]+arr_local[3]);
+		memcpy(ll + x0/2, row + (x0-xs)/2, sizeof(float) * tile_l);
+		memcpy(ROW(y0/2 + k) + size_dst_x + x0/2, row + ceil_div2(n) + (x0-xs)/2, sizeof(float) * tile_h);
+	}
 
-				// scaling
-				if( scaling > 0 )
-				{
-					arr_local[0] *= zeta;
-					arr_local[1] *= 1/zeta;
-					arr_local[2] *= zeta;
-					arr_local[3] *= 1/zeta;
-				}
-			}
-		}
-		else /* !off */
-		{
-			if( N == 2 )
-			{
-				// inv-scaling
-				if( scaling < 0 )
-				{
-					arr_local[0] *= 1/zeta;
-					arr_local[1] *= zeta;
-				}
+	for(int k = 0; k < band_h; k++)
+	{
+		const float *row = block + (ceil_div2(m) + (y0-ys)/2 + k) * pitch;
 
-				// alpha
-				arr_local[0] += 2*alpha*(arr_local[1]);
+		memcpy(ROW(size_dst_y + y0/2 + k) + x0/2, row + (x0-xs)/2, sizeof(float) * tile_l);
+		memcpy(ROW(size_dst_y + y0/2 + k) + size_dst_x + x0/2, row + ceil_div2(n) + (x0-xs)/2, sizeof(float) * tile_h);
+	}
 
-				// beta
-				arr_local[1] += 2*beta*(arr_local[0]);
+#undef ROW
+}
 
-				// gamma
-				arr_local[0] += 2*gamma*(arr_local[1]);
+/**
+ * @brief Forward 2-D CDF 9/7 transform over a graph of tiles of all levels.
+ *
+ * Each level is cut into tiles processed as in the tiled strategy. The
+ * low-pass coefficients of each level are kept in a scratch pyramid, the
+ * other coefficients are written directly into their place. Thus, no tile
+ * overwrites coefficients which are still to be read, and a tile depends
+ * only on the tiles of the previous level producing its input including
+ * the halo. A tile is started as soon as these tiles are finished, so that
+ * the tiles of the following level start before the previous level is
+ * complete. There is no barrier between the passes or the levels, only the
+ * copy of the image into the scratch pyramid precedes the graph.
+ *
+ * The levels are transformed while both their sizes are at least two.
+ *
+ * @returns the number of decomposition levels
+ */
+static
+int dwt_cdf97_2f_task_s(
+	const void *src,
+	int src_stride_x,
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int j_max,
+	int tile,
+	int group)
+{
+	assert( (int)sizeof(float) == stride_y && is_even(tile) && tile >= 2*DWT_TILE_HALO );
 
-				// delta
-				arr_local[1] += 2*delta*(arr_local[0]);
+	int levels = 0;
+	while( levels < j_max && ceil_div_pow2(size_x, levels) >= 2 && ceil_div_pow2(size_y, levels) >= 2 )
+		levels++;
 
-				// scaling
-				if( scaling > 0 )
-				{
-					// TODO
-				}
-			}
-			else /* N == 3 */
-			{
-				// inv-scaling
-				if( scaling < 0 )
-				{
-					arr_local[0] *= 1/zeta;
-					arr_local[1] *= zeta;
-					arr_local[2] *= 1/zeta;
-				}
+	if( !levels )
+		return 0;
 
-				// alpha
-				arr_local[0] += 2*alpha*(arr_local[1]);
-				arr_local[2] += 2*alpha*(arr_local[1]);
+	struct dwt_cdf97_2f_task_level_s *level = malloc(sizeof(struct dwt_cdf97_2f_task_level_s) * levels);
+	if( NULL == level )
+	{
+		dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+		dwt_util_abort();
+	}
+
+	size_t scratch_size = 0;
+	int tasks = 0;
+
+	for(int j = 0; j < levels; j++)
+	{
+		struct dwt_cdf97_2f_task_level_s *l = &level[j];
+
+		l->size_x = ceil_div_pow2(size_x, j);
+		l->size_y = ceil_div_pow2(size_y, j);
+		l->tiles_x = ceil_div(l->size_x, tile);
+		l->tiles_y = ceil_div(l->size_y, tile);
+		l->first = tasks;
+		// preserves alignment on 16 bytes
+		l->pitch = (l->size_x+3) & ~3;
+
+		tasks += l->tiles_x * l->tiles_y;
+		scratch_size += (size_t)l->pitch * l->size_y;
+	}
+
+	float *scratch = memalign(16, sizeof(float) * scratch_size);
+	// unfinished tiles of the previous level each tile waits for
+	int *deps = malloc(sizeof(int) * tasks);
+	// stack of tiles ready to be started
+	int *ready = malloc(sizeof(int) * tasks);
+
+	if( NULL == scratch || NULL == deps || NULL == ready )
+	{
+		dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+		dwt_util_abort();
+	}
 
-				// beta
-				arr_local[1] += beta*(arr_local[0]+arr_local[2]);
+	for(int j = 0, offset = 0; j < levels; j++)
+	{
+		struct dwt_cdf97_2f_task_level_s *l = &level[j];
 
-				// gamma
-				arr_local[0] += 2*gamma*(arr_local[1]);
-				arr_local[2] += 2*gamma*(arr_local[1]);
+		l->in = scratch + offset;
+		offset += l->pitch * l->size_y;
 
-				// delta
-				arr_local[1] += delta*(arr_local[0]+arr_local[2]);
+		for(int ty = 0; ty < l->tiles_y; ty++)
+		{
+			for(int tx = 0; tx < l->tiles_x; tx++)
+			{
+				int *d = &deps[l->first + ty*l->tiles_x + tx];
 
-				// scaling
-				if( scaling > 0 )
+				if( 0 == j )
 				{
-					// TODO
+					*d = 0;
+					continue;
 				}
+
+				int xs, xe, ys, ye, ax0, ax1, ay0, ay1;
+
+				tile_task_reads(tx, tile, l->size_x, &xs, &xe);
+				tile_task_reads(ty, tile, l->size_y, &ys, &ye);
+				tile_task_preds(xs, xe, tile, &ax0, &ax1);
+				tile_task_preds(ys, ye, tile, &ay0, &ay1);
+
+				*d = (ax1-ax0+1) * (ay1-ay0+1);
 			}
 		}
 	}
-}
 
-static
-void accel_lift_op4s_s(
-	float *restrict arr,
-	int off,
-	int len,
-	float alpha,
-	float beta,
-	float gamma,
-	float delta,
-	float zeta,
-	int scaling)
-{
-	assert( len >= 2 );
-	assert( 0 == off || 1 == off );
+	// the tiles of the first level, the first one on the top
+	int top = 0;
+	for(int t = level[0].tiles_x * level[0].tiles_y - 1; t >= 0; t--)
+		ready[top++] = t;
 
-	if( len-off < 4 )
-	{
-		accel_lift_op4s_short_s(arr, off, len, alpha, beta, gamma, delta, zeta, scaling);
-	}
-	else
+	int done = 0;
+
+	// distance between rows of a tile, preserves alignment on 16 bytes
+	const int pitch = (tile + 2*DWT_TILE_HALO + 3) & ~3;
+	const int tmp_dist = (calc_and_set_temp_size(pitch)+3) & ~3;
+
+	#pragma omp parallel
 	{
-		accel_lift_op4s_prolog_s(arr, off, len, alpha, beta, gamma, delta, zeta, scaling);
+		float *block = memalign(16, sizeof(float) * ((tile+2*DWT_TILE_HALO)*pitch + max(group*tmp_dist, 16*pitch)));
+		if( NULL == block )
+		{
+			dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+			dwt_util_abort();
+		}
 
-		// FIXME: with GCC use (un)likely, i.e. __builtin_expect
-		if(1 == get_accel_type())
+		// the only barrier, at the end of the copy
+		#pragma omp for schedule(static)
+		for(int y = 0; y < size_y; y++)
+			memcpy(level[0].in + y*level[0].pitch, addr2_const_s(src,y,0,src_stride_x,stride_y), sizeof(float) * size_x);
+
+		for(;;)
 		{
-			const int max_inner_len = to_even(BANK_SIZE) - 4;
-			const int inner_len = to_even(len-off) - 4;
-			const int blocks = inner_len / max_inner_len;
+			int t = -1, finished = 0;
 
-			// full length blocks
-			for(int b = 0; b < blocks; b++)
+			#pragma omp critical(dwt_cdf97_2f_task_s)
 			{
-				const int left = off + b * max_inner_len;
-				const int steps = max_inner_len/2;
+				if( top > 0 )
+					t = ready[--top];
+				else
+					finished = done == tasks;
+			}
 
-				accel_lift_op4s_main_pb_s(&arr[left], steps, alpha, beta, gamma, delta, zeta, scaling);
+			if( finished )
+				break;
+			// wait for the tiles being processed by other threads
+			if( t < 0 )
+				continue;
+
+			int j = levels-1;
+			while( t < level[j].first )
+				j--;
+
+			const int ty = (t - level[j].first) / level[j].tiles_x;
+			const int tx = (t - level[j].first) % level[j].tiles_x;
+
+			dwt_cdf97_2f_task_tile_s(level, levels, j, ty, tx, ptr, stride_x, stride_y, tile, pitch, block, tmp_dist, group);
+
+			int bx0 = 0, bx1 = -1, by0 = 0, by1 = -1;
+
+			if( j+1 < levels )
+			{
+				tile_task_succs(tx, tile, level[j+1].size_x, level[j+1].tiles_x, &bx0, &bx1);
+				tile_task_succs(ty, tile, level[j+1].size_y, level[j+1].tiles_y, &by0, &by1);
 			}
 
-			// last block
-			if( blocks*max_inner_len < inner_len )
+			#pragma omp critical(dwt_cdf97_2f_task_s)
 			{
-				const int left = off + blocks * max_inner_len;
-				const int steps = (off + inner_len - left)/2;
+				for(int by = by0; by <= by1; by++)
+				{
+					for(int bx = bx0; bx <= bx1; bx++)
+					{
+						const int s = level[j+1].first + by*level[j+1].tiles_x + bx;
 
-				// TODO(ASVP): here should be a test if last block should be accelerated on PicoBlaze or rather computed on MicroBlaze
-				if( steps > 25 )
-					accel_lift_op4s_main_pb_s(&arr[left], steps, alpha, beta, gamma, delta, zeta, scaling);
-				else
-					accel_lift_op4s_main_s(&arr[left], steps, alpha, beta, gamma, delta, zeta, scaling);
+						if( 0 == --deps[s] )
+							ready[top++] = s;
+					}
+				}
+
+				done++;
 			}
 		}
-		else if(0 == get_accel_type())
-		{
-			accel_lift_op4s_main_s(arr+off, (to_even(len-off)-4)/2, alpha, beta, gamma, delta, zeta, scaling);
-		}
-		else if(2 == get_accel_type())
-		{
-			// empty
-		}
-		else if(3 == get_accel_type())
-		{
-			off = 0;
-			accel_lift_op4s_main_pb_s(arr+off, (to_even(len-off)-4)/2, alpha, beta, gamma, delta, zeta, scaling);
-		}
-		else if(4 == get_accel_type())
-		{
-			accel_lift_op4s_main_dl_s(arr+off, (to_even(len-off)-4)/2, alpha, beta, gamma, delta, zeta, scaling);
-		}
-		else if(5 == get_accel_type())
-		{
-			const int steps = (to_even(len-off)-4)/2;
 
-			if( steps < 3 )
-				accel_lift_op4s_main_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
-			else
-				accel_lift_op4s_main_sdl_ref_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
-		}
-		else if(6 == get_accel_type())
-		{
-			const int steps = (to_even(len-off)-4)/2;
+		free(block);
+	}
 
-			if( steps < 3 )
-				accel_lift_op4s_main_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
-			else
-				accel_lift_op4s_main_sdl2_ref_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
-		}
-		else if(7 == get_accel_type())
-		{
-			const int steps = (to_even(len-off)-4)/2;
+	free(ready);
+	free(deps);
+	free(scratch);
+	free(level);
 
-			if( steps < 3 )
-				accel_lift_op4s_main_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
-			else
-				accel_lift_op4s_main_sdl6_ref_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
-		}
-		else if(8 == get_accel_type())
-		{
-			const int steps = (to_even(len-off)-4)/2;
+	return levels;
+}
 
-			if( steps < 3 )
-				accel_lift_op4s_main_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
-			else
-#ifdef __SSE__
-				accel_lift_op4s_main_sdl2_sse_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
-#else
-				accel_lift_op4s_main_sdl2_ref_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
+static
+void dwt_cdf97_2f_core_s(
+	const void *src,
+	int src_stride_x,
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max_x,
+	int j_max_y,
+	int decompose_one,
+	int zero_padding)
+{
+	FUNC_BEGIN;
+
+#ifdef microblaze
+	dwt_util_switch_op(DWT_OP_LIFT4SA);
+	UNUSED(decompose_one);
 #endif
-		}
-		else if(9 == get_accel_type())
-		{
-			const int steps = (to_even(len-off)-4)/2;
+	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-			if( steps < 3 )
-				accel_lift_op4s_main_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
-			else
-#ifdef __SSE__
-				accel_lift_op4s_main_sdl6_sse_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
+	// rows (columns) lifted together
+	const int group = get_accel_group_s();
+
+#ifdef microblaze
+	#define TEMP_OFFSET 1
+	float *temp = dwt_util_allocate_vec_s(calc_and_set_temp_size(size_o_big_max));
+	if(NULL == temp)
+		abort(); // FIXME
+	const int temp_dist = 0; // groups are not used here
+	#define TEMP_ADDR temp
+	// blocks are simply iterated, see sched_next
+	struct dwt_workspace *workspace = NULL;
 #else
-				accel_lift_op4s_main_sdl6_ref_s(arr+off, steps, alpha, beta, gamma, delta, zeta, scaling);
+	#define TEMP_OFFSET 3
+	// distance between temporary signals of one group, preserves alignment on 16 bytes
+	const int temp_dist = (calc_and_set_temp_size(size_o_big_max)+3) & ~3;
+	// one slab per thread, allocated once if set by dwt_util_set_workspace
+	struct dwt_workspace *workspace = acquire_workspace(size_o_big_max);
+	#define TEMP_ADDR workspace_temp_s(workspace)
+
+	if( !is_aligned_16(workspace_temp_s(workspace)) )
+		dwt_util_abort();
 #endif
-		}
-		else
-		{
-			dwt_util_log(LOG_ERR, "Unsupported value of acceleration.\n");
 
-			dwt_util_abort();
-		}
+	int j = 0;
 
-		accel_lift_op4s_epilog_s(arr, off, len, alpha, beta, gamma, delta, zeta, scaling);
+	// the copy is fused only into the horizontal pass of the row and column strategies
+#ifndef microblaze
+	// the graph of tiles copies the source into its scratch pyramid
+	const int task = DWT_VERT_TASK == get_vert_type(stride_y) && j_max_x == j_max_y && size_o_big_x == size_i_big_x && size_o_big_y == size_i_big_y;
+
+	if( src != ptr && (0 == j_max_x || (!task && (
+		   DWT_VERT_TILE == get_vert_type(stride_y)
+		|| DWT_VERT_SINGLE == get_vert_type(stride_y)
+		|| DWT_VERT_PYRAMID == get_vert_type(stride_y)
+		|| DWT_VERT_TASK == get_vert_type(stride_y)))) )
+#else
+	if( src != ptr )
+#endif
+	{
+		for(int y = 0; y < size_i_big_y; y++)
+			dwt_util_memcpy_stride_s(
+				addr2_s(ptr,y,0,stride_x,stride_y),
+				stride_y,
+				addr2_const_s(src,y,0,src_stride_x,stride_y),
+				stride_y,
+				size_i_big_x);
+
+		src = ptr;
+		src_stride_x = stride_x;
 	}
-}
 
-void dwt_cdf97_f_ex_stride_s(
-	const float *src,
-	float *dst_l,
-	float *dst_h,
-	float *tmp,
-	int N,
-	int stride)
-{
-	assert( N >= 0 && NULL != src && NULL != dst_l && NULL != dst_h && NULL != tmp && 0 != stride );
+#ifndef microblaze
+	// all levels are fused into a single loop over rows
+	if( DWT_VERT_PYRAMID == get_vert_type(stride_y) && j_max_x == j_max_y && size_o_big_x == size_i_big_x && size_o_big_y == size_i_big_y )
+		j = dwt_cdf97_2f_pyramid_s(ptr, stride_x, stride_y, size_i_big_x, size_i_big_y, j_max_x, decompose_one);
 
-	// fix for small N
-	if(N < 2)
+	// tiles of all levels are started as soon as their input is final
+	if( task )
+		j = dwt_cdf97_2f_task_s(src, src_stride_x, ptr, stride_x, stride_y, size_i_big_x, size_i_big_y, j_max_x, get_tile_size(), group);
+
+	// subsequent levels are in place
+	if( j > 0 )
 	{
-		if(1 == N)
-			dst_l[0] = src[0] * dwt_cdf97_s1_s;
-		return;
+		src = ptr;
+		src_stride_x = stride_x;
 	}
+#endif
 
-	// copy src into tmp
-	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+	// the deepest levels do not pay for the synchronization of the team, see get_level_threads
+	int j_team = j;
+	while( j_team < max(j_max_x, j_max_y) && get_level_threads(ceil_div_pow2(size_o_big_x, min(j_team, j_max_x)), ceil_div_pow2(size_o_big_y, min(j_team, j_max_y))) > 1 )
+		j_team++;
+
+	// the levels of the team first, then the rest serially
+	for(int team = 1; team >= 0; team--)
 	{
-		float *tmp_local = calc_temp_offset_s(tmp, w);
-		const float *src_local = calc_data_offset_const_s(src, w);
+		const int j_end = team ? j_team : max(j_max_x, j_max_y);
 
-		if( is_valid_data_step_s( src_local ) )
+		// one team for all levels, separated only by the barriers of the passes
+		#pragma omp parallel if(team) firstprivate(j, src, src_stride_x)
+		for(;;)
 		{
-			dwt_util_memcpy_stride_s(tmp_local, sizeof(float), src_local, stride, N);
-		}
-	}
+			if( j_end == j )
+				break;
+
+			const int size_o_src_x = ceil_div_pow2(size_o_big_x, min(j,   j_max_x));
+			const int size_o_src_y = ceil_div_pow2(size_o_big_y, min(j,   j_max_y));
+			const int size_o_dst_x = ceil_div_pow2(size_o_big_x, min(j+1, j_max_x));
+			const int size_o_dst_y = ceil_div_pow2(size_o_big_y, min(j+1, j_max_y));
+			const int size_i_src_x = ceil_div_pow2(size_i_big_x, min(j,   j_max_x));
+			const int size_i_src_y = ceil_div_pow2(size_i_big_y, min(j,   j_max_y));
+			// threads taking part in the passes of this level
+			const int threads = get_level_threads(size_o_src_x, size_o_src_y);
+
+			const int workers_segment_y = ceil_div(size_o_src_y, dwt_util_get_num_workers());
+			const int workers_segment_x = ceil_div(size_o_src_x, dwt_util_get_num_workers());
+			// only rows of the nested image are read from the source
+			const int rows_y = src != ptr ? size_i_src_y : workers_segment_y;
 
-	accel_lift_op4s_s(tmp, 1, N, -dwt_cdf97_p1_s, dwt_cdf97_u1_s, -dwt_cdf97_p2_s, dwt_cdf97_u2_s, dwt_cdf97_s1_s, +1);
+#ifdef microblaze
+			set_data_step_s( (intptr_t)addr2_s(ptr,workers_segment_y,0,stride_x,stride_y) - (intptr_t)addr2_s(ptr,0,0,stride_x,stride_y) );
+			set_data_limit_s( addr2_s(ptr,size_o_src_y,0,stride_x,stride_y) );
+#endif
+#ifndef microblaze
+			const enum dwt_vert vert = get_vert_type_level(stride_x, stride_y, size_i_src_y);
+			// tiles are worth only for images without padding exceeding a tile
+			const int tiled = (DWT_VERT_TILE == vert || DWT_VERT_TASK == vert) && j < j_max_x && j < j_max_y
+				&& size_o_src_x == size_i_src_x && size_o_src_y == size_i_src_y
+				&& !get_short_s(size_i_src_x) && !get_short_s(size_i_src_y)
+				&& max(size_i_src_x, size_i_src_y) > get_tile_size();
+			// the single-loop approach also needs both passes
+			const int single = (DWT_VERT_SINGLE == vert || DWT_VERT_PYRAMID == vert) && j < j_max_x && j < j_max_y && size_i_src_y >= 2;
+#endif
 
-	// copy tmp into dst
-	for(int w = 0; w < dwt_util_get_num_workers(); w++)
-	{
-		float *tmp_local = calc_temp_offset_s(tmp, w);
-		float *dst_l_local = calc_data_offset_s(dst_l, w);
-		float *dst_h_local = calc_data_offset_s(dst_h, w);
+			// no horizontal pass on this level
+			if( j >= j_max_x )
+			{
+			}
+			else
+#ifndef microblaze
+			// both passes are applied tile by tile
+			if( tiled )
+			{
+				dwt_cdf97_2f_tile_s(
+					ptr,
+					stride_x,
+					stride_y,
+					size_i_src_x,
+					size_i_src_y,
+					get_tile_size(),
+					group);
+			}
+			// both passes are fused into a single loop over rows
+			else if( single )
+			{
+				#pragma omp single
+				dwt_cdf97_2f_single_s(
+					ptr,
+					stride_x,
+					stride_y,
+					size_o_src_x,
+					size_o_src_y,
+					size_o_dst_x,
+					size_o_dst_y,
+					size_i_src_x,
+					size_i_src_y,
+					workspace_temp_s(workspace) + TEMP_OFFSET,
+					temp_dist,
+					group);
+			}
+			// short rows are lifted together across the rows
+			else if( get_short_s(size_i_src_x) && size_i_src_x >= 2 )
+			{
+				const int batch = get_short_s(size_i_src_x);
+
+				for(int y = sched_next(workspace, threads, -1, rows_y, batch); y >= 0; y = sched_next(workspace, threads, y, rows_y, batch))
+				{
+					float *block = workspace_block_s(workspace);
+
+					dwt_cdf97_f_ex_stride_short_s(
+						addr2_const_s(src,y,0,src_stride_x,stride_y),
+						addr2_s(ptr,y,0,stride_x,stride_y),
+						addr2_s(ptr,y,size_o_dst_x,stride_x,stride_y),
+						block,
+						size_i_src_x,
+						stride_y,
+						min(batch, rows_y-y),
+						stride_x,
+						src_stride_x);
+				}
+				#pragma omp barrier
+			}
+			else
+#endif
+			{
+				for(int y = sched_next(workspace, threads, -1, rows_y, group); y >= 0; y = sched_next(workspace, threads, y, rows_y, group))
+					dwt_cdf97_f_ex_stride_group_s(
+						addr2_const_s(src,y,0,src_stride_x,stride_y),
+						addr2_s(ptr,y,0,stride_x,stride_y),
+						addr2_s(ptr,y,size_o_dst_x,stride_x,stride_y),
+						TEMP_ADDR + TEMP_OFFSET,
+						temp_dist,
+						size_i_src_x,
+						stride_y,
+						min(group, rows_y-y),
+						stride_x,
+						src_stride_x);
+				#pragma omp barrier
+			}
+#ifdef microblaze
+			set_data_step_s( (intptr_t)addr2_s(ptr,0,workers_segment_x,stride_x,stride_y) - (intptr_t)addr2_s(ptr,0,0,stride_x,stride_y) );
+			set_data_limit_s( addr2_s(ptr,0,size_o_src_x,stride_x,stride_y) );
+#endif
+			// no vertical pass on this level
+			if( j >= j_max_y )
+			{
+			}
+			else
+#ifndef microblaze
+			// already done together with the horizontal pass
+			if( tiled || single )
+			{
+			}
+			// adjacent columns are lifted together, also on images not worth tiling
+			else if( (DWT_VERT_BLOCK == vert || DWT_VERT_TILE == vert || DWT_VERT_TASK == vert) && size_i_src_y >= 2 )
+			{
+				const int cols = get_cols_s(size_i_src_y);
+
+				for(int x = sched_next(workspace, threads, -1, size_o_src_x, cols); x >= 0; x = sched_next(workspace, threads, x, size_o_src_x, cols))
+				{
+					float *block = workspace_block_s(workspace);
+
+					dwt_cdf97_f_ex_stride_cols_s(
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,size_o_dst_y,x,stride_x,stride_y),
+						block,
+						size_i_src_y,
+						stride_x,
+						min(cols, size_o_src_x-x));
+				}
+				#pragma omp barrier
+			}
+			// adjacent columns are transposed into rows and lifted by the horizontal kernels
+			else if( DWT_VERT_TRANSPOSE == vert && size_i_src_y >= 2 )
+			{
+				const int transpose_dist = get_transpose_dist_s(temp_dist);
+				const int cols = get_transpose_cols_s(workspace, transpose_dist);
+
+				for(int x = sched_next(workspace, threads, -1, size_o_src_x, cols); x >= 0; x = sched_next(workspace, threads, x, size_o_src_x, cols))
+				{
+					dwt_cdf97_f_ex_stride_transpose_s(
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,size_o_dst_y,x,stride_x,stride_y),
+						workspace_temp_s(workspace) + TEMP_OFFSET,
+						transpose_dist,
+						size_i_src_y,
+						stride_x,
+						min(cols, size_o_src_x-x),
+						group);
+				}
+				#pragma omp barrier
+			}
+			// lifting steps are applied on whole rows
+			else if( DWT_VERT_ROW == vert && size_i_src_y >= 2 )
+			{
+				// a few wide blocks per thread, whole blocks are stolen
+				const int chunk = (ceil_div(size_o_src_x, 4 * threads) + 15) & ~15;
+
+				for(int x = sched_next(workspace, threads, -1, size_o_src_x, chunk); x >= 0; x = sched_next(workspace, threads, x, size_o_src_x, chunk))
+				{
+					const int cols = min(chunk, size_o_src_x-x);
+
+					float *rows = workspace_rows_s(workspace, (size_t)floor_div2(size_i_src_y) * cols);
+
+					dwt_cdf97_f_ex_rows_s(
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,size_o_dst_y,x,stride_x,stride_y),
+						rows,
+						size_i_src_y,
+						stride_x,
+						cols);
+				}
+				#pragma omp barrier
+			}
+			// short columns are lifted together across the columns
+			else if( get_short_s(size_i_src_y) && size_i_src_y >= 2 )
+			{
+				const int batch = get_short_s(size_i_src_y);
+
+				for(int x = sched_next(workspace, threads, -1, size_o_src_x, batch); x >= 0; x = sched_next(workspace, threads, x, size_o_src_x, batch))
+				{
+					float *block = workspace_block_s(workspace);
+
+					dwt_cdf97_f_ex_stride_short_s(
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,size_o_dst_y,x,stride_x,stride_y),
+						block,
+						size_i_src_y,
+						stride_x,
+						min(batch, size_o_src_x-x),
+						stride_y,
+						stride_y);
+				}
+				#pragma omp barrier
+			}
+			else
+#endif
+			{
+				for(int x = sched_next(workspace, threads, -1, workers_segment_x, group); x >= 0; x = sched_next(workspace, threads, x, workers_segment_x, group))
+					dwt_cdf97_f_ex_stride_group_s(
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,size_o_dst_y,x,stride_x,stride_y),
+						TEMP_ADDR + TEMP_OFFSET,
+						temp_dist,
+						size_i_src_y,
+						stride_x,
+						min(group, workers_segment_x-x),
+						stride_y,
+						stride_y);
+				#pragma omp barrier
+			}
+
+			if(zero_padding)
+				dwt_zero_padding_2f_s(
+					ptr,
+					stride_x,
+					stride_y,
+					size_o_src_x,
+					size_o_src_y,
+					size_o_dst_x,
+					size_o_dst_y,
+					size_i_src_x,
+					size_i_src_y);
 
-		if( is_valid_data_step_s( dst_l_local ) )
-		{
-			dwt_util_memcpy_stride_s(dst_l_local, stride, tmp_local+0, 2*sizeof(float),  ceil_div2(N));
-			dwt_util_memcpy_stride_s(dst_h_local, stride, tmp_local+1, 2*sizeof(float), floor_div2(N));
+			// subsequent levels are in place
+			src = ptr;
+			src_stride_x = stride_x;
+
+			j++;
 		}
-	}
-}
 
-void dwt_cdf53_f_ex_stride_s(
-	const float *src,
-	float *dst_l,
-	float *dst_h,
-	float *tmp,
-	int N,
-	int stride)
-{
-	assert( N >= 0 && NULL != src && NULL != dst_l && NULL != dst_h && NULL != tmp && 0 != stride );
+		// subsequent levels are in place
+		if( j_end > j )
+		{
+			src = ptr;
+			src_stride_x = stride_x;
+		}
 
-	// fix for small N
-	if(N < 2)
-	{
-		if(1 == N)
-			dst_l[0] = src[0] * dwt_cdf53_s1_s;
-		return;
+		j = j_end;
 	}
 
-	// copy src into tmp
-	dwt_util_memcpy_stride_s(tmp, sizeof(float), src, stride, N);
-
-	// predict 1 + update 1
-	for(int i=1; i<N-2+(N&1); i+=2)
-		tmp[i] -= dwt_cdf53_p1_s * (tmp[i-1] + tmp[i+1]);
+#undef TEMP_OFFSET
+#undef TEMP_ADDR
+#ifdef microblaze
+	free(temp);
+#else
+	release_workspace(workspace);
+#endif
 
-	if(is_odd(N))
-		tmp[N-1] += 2 * dwt_cdf53_u1_s * tmp[N-2];
-	else
-		tmp[N-1] -= 2 * dwt_cdf53_p1_s * tmp[N-2];
+	FUNC_END;
+}
 
-	tmp[0] += 2 * dwt_cdf53_u1_s * tmp[1];
+void dwt_cdf97_2f_ex_s(
+	const void *src,
+	int src_stride_x,
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int *j_max_ptr,
+	int decompose_one,
+	int zero_padding)
+{
+	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
+	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-	for(int i=2; i<N-(N&1); i+=2)
-		tmp[i] += dwt_cdf53_u1_s * (tmp[i-1] + tmp[i+1]);
+	const int j_limit = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
 
-	// scale
-	for(int i=0; i<N; i+=2)
-		tmp[i] = tmp[i] * dwt_cdf53_s1_s;
-	for(int i=1; i<N; i+=2)
-		tmp[i] = tmp[i] * dwt_cdf53_s2_s;
+	if( *j_max_ptr < 0 || *j_max_ptr > j_limit )
+		*j_max_ptr = j_limit;
 
-	// copy tmp into dst
-	dwt_util_memcpy_stride_s(dst_l, stride, tmp+0, 2*sizeof(float),  ceil_div2(N));
-	dwt_util_memcpy_stride_s(dst_h, stride, tmp+1, 2*sizeof(float), floor_div2(N));
+	dwt_cdf97_2f_core_s(
+		src,
+		src_stride_x,
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		*j_max_ptr,
+		*j_max_ptr,
+		decompose_one,
+		zero_padding);
 }
 
-void dwt_cdf97_i_ex_d(
-	const double *src_l,
-	const double *src_h,
-	double *dst,
-	double *tmp,
-	int N)
+void dwt_cdf97_2f_aniso_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int *j_max_x_ptr,
+	int *j_max_y_ptr,
+	int zero_padding)
 {
-	dwt_cdf97_i_ex_stride_d(
-		src_l,
-		src_h,
-		dst,
-		tmp,
-		N,
-		sizeof(double)
-	);
-}
+	const int j_limit_x = ceil_log2(size_o_big_x);
+	const int j_limit_y = ceil_log2(size_o_big_y);
 
-void dwt_cdf53_i_ex_d(
-	const double *src_l,
-	const double *src_h,
-	double *dst,
-	double *tmp,
-	int N)
-{
-	dwt_cdf53_i_ex_stride_d(
-		src_l,
-		src_h,
-		dst,
-		tmp,
-		N,
-		sizeof(double)
-	);
-}
+	if( *j_max_x_ptr < 0 || *j_max_x_ptr > j_limit_x )
+		*j_max_x_ptr = j_limit_x;
+	if( *j_max_y_ptr < 0 || *j_max_y_ptr > j_limit_y )
+		*j_max_y_ptr = j_limit_y;
 
-void dwt_cdf97_i_ex_s(
-	const float *src_l,
-	const float *src_h,
-	float *dst,
-	float *tmp,
-	int N)
-{
-	dwt_cdf97_i_ex_stride_s(
-		src_l,
-		src_h,
-		dst,
-		tmp,
-		N,
-		sizeof(float)
-	);
+	dwt_cdf97_2f_core_s(
+		ptr,
+		stride_x,
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		*j_max_x_ptr,
+		*j_max_y_ptr,
+		0,
+		zero_padding);
 }
 
-void dwt_cdf53_i_ex_s(
-	const float *src_l,
-	const float *src_h,
-	float *dst,
-	float *tmp,
-	int N)
+void dwt_cdf97_2f_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int *j_max_ptr,
+	int decompose_one,
+	int zero_padding)
 {
-	dwt_cdf53_i_ex_stride_s(
-		src_l,
-		src_h,
-		dst,
-		tmp,
-		N,
-		sizeof(float)
-	);
+	dwt_cdf97_2f_ex_s(
+		ptr,
+		stride_x,
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j_max_ptr,
+		decompose_one,
+		zero_padding);
 }
 
-void dwt_cdf97_i_ex_stride_d(
-	const double *src_l,
-	const double *src_h,
-	double *dst,
-	double *tmp,
-	int N,
-	int stride)
+static
+void dwt_cdf53_2f_core_s(
+	const void *src,
+	int src_stride_x,
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max_x,
+	int j_max_y,
+	int zero_padding)
 {
-	assert( N >= 0 && NULL != src_l && NULL != src_h && NULL != dst && NULL != tmp && 0 != stride );
-
-	// fix for small N
-	if(N < 2)
-	{
-		if(1 == N)
-			dst[0] = src_l[0] * dwt_cdf97_s2_d;
-		return;
-	}
-
-	// copy src into tmp
-	dwt_util_memcpy_stride_d(tmp+0, 2*sizeof(double), src_l, stride,  ceil_div2(N));
-	dwt_util_memcpy_stride_d(tmp+1, 2*sizeof(double), src_h, stride, floor_div2(N));
+	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-	// inverse scale
-	for(int i=0; i<N; i+=2)
-		tmp[i] = tmp[i] * dwt_cdf97_s2_d;
-	for(int i=1; i<N; i+=2)
-		tmp[i] = tmp[i] * dwt_cdf97_s1_d;
+	struct dwt_workspace *workspace = acquire_workspace(size_o_big_max);
 
-	// backward update 2 + backward predict 2
-	for(int i=2; i<N-(N&1); i+=2)
-		tmp[i] -= dwt_cdf97_u2_d * (tmp[i-1] + tmp[i+1]);
+	int j = 0;
 
-	tmp[0] -= 2 * dwt_cdf97_u2_d * tmp[1];
+	// no horizontal pass to fuse the copy into
+	if( src != ptr && 0 == j_max_x )
+	{
+		for(int y = 0; y < size_i_big_y; y++)
+			dwt_util_memcpy_stride_s(
+				addr2_s(ptr,y,0,stride_x,stride_y),
+				stride_y,
+				addr2_const_s(src,y,0,src_stride_x,stride_y),
+				stride_y,
+				size_i_big_x);
+	}
 
-	if(is_odd(N))
-		tmp[N-1] -= 2 * dwt_cdf97_u2_d * tmp[N-2];
-	else
-		tmp[N-1] += 2 * dwt_cdf97_p2_d * tmp[N-2];
+	// one team for all levels, separated only by the barriers of the work-sharing loops
+	#pragma omp parallel firstprivate(j, src, src_stride_x)
+	for(;;)
+	{
+		if( max(j_max_x, j_max_y) == j )
+			break;
 
-	for(int i=1; i<N-2+(N&1); i+=2)
-		tmp[i] += dwt_cdf97_p2_d * (tmp[i-1] + tmp[i+1]);
+		const int size_o_src_x = ceil_div_pow2(size_o_big_x, min(j,   j_max_x));
+		const int size_o_src_y = ceil_div_pow2(size_o_big_y, min(j,   j_max_y));
+		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, min(j+1, j_max_x));
+		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, min(j+1, j_max_y));
+		const int size_i_src_x = ceil_div_pow2(size_i_big_x, min(j,   j_max_x));
+		const int size_i_src_y = ceil_div_pow2(size_i_big_y, min(j,   j_max_y));
+		// only rows of the nested image are read from the source
+		const int rows_y = src != ptr ? size_i_src_y : size_o_src_y;
 
-	// backward update 1 + backward predict 1
-	for(int i=2; i<N-(N&1); i+=2)
-		tmp[i] -= dwt_cdf97_u1_d * (tmp[i-1] + tmp[i+1]);
+		if( j < j_max_x )
+		{
+			#pragma omp for schedule(static, ceil_div(rows_y, omp_get_num_threads()))
+			for(int y = 0; y < rows_y; y++)
+				dwt_cdf53_f_ex_stride_s(
+					addr2_const_s(src,y,0,src_stride_x,stride_y),
+					addr2_s(ptr,y,0,stride_x,stride_y),
+					addr2_s(ptr,y,size_o_dst_x,stride_x,stride_y),
+					workspace_temp_s(workspace),
+					size_i_src_x,
+					stride_y);
+		}
+		if( j < j_max_y )
+		{
+			#pragma omp for schedule(static, ceil_div(size_o_src_x, omp_get_num_threads()))
+			for(int x = 0; x < size_o_src_x; x++)
+				dwt_cdf53_f_ex_stride_s(
+					addr2_s(ptr,0,x,stride_x,stride_y),
+					addr2_s(ptr,0,x,stride_x,stride_y),
+					addr2_s(ptr,size_o_dst_y,x,stride_x,stride_y),
+					workspace_temp_s(workspace),
+					size_i_src_y,
+					stride_x);
+		}
 
-	tmp[0] -= 2 * dwt_cdf97_u1_d * tmp[1];
+		if(zero_padding)
+			dwt_zero_padding_2f_s(
+				ptr,
+				stride_x,
+				stride_y,
+				size_o_src_x,
+				size_o_src_y,
+				size_o_dst_x,
+				size_o_dst_y,
+				size_i_src_x,
+				size_i_src_y);
 
-	if(is_odd(N))
-		tmp[N-1] -= 2 * dwt_cdf97_u1_d * tmp[N-2];
-	else
-		tmp[N-1] += 2 * dwt_cdf97_p1_d * tmp[N-2];
+		// subsequent levels are in place
+		src = ptr;
+		src_stride_x = stride_x;
 
-	for(int i=1; i<N-2+(N&1); i+=2)
-		tmp[i] += dwt_cdf97_p1_d * (tmp[i-1] + tmp[i+1]);
+		j++;
+	}
 
-	// copy tmp into dst
-	dwt_util_memcpy_stride_d(dst, stride, tmp, sizeof(double), N);
+	release_workspace(workspace);
 }
 
-void dwt_cdf53_i_ex_stride_d(
-	const double *src_l,
-	const double *src_h,
-	double *dst,
-	double *tmp,
-	int N,
-	int stride)
+void dwt_cdf53_2f_ex_s(
+	const void *src,
+	int src_stride_x,
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int *j_max_ptr,
+	int decompose_one,
+	int zero_padding)
 {
-	assert( N >= 0 && NULL != src_l && NULL != src_h && NULL != dst && NULL != tmp && 0 != stride );
-
-	// fix for small N
-	if(N < 2)
-	{
-		if(1 == N)
-			dst[0] = src_l[0] * dwt_cdf53_s2_d;
-		return;
-	}
+	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
+	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-	// copy src into tmp
-	dwt_util_memcpy_stride_d(tmp+0, 2*sizeof(double), src_l, stride,  ceil_div2(N));
-	dwt_util_memcpy_stride_d(tmp+1, 2*sizeof(double), src_h, stride, floor_div2(N));
+	const int j_limit = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
 
-	// inverse scale
-	for(int i=0; i<N; i+=2)
-		tmp[i] = tmp[i] * dwt_cdf53_s2_d;
-	for(int i=1; i<N; i+=2)
-		tmp[i] = tmp[i] * dwt_cdf53_s1_d;
+	if( *j_max_ptr < 0 || *j_max_ptr > j_limit )
+		*j_max_ptr = j_limit;
 
-	// backward update 1 + backward predict 1
-	for(int i=2; i<N-(N&1); i+=2)
-		tmp[i] -= dwt_cdf53_u1_d * (tmp[i-1] + tmp[i+1]);
+	dwt_cdf53_2f_core_s(
+		src,
+		src_stride_x,
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		*j_max_ptr,
+		*j_max_ptr,
+		zero_padding);
+}
 
-	tmp[0] -= 2 * dwt_cdf53_u1_d * tmp[1];
+void dwt_cdf53_2f_aniso_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int *j_max_x_ptr,
+	int *j_max_y_ptr,
+	int zero_padding)
+{
+	const int j_limit_x = ceil_log2(size_o_big_x);
+	const int j_limit_y = ceil_log2(size_o_big_y);
 
-	if(is_odd(N))
-		tmp[N-1] -= 2 * dwt_cdf53_u1_d * tmp[N-2];
-	else
-		tmp[N-1] += 2 * dwt_cdf53_p1_d * tmp[N-2];
+	if( *j_max_x_ptr < 0 || *j_max_x_ptr > j_limit_x )
+		*j_max_x_ptr = j_limit_x;
+	if( *j_max_y_ptr < 0 || *j_max_y_ptr > j_limit_y )
+		*j_max_y_ptr = j_limit_y;
 
-	for(int i=1; i<N-2+(N&1); i+=2)
-		tmp[i] += dwt_cdf53_p1_d * (tmp[i-1] + tmp[i+1]);
+	dwt_cdf53_2f_core_s(
+		ptr,
+		stride_x,
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		*j_max_x_ptr,
+		*j_max_y_ptr,
+		zero_padding);
+}
 
-	// copy tmp into dst
-	dwt_util_memcpy_stride_d(dst, stride, tmp, sizeof(double), N);
+void dwt_cdf53_2f_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int *j_max_ptr,
+	int decompose_one,
+	int zero_padding)
+{
+	dwt_cdf53_2f_ex_s(
+		ptr,
+		stride_x,
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j_max_ptr,
+		decompose_one,
+		zero_padding);
 }
 
-void dwt_cdf97_i_ex_stride_s(
-	const float *src_l,
-	const float *src_h,
-	float *dst,
-	float *tmp,
-	int N,
-	int stride)
+static
+void dwt_cdf97_2i_core_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max_x,
+	int j_max_y,
+	int zero_padding)
 {
-	assert( N >= 0 && NULL != src_l && NULL != src_h && NULL != dst && NULL != tmp && 0 != stride );
+	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-	// fix for small N
-	if(N < 2)
-	{
-		if(1 == N)
-			dst[0] = src_l[0] * dwt_cdf97_s2_s; // FIXME: 1/zeta
-		return;
-	}
+	struct dwt_workspace *workspace = acquire_workspace(size_o_big_max);
 
-	// copy src into tmp
-	for(int w = 0; w < dwt_util_get_num_workers(); w++)
+	int j = max(j_max_x, j_max_y);
+
+	// one team for all levels, separated only by the barriers of the work-sharing loops
+	#pragma omp parallel firstprivate(j)
+	for(;;)
 	{
-		float *tmp_local = calc_temp_offset_s(tmp, w);
-		const float *src_l_local = calc_data_offset_const_s(src_l, w);
-		const float *src_h_local = calc_data_offset_const_s(src_h, w);
+		if(0 == j)
+			break;
 
-		if( is_valid_data_step_s(src_l_local) )
+		const int size_o_src_x = ceil_div_pow2(size_o_big_x, min(j,   j_max_x));
+		const int size_o_src_y = ceil_div_pow2(size_o_big_y, min(j,   j_max_y));
+		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, min(j-1, j_max_x));
+		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, min(j-1, j_max_y));
+		const int size_i_dst_x = ceil_div_pow2(size_i_big_x, min(j-1, j_max_x));
+		const int size_i_dst_y = ceil_div_pow2(size_i_big_y, min(j-1, j_max_y));
+
+		if( j <= j_max_x )
 		{
-			dwt_util_memcpy_stride_s(tmp_local+0, 2*sizeof(float), src_l_local, stride,  ceil_div2(N));
-			dwt_util_memcpy_stride_s(tmp_local+1, 2*sizeof(float), src_h_local, stride, floor_div2(N));
+			#pragma omp for schedule(static, ceil_div(size_o_dst_y, omp_get_num_threads()))
+			for(int y = 0; y < size_o_dst_y; y++)
+				dwt_cdf97_i_ex_stride_d(
+					addr2_d(ptr,y,0,stride_x,stride_y),
+					addr2_d(ptr,y,size_o_src_x,stride_x,stride_y),
+					addr2_d(ptr,y,0,stride_x,stride_y),
+					workspace_temp_d(workspace),
+					size_i_dst_x,
+					stride_y);
 		}
-	}
-
-	accel_lift_op4s_s(tmp, 0, N, -dwt_cdf97_u2_s, dwt_cdf97_p2_s, -dwt_cdf97_u1_s, dwt_cdf97_p1_s, dwt_cdf97_s1_s, -1);
-
-	// copy tmp into dst
-	for(int w = 0; w < dwt_util_get_num_workers(); w++)
-	{
-		float *tmp_local = calc_temp_offset_s(tmp, w);
-		float *dst_local = calc_data_offset_s(dst, w);
-
-		if( is_valid_data_step_s(dst_local) )
+		if( j <= j_max_y )
 		{
-			dwt_util_memcpy_stride_s(dst_local, stride, tmp_local, sizeof(float), N);
+			#pragma omp for schedule(static, ceil_div(size_o_dst_x, omp_get_num_threads()))
+			for(int x = 0; x < size_o_dst_x; x++)
+				dwt_cdf97_i_ex_stride_d(
+					addr2_d(ptr,0,x,stride_x,stride_y),
+					addr2_d(ptr,size_o_src_y,x,stride_x,stride_y),
+					addr2_d(ptr,0,x,stride_x,stride_y),
+					workspace_temp_d(workspace),
+					size_i_dst_y,
+					stride_x);
 		}
-	}
-}
 
-void dwt_cdf53_i_ex_stride_s(
-	const float *src_l,
-	const float *src_h,
-	float *dst,
-	float *tmp,
-	int N,
-	int stride)
-{
-	assert( N >= 0 && NULL != src_l && NULL != src_h && NULL != dst && NULL != tmp && 0 != stride );
+		if(zero_padding)
+			dwt_zero_padding_2i_d(
+				ptr,
+				stride_x,
+				stride_y,
+				size_o_dst_x,
+				size_o_dst_y,
+				size_i_dst_x,
+				size_i_dst_y);
 
-	// fix for small N
-	if(N < 2)
-	{
-		if(1 == N)
-			dst[0] = src_l[0] * dwt_cdf53_s2_s;
-		return;
+		j--;
 	}
 
-	// copy src into tmp
-	dwt_util_memcpy_stride_s(tmp+0, 2*sizeof(float), src_l, stride,  ceil_div2(N));
-	dwt_util_memcpy_stride_s(tmp+1, 2*sizeof(float), src_h, stride, floor_div2(N));
-
-	// inverse scale
-	for(int i=0; i<N; i+=2)
-		tmp[i] = tmp[i] * dwt_cdf53_s2_s;
-	for(int i=1; i<N; i+=2)
-		tmp[i] = tmp[i] * dwt_cdf53_s1_s;
-
-	// backward update 2 + backward predict 2
-	for(int i=2; i<N-(N&1); i+=2)
-		tmp[i] -= dwt_cdf53_u1_s * (tmp[i-1] + tmp[i+1]);
+	release_workspace(workspace);
+}
 
-	tmp[0] -= 2 * dwt_cdf53_u1_s * tmp[1];
+void dwt_cdf97_2i_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max,
+	int decompose_one,
+	int zero_padding)
+{
+	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
+	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-	if(is_odd(N))
-		tmp[N-1] -= 2 * dwt_cdf53_u1_s * tmp[N-2];
-	else
-		tmp[N-1] += 2 * dwt_cdf53_p1_s * tmp[N-2];
+	int j = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
 
-	for(int i=1; i<N-2+(N&1); i+=2)
-		tmp[i] += dwt_cdf53_p1_s * (tmp[i-1] + tmp[i+1]);
+	if( j_max >= 0 && j_max < j )
+		j = j_max;
 
-	// copy tmp into dst
-	dwt_util_memcpy_stride_s(dst, stride, tmp, sizeof(float), N);
+	dwt_cdf97_2i_core_d(
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j,
+		j,
+		zero_padding);
 }
 
-void dwt_zero_padding_f_d(
-	double *dst_l,
-	double *dst_h,
-	int N,
-	int N_dst_L,
-	int N_dst_H)
+void dwt_cdf97_2i_aniso_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max_x,
+	int j_max_y,
+	int zero_padding)
 {
-	dwt_zero_padding_f_stride_d(
-		dst_l,
-		dst_h,
-		N,
-		N_dst_L,
-		N_dst_H,
-		sizeof(double)
-	);
-}
+	const int j_limit_x = ceil_log2(size_o_big_x);
+	const int j_limit_y = ceil_log2(size_o_big_y);
 
-void dwt_zero_padding_f_s(
-	float *dst_l,
-	float *dst_h,
-	int N,
-	int N_dst_L,
-	int N_dst_H)
-{
-	dwt_zero_padding_f_stride_s(
-		dst_l,
-		dst_h,
-		N,
-		N_dst_L,
-		N_dst_H,
-		sizeof(float)
-	);
+	dwt_cdf97_2i_core_d(
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j_max_x < 0 || j_max_x > j_limit_x ? j_limit_x : j_max_x,
+		j_max_y < 0 || j_max_y > j_limit_y ? j_limit_y : j_max_y,
+		zero_padding);
 }
 
-void dwt_zero_padding_f_stride_d(
-	double *dst_l,
-	double *dst_h,
-	int N,
-	int N_dst_L,
-	int N_dst_H,
-	int stride)
+static
+void dwt_cdf53_2i_core_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max_x,
+	int j_max_y,
+	int zero_padding)
 {
-	assert( N >= 0 && N_dst_L >= 0 && N_dst_H >= 0 && 0 == ((N_dst_L-N_dst_H)&~1) && NULL != dst_l && NULL != dst_h && 0 != stride ); // FIXME: 0 == ((N_dst_L-N_dst_H)&~1)
+	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-	if(N_dst_L || N_dst_H)
+	struct dwt_workspace *workspace = acquire_workspace(size_o_big_max);
+
+	int j = max(j_max_x, j_max_y);
+
+	// one team for all levels, separated only by the barriers of the work-sharing loops
+	#pragma omp parallel firstprivate(j)
+	for(;;)
 	{
-		const double zero = 0;
+		if(0 == j)
+			break;
 
-		dwt_util_memcpy_stride_d(addr1_d(dst_l,  ceil_div2(N), stride), stride, &zero, 0, N_dst_L -  ceil_div2(N));
-		dwt_util_memcpy_stride_d(addr1_d(dst_h, floor_div2(N), stride), stride, &zero, 0, N_dst_H - floor_div2(N));
-	}
-}
+		const int size_o_src_x = ceil_div_pow2(size_o_big_x, min(j,   j_max_x));
+		const int size_o_src_y = ceil_div_pow2(size_o_big_y, min(j,   j_max_y));
+		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, min(j-1, j_max_x));
+		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, min(j-1, j_max_y));
+		const int size_i_dst_x = ceil_div_pow2(size_i_big_x, min(j-1, j_max_x));
+		const int size_i_dst_y = ceil_div_pow2(size_i_big_y, min(j-1, j_max_y));
 
-void dwt_zero_padding_f_stride_s(
-	float *dst_l,
-	float *dst_h,
-	int N,
-	int N_dst_L,
-	int N_dst_H,
-	int stride)
-{
-	assert( N >= 0 && N_dst_L >= 0 && N_dst_H >= 0 && 0 == ((N_dst_L-N_dst_H)&~1) && NULL != dst_l && NULL != dst_h && 0 != stride ); // FIXME: 0 == ((N_dst_L-N_dst_H)&~1)
+		if( j <= j_max_x )
+		{
+			#pragma omp for schedule(static, ceil_div(size_o_dst_y, omp_get_num_threads()))
+			for(int y = 0; y < size_o_dst_y; y++)
+				dwt_cdf53_i_ex_stride_d(
+					addr2_d(ptr,y,0,stride_x,stride_y),
+					addr2_d(ptr,y,size_o_src_x,stride_x,stride_y),
+					addr2_d(ptr,y,0,stride_x,stride_y),
+					workspace_temp_d(workspace),
+					size_i_dst_x,
+					stride_y);
+		}
+		if( j <= j_max_y )
+		{
+			#pragma omp for schedule(static, ceil_div(size_o_dst_x, omp_get_num_threads()))
+			for(int x = 0; x < size_o_dst_x; x++)
+				dwt_cdf53_i_ex_stride_d(
+					addr2_d(ptr,0,x,stride_x,stride_y),
+					addr2_d(ptr,size_o_src_y,x,stride_x,stride_y),
+					addr2_d(ptr,0,x,stride_x,stride_y),
+					workspace_temp_d(workspace),
+					size_i_dst_y,
+					stride_x);
+		}
 
-	if(N_dst_L || N_dst_H)
-	{
-		const float zero = 0;
+		if(zero_padding)
+			dwt_zero_padding_2i_d(
+				ptr,
+				stride_x,
+				stride_y,
+				size_o_dst_x,
+				size_o_dst_y,
+				size_i_dst_x,
+				size_i_dst_y);
 
-		dwt_util_memcpy_stride_s(addr1_s(dst_l,  ceil_div2(N), stride), stride, &zero, 0, N_dst_L -  ceil_div2(N));
-		dwt_util_memcpy_stride_s(addr1_s(dst_h, floor_div2(N), stride), stride, &zero, 0, N_dst_H - floor_div2(N));
+		j--;
 	}
-}
 
-void dwt_zero_padding_i_d(
-	double *dst_l,
-	int N,
-	int N_dst)
-{
-	dwt_zero_padding_i_stride_d(
-		dst_l,
-		N,
-		N_dst,
-		sizeof(double)
-	);
+	release_workspace(workspace);
 }
 
-void dwt_zero_padding_i_s(
-	float *dst_l,
-	int N,
-	int N_dst)
+void dwt_cdf53_2i_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max,
+	int decompose_one,
+	int zero_padding)
 {
-	dwt_zero_padding_i_stride_s(
-		dst_l,
-		N,
-		N_dst,
-		sizeof(float)
-	);
-}
+	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
+	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-void dwt_zero_padding_i_stride_d(
-	double *dst_l,
-	int N,
-	int N_dst,
-	int stride)
-{
-	assert( N >= 0 && N_dst >= 0 && NULL != dst_l && 0 != stride );
+	int j = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
 
-	const double zero = 0;
+	if( j_max >= 0 && j_max < j )
+		j = j_max;
 
-	dwt_util_memcpy_stride_d(
-		addr1_d(dst_l, N, stride),
-		stride,
-		&zero,
-		0,
-		N_dst - N);
+	dwt_cdf53_2i_core_d(
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j,
+		j,
+		zero_padding);
 }
 
-void dwt_zero_padding_i_stride_s(
-	float *dst_l,
-	int N,
-	int N_dst,
-	int stride)
+void dwt_cdf53_2i_aniso_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max_x,
+	int j_max_y,
+	int zero_padding)
 {
-	assert( N >= 0 && N_dst >= 0 && NULL != dst_l && 0 != stride );
+	const int j_limit_x = ceil_log2(size_o_big_x);
+	const int j_limit_y = ceil_log2(size_o_big_y);
 
-	const float zero = 0;
-
-	dwt_util_memcpy_stride_s(
-		addr1_s(dst_l, N, stride),
-		stride,
-		&zero,
-		0,
-		N_dst - N);
+	dwt_cdf53_2i_core_d(
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j_max_x < 0 || j_max_x > j_limit_x ? j_limit_x : j_max_x,
+		j_max_y < 0 || j_max_y > j_limit_y ? j_limit_y : j_max_y,
+		zero_padding);
 }
 
-void dwt_util_switch_op(
-	enum dwt_op op)
+/**
+ * @brief One level of inverse 2-D CDF 9/7 transform using the single-loop approach.
+ *
+ * Counterpart of dwt_cdf97_2f_single_s. The low-pass and high-pass rows are
+ * transformed horizontally in groups of @p group rows as needed, copied into
+ * the ring of working rows and fed into the vertical lifting. Every final
+ * row is written into its place. The low-pass rows whose place is
+ * overwritten before they are read are staged first.
+ */
+static
+void dwt_cdf97_2i_single_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_src_x,
+	int size_o_src_y,
+	int size_o_dst_x,
+	int size_o_dst_y,
+	int size_i_dst_x,
+	int size_i_dst_y,
+	float *tmp,
+	int tmp_dist,
+	int group)
 {
-	FUNC_BEGIN;
-
-#ifdef microblaze
-	if( op == dwt_util_global_active_op )
-		return;
+	assert( size_i_dst_y >= 2 && (int)sizeof(float) == stride_y && group <= 4 );
 
-	//WAL_CHECK( wal_mb2pb(worker, 0) );
+	const int N = size_i_dst_y;
+	const int cols = size_o_dst_x;
+	const float w[4] = { -dwt_cdf97_u2_s, dwt_cdf97_p2_s, -dwt_cdf97_u1_s, dwt_cdf97_p1_s };
+	const float zeta = dwt_cdf97_s1_s;
 
-	//WAL_CHECK( wal_bce_jk_sync_operation(worker) );
+	// working rows
+	float *ring = malloc(sizeof(float) * 16 * cols);
+	// low-pass rows whose place has been overwritten
+	float *stage = malloc(sizeof(float) * ceil_div2(N) * cols);
 
-	for(int w = 0; w < get_total_workers(); w++)
+	if( NULL == ring || NULL == stage )
 	{
-		WAL_CHECK( wal_reset_worker(worker[w]) );
+		dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+		dwt_util_abort();
 	}
 
-	switch(op)
+#define SLOT(i) (ring + ((i)&15)*cols)
+#define ROW(i) addr2_s(ptr,(i),0,stride_x,stride_y)
+#define HORIZ(y, count) dwt_cdf97_i_ex_stride_group_s(ROW(y), addr2_s(ptr,(y),size_o_src_x,stride_x,stride_y), ROW(y), tmp, tmp_dist, size_i_dst_x, stride_y, (count), stride_x)
+
+	// rows read into the ring
+	int loaded = 0;
+	// rows written into their place
+	int written = 0;
+	// low-pass and high-pass rows transformed horizontally
+	int done_l = 0;
+	int done_h = 0;
+
+	// the step s is applied on the row t-1-s at time t, the rows up to t have to be loaded
+	for(int t = 1; t <= N+5; t += 2)
 	{
-		case DWT_OP_LIFT4SA:
+		for(; loaded <= min(t, N-1); loaded++)
 		{
-			for(int w = 0; w < get_total_workers(); w++)
+			const int k = loaded/2;
+
+			if( is_even(loaded) )
 			{
-				WAL_CHECK( wal_start_operation(worker[w], WAL_PBID_P0) );
-			}
+				// not staged yet, its place has not been overwritten
+				if( k >= done_l )
+				{
+					const int count = min(group, ceil_div2(N)-k);
 
-			float alpha = -dwt_cdf97_p1_s,
-				beta = dwt_cdf97_u1_s,
-				gamma = -dwt_cdf97_p2_s,
-				delta = dwt_cdf97_u2_s,
-				zeta = dwt_cdf97_s1_s;
+					HORIZ(k, count);
+					done_l = k+count;
+				}
 
-			const int size = 12;
-			// FIXME(ASVP): for these coeeficients, use memory bank "D"
-			const float coeffs[12] = {delta, 0.0f, gamma, 0.0f, beta, 0.0f, alpha, 0.0f, zeta, 0.0f, 1/zeta, 0.0f};
-			float *addr = dwt_util_allocate_vec_s(size);
-			if(!addr)
-			{
-				dwt_util_log(LOG_ERR, "Failed to allocate vector of %i floats.\n", size);
-				dwt_util_abort();
+				memcpy(SLOT(loaded), k < written ? stage + k*cols : ROW(k), sizeof(float) * cols);
 			}
-			if( dwt_util_copy_vec_s(coeffs, addr, size) )
-				dwt_util_abort();
+			else
+			{
+				if( k >= done_h )
+				{
+					const int count = min(group, floor_div2(N)-k);
 
-			assert( is_even(size) );
-			assert( is_aligned_8(addr) );
+					HORIZ(size_o_src_y+k, count);
+					done_h = k+count;
+				}
 
-			for(int w = 0; w < get_total_workers(); w++)
-			{
-				WAL_CHECK( wal_dma_configure(worker[w], 0, addr, 0, WAL_BCE_JSY_DMEM_B, 0, size) );
-				WAL_CHECK( wal_dma_start(worker[w], 0, WAL_DMA_REQ_RD) );
-				while( wal_dma_isbusy(worker[w], 0x01) )
-					;
+				memcpy(SLOT(loaded), ROW(size_o_src_y+k), sizeof(float) * cols);
 			}
 
-			free(addr);
+			op4s_row_mul_s(SLOT(loaded), SLOT(loaded), is_even(loaded) ? 1/zeta : zeta, cols);
 		}
-		break;
-		case DWT_OP_LIFT4SB:
-		{
-			for(int w = 0; w < get_total_workers(); w++)
-			{
-				WAL_CHECK( wal_start_operation(worker[w], WAL_PBID_P1) );
-			}
 
-			float alpha = -dwt_cdf97_u2_s,
-				beta = dwt_cdf97_p2_s,
-				gamma = -dwt_cdf97_u1_s,
-				delta = dwt_cdf97_p1_s,
-				zeta = dwt_cdf97_s1_s;
+		op4s_ring_steps_s(ring, cols, t, N, w);
 
-			const int size = 12;
-			// FIXME(ASVP): for these coeeficients, use memory bank "D"
-			const float coeffs[12] = {delta, 0.0f, gamma, 0.0f, beta, 0.0f, alpha, 0.0f, zeta, 0.0f, 1/zeta, 0.0f};
-			float *addr = dwt_util_allocate_vec_s(size);
-			if(!addr)
+		// even rows are final after time i+5, odd rows after time i+4
+		for(int i = max(t-5, 0); i <= min(t-4, N-1); i++)
+		{
+			// low-pass row i not read yet
+			if( i < ceil_div2(N) && 2*i >= loaded )
 			{
-				dwt_util_log(LOG_ERR, "Failed to allocate vector of %i floats.\n", size);
-				dwt_util_abort();
-			}
-			if( dwt_util_copy_vec_s(coeffs, addr, size) )
-				dwt_util_abort();
+				if( i >= done_l )
+				{
+					const int count = min(group, ceil_div2(N)-i);
 
-			assert( is_even(size) );
-			assert( is_aligned_8(addr) );
+					HORIZ(i, count);
+					done_l = i+count;
+				}
 
-			for(int w = 0; w < get_total_workers(); w++)
-			{
-				WAL_CHECK( wal_dma_configure(worker[w], 0, addr, 0, WAL_BCE_JSY_DMEM_B, 0, size) );
-				WAL_CHECK( wal_dma_start(worker[w], 0, WAL_DMA_REQ_RD) );
-				while( wal_dma_isbusy(worker[w], 0x01) )
-					;
+				memcpy(stage + i*cols, ROW(i), sizeof(float) * cols);
 			}
 
-			free(addr);
-		}
-		break;
-		default:
-		{
-			dwt_util_log(LOG_ERR, "Unknown operation.\n");
-	
-			dwt_util_abort();
+			memcpy(ROW(i), SLOT(i), sizeof(float) * cols);
+			written = i+1;
 		}
 	}
 
-	dwt_util_global_active_op = op;
-#else
-	UNUSED(op);
-#endif
+	// rows out of the vertical transform are transformed horizontally only
+	for(int y = N; y < size_o_dst_y; y++)
+	{
+		if( y < size_o_src_y || y >= size_o_src_y + floor_div2(N) )
+			HORIZ(y, 1);
+	}
 
-	FUNC_END;
+#undef HORIZ
+#undef SLOT
+#undef ROW
+
+	free(stage);
+	free(ring);
 }
 
-void dwt_cdf97_2f_d(
-	void *ptr,
-	int stride_x,
-	int stride_y,
-	int size_o_big_x,
-	int size_o_big_y,
-	int size_i_big_x,
-	int size_i_big_y,
-	int *j_max_ptr,
-	int decompose_one,
-	int zero_padding)
+/**
+ * @brief Whether the row @p y is read by the bands following the band ending at the row @p y1 (inverse tiled strategy).
+ */
+static
+int tile_row_needed_i(
+	int y,
+	int y1,
+	int N)
 {
-	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
-	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
-
-	double temp[size_o_big_max];
-	if(NULL == temp)
-		abort();
-
-	int j = 0;
-
-	const int j_limit = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
+	const int k = y < ceil_div2(N) ? y : y-ceil_div2(N);
 
-	if( *j_max_ptr < 0 || *j_max_ptr > j_limit )
-		*j_max_ptr = j_limit;
+	return y1 < N && k >= (y1-DWT_TILE_HALO)/2;
+}
 
-	for(;;)
+/**
+ * @brief One level of inverse 2-D CDF 9/7 transform using the tiled strategy.
+ *
+ * Counterpart of dwt_cdf97_2f_tile_s. The low-pass and high-pass
+ * coefficients of each tile and its halo are gathered into a small buffer,
+ * transformed horizontally and vertically, and the interior of the tile is
+ * collected into the band.
+ */
+static
+void dwt_cdf97_2i_tile_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int tile,
+	int group)
+{
+	assert( size_x >= 2 && size_y >= 2 && (int)sizeof(float) == stride_y && is_even(tile) && tile >= 2*DWT_TILE_HALO );
+
+	const int N = size_y;
+	const int cols = size_x;
+	const int size_src_x = ceil_div2(size_x);
+	const int size_src_y = ceil_div2(size_y);
+	// distance between rows of a tile, preserves alignment on 16 bytes
+	const int pitch = (tile + 2*DWT_TILE_HALO + 3) & ~3;
+	const int tmp_dist = (calc_and_set_temp_size(pitch)+3) & ~3;
+
+	// rows to be saved
+	int saves = 0;
+	for(int y = 0; y < N; y++)
 	{
-		if( *j_max_ptr == j )
-			break;
-
-		const int size_o_src_x = ceil_div_pow2(size_o_big_x, j  );
-		const int size_o_src_y = ceil_div_pow2(size_o_big_y, j  );
-		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, j+1);
-		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, j+1);
-		const int size_i_src_x = ceil_div_pow2(size_i_big_x, j  );
-		const int size_i_src_y = ceil_div_pow2(size_i_big_y, j  );
+		if( tile_row_needed_i(y, tile_band_end(y, tile, N), N) )
+			saves++;
+	}
 
-		#pragma omp parallel for private(temp) schedule(static, ceil_div(size_o_src_y, omp_get_num_threads()))
-		for(int y = 0; y < size_o_src_y; y++)
-			dwt_cdf97_f_ex_stride_d(
-				addr2_d(ptr,y,0,stride_x,stride_y),
-				addr2_d(ptr,y,0,stride_x,stride_y),
-				addr2_d(ptr,y,size_o_dst_x,stride_x,stride_y),
-				temp,
-				size_i_src_x,
-				stride_y);
-		#pragma omp parallel for private(temp) schedule(static, ceil_div(size_o_src_x, omp_get_num_threads()))
-		for(int x = 0; x < size_o_src_x; x++)
-			dwt_cdf97_f_ex_stride_d(
-				addr2_d(ptr,0,x,stride_x,stride_y),
-				addr2_d(ptr,0,x,stride_x,stride_y),
-				addr2_d(ptr,size_o_dst_y,x,stride_x,stride_y),
-				temp,
-				size_i_src_y,
-				stride_x);
+	float *band, *stage;
+	int *slot;
 
-		if(zero_padding)
-		{
-			#pragma omp parallel for schedule(static, ceil_div(size_o_src_y, omp_get_num_threads()))
-			for(int y = 0; y < size_o_src_y; y++)
-				dwt_zero_padding_f_stride_d(
-					addr2_d(ptr,y,0,stride_x,stride_y),
-					addr2_d(ptr,y,size_o_dst_x,stride_x,stride_y),
-					size_i_src_x,
-					size_o_dst_x,
-					size_o_src_x-size_o_dst_x,
-					stride_y);
-			#pragma omp parallel for schedule(static, ceil_div(size_o_src_x, omp_get_num_threads()))
-			for(int x = 0; x < size_o_src_x; x++)
-				dwt_zero_padding_f_stride_d(
-					addr2_d(ptr,0,x,stride_x,stride_y),
-					addr2_d(ptr,size_o_dst_y,x,stride_x,stride_y),
-					size_i_src_y,
-					size_o_dst_y,
-					size_o_src_y-size_o_dst_y,
-					stride_x);
+	// buffers shared by the team
+	#pragma omp single copyprivate(band, stage, slot)
+	{
+		// rows of the current band
+		band = malloc(sizeof(float) * tile * cols);
+		// saved rows
+		stage = malloc(sizeof(float) * saves * cols);
+		// index of the saved row or -1
+		slot = malloc(sizeof(int) * N);
+
+		if( NULL == band || (NULL == stage && saves) || NULL == slot )
+		{
+			dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+			dwt_util_abort();
 		}
 
-		j++;
+		for(int y = 0; y < N; y++)
+			slot[y] = -1;
 	}
-}
 
-void dwt_cdf53_2f_d(
-	void *ptr,
-	int stride_x,
-	int stride_y,
-	int size_o_big_x,
-	int size_o_big_y,
-	int size_i_big_x,
-	int size_i_big_y,
-	int *j_max_ptr,
-	int decompose_one,
-	int zero_padding)
-{
-	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
-	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
+	saves = 0;
 
-	double temp[size_o_big_max];
-	if(NULL == temp)
-		abort();
+#define ROW(y) addr2_s(ptr,(y),0,stride_x,stride_y)
+#define SRC(y) (slot[(y)] < 0 ? ROW(y) : stage + slot[(y)]*cols)
 
-	int j = 0;
+	for(int y0 = 0; y0 < N; y0 += tile)
+	{
+		const int y1 = min(y0+tile, N);
+		const int ys = max(y0-DWT_TILE_HALO, 0);
+		const int ye = min(y1+DWT_TILE_HALO, N);
+		const int m = ye-ys;
 
-	const int j_limit = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
+		#pragma omp for schedule(static)
+		for(int x0 = 0; x0 < cols; x0 += tile)
+		{
+			const int x1 = min(x0+tile, cols);
+			const int xs = max(x0-DWT_TILE_HALO, 0);
+			const int xe = min(x1+DWT_TILE_HALO, cols);
+			const int n = xe-xs;
 
-	if( *j_max_ptr < 0 || *j_max_ptr > j_limit )
-		*j_max_ptr = j_limit;
+			float *block = memalign(16, sizeof(float) * (m*pitch + max(group*tmp_dist, 16*pitch)));
+			if( NULL == block )
+			{
+				dwt_util_log(LOG_ERR, "Unable to allocate memory.\n");
+				dwt_util_abort();
+			}
+			float *tmp = block + m*pitch;
 
-	for(;;)
-	{
-		if( *j_max_ptr == j )
-			break;
+			for(int i = 0; i < m; i++)
+			{
+				const float *row = SRC(i < ceil_div2(m) ? ys/2 + i : size_src_y + ys/2 + i-ceil_div2(m));
 
-		const int size_o_src_x = ceil_div_pow2(size_o_big_x, j  );
-		const int size_o_src_y = ceil_div_pow2(size_o_big_y, j  );
-		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, j+1);
-		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, j+1);
-		const int size_i_src_x = ceil_div_pow2(size_i_big_x, j  );
-		const int size_i_src_y = ceil_div_pow2(size_i_big_y, j  );
+				memcpy(block + i*pitch, row + xs/2, sizeof(float) * ceil_div2(n));
+				memcpy(block + i*pitch + ceil_div2(n), row + size_src_x + xs/2, sizeof(float) * floor_div2(n));
+			}
 
-		#pragma omp parallel for private(temp) schedule(static, ceil_div(size_o_src_y, omp_get_num_threads()))
-		for(int y = 0; y < size_o_src_y; y++)
-			dwt_cdf53_f_ex_stride_d(
-				addr2_d(ptr,y,0,stride_x,stride_y),
-				addr2_d(ptr,y,0,stride_x,stride_y),
-				addr2_d(ptr,y,size_o_dst_x,stride_x,stride_y),
-				temp,
-				size_i_src_x,
-				stride_y);
-		#pragma omp parallel for private(temp) schedule(static, ceil_div(size_o_src_x, omp_get_num_threads()))
-		for(int x = 0; x < size_o_src_x; x++)
-			dwt_cdf53_f_ex_stride_d(
-				addr2_d(ptr,0,x,stride_x,stride_y),
-				addr2_d(ptr,0,x,stride_x,stride_y),
-				addr2_d(ptr,size_o_dst_y,x,stride_x,stride_y),
-				temp,
-				size_i_src_y,
-				stride_x);
+			for(int i = 0; i < m; i += group)
+				dwt_cdf97_i_ex_stride_group_s(
+					block + i*pitch,
+					block + i*pitch + ceil_div2(n),
+					block + i*pitch,
+					tmp,
+					tmp_dist,
+					n,
+					sizeof(float),
+					min(group, m-i),
+					sizeof(float) * pitch);
+
+			for(int x = 0; x < n; x += get_cols_s(m))
+				dwt_cdf97_i_ex_stride_cols_s(
+					block + x,
+					block + ceil_div2(m)*pitch + x,
+					block + x,
+					tmp,
+					m,
+					sizeof(float) * pitch,
+					min(get_cols_s(m), n-x));
+
+			// interior of the tile
+			for(int y = y0; y < y1; y++)
+				memcpy(band + (y-y0)*cols + x0, block + (y-ys)*pitch + x0-xs, sizeof(float) * (x1-x0));
+
+			free(block);
+		}
 
-		if(zero_padding)
+		// the band is put back by one thread
+		#pragma omp master
 		{
-			#pragma omp parallel for schedule(static, ceil_div(size_o_src_y, omp_get_num_threads()))
-			for(int y = 0; y < size_o_src_y; y++)
-				dwt_zero_padding_f_stride_d(
-					addr2_d(ptr,y,0,stride_x,stride_y),
-					addr2_d(ptr,y,size_o_dst_x,stride_x,stride_y),
-					size_i_src_x,
-					size_o_dst_x,
-					size_o_src_x-size_o_dst_x,
-					stride_y);
-			#pragma omp parallel for schedule(static, ceil_div(size_o_src_x, omp_get_num_threads()))
-			for(int x = 0; x < size_o_src_x; x++)
-				dwt_zero_padding_f_stride_d(
-					addr2_d(ptr,0,x,stride_x,stride_y),
-					addr2_d(ptr,size_o_dst_y,x,stride_x,stride_y),
-					size_i_src_y,
-					size_o_dst_y,
-					size_o_src_y-size_o_dst_y,
-					stride_x);
+			for(int y = y0; y < y1; y++)
+			{
+				if( slot[y] < 0 && tile_row_needed_i(y, y1, N) )
+				{
+					memcpy(stage + saves*cols, ROW(y), sizeof(float) * cols);
+					slot[y] = saves++;
+				}
+
+				memcpy(ROW(y), band + (y-y0)*cols, sizeof(float) * cols);
+			}
 		}
 
-		j++;
+		#pragma omp barrier
+	}
+
+#undef SRC
+#undef ROW
+
+	#pragma omp master
+	{
+		free(slot);
+		free(stage);
+		free(band);
 	}
 }
 
-void dwt_cdf97_2f_s(
+static
+void dwt_cdf97_2i_core_s(
 	void *ptr,
 	int stride_x,
 	int stride_y,
@@ -6291,123 +15734,297 @@ void dwt_cdf97_2f_s(
 	int size_o_big_y,
 	int size_i_big_x,
 	int size_i_big_y,
-	int *j_max_ptr,
-	int decompose_one,
+	int j_max_x,
+	int j_max_y,
 	int zero_padding)
 {
 	FUNC_BEGIN;
 
 #ifdef microblaze
-	dwt_util_switch_op(DWT_OP_LIFT4SA);
+	dwt_util_switch_op(DWT_OP_LIFT4SB);
 #endif
-	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
 	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-	// FIXME: allocate temp[max_threads][temp_size] and remove private() in omp parallel
-	// FIXME: OpenMP cannot use this in private()
+	// rows (columns) lifted together
+	const int group = get_accel_group_s();
+
 #ifdef microblaze
-	#define TEMP_OFFSET 1
 	float *temp = dwt_util_allocate_vec_s(calc_and_set_temp_size(size_o_big_max));
-#else
-	//#define TEMP_OFFSET 0
-	// FIXME(x86) HACK: __attribute__ ((aligned (16)))
-	#define TEMP_OFFSET 3
-	// FIXME(x86) BUG: temp[] is allocated on stack! so stack overflow is caused by big sizes of temp[size]
-	float temp[calc_and_set_temp_size(size_o_big_max)] __attribute__ ((aligned (16)));
-	
-	if( !is_aligned_16(temp) )
-		dwt_util_abort();
-#endif
 	if(NULL == temp)
 		abort(); // FIXME
+	const int temp_dist = 0; // groups are not used here
+	#define TEMP_ADDR temp
+	// blocks are simply iterated, see sched_next
+	struct dwt_workspace *workspace = NULL;
+#else
+	// distance between temporary signals of one group, preserves alignment on 16 bytes
+	const int temp_dist = (calc_and_set_temp_size(size_o_big_max)+3) & ~3;
+	// one slab per thread, allocated once if set by dwt_util_set_workspace
+	struct dwt_workspace *workspace = acquire_workspace(size_o_big_max);
+	#define TEMP_ADDR workspace_temp_s(workspace)
+#endif
 
-	int j = 0;
-
-	const int j_limit = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
+	int j = max(j_max_x, j_max_y);
 
-	if( *j_max_ptr < 0 || *j_max_ptr > j_limit )
-		*j_max_ptr = j_limit;
+	// the deepest levels do not pay for the synchronization of the team, see get_level_threads
+	int j_team = j;
+	while( j_team > 0 && get_level_threads(ceil_div_pow2(size_o_big_x, min(j_team-1, j_max_x)), ceil_div_pow2(size_o_big_y, min(j_team-1, j_max_y))) < 2 )
+		j_team--;
 
-	for(;;)
+	// the deepest levels serially first, then the rest in the team
+	for(int team = 0; team <= 1; team++)
 	{
-		if( *j_max_ptr == j )
-			break;
+		const int j_end = team ? 0 : j_team;
 
-		const int size_o_src_x = ceil_div_pow2(size_o_big_x, j  );
-		const int size_o_src_y = ceil_div_pow2(size_o_big_y, j  );
-		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, j+1);
-		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, j+1);
-		const int size_i_src_x = ceil_div_pow2(size_i_big_x, j  );
-		const int size_i_src_y = ceil_div_pow2(size_i_big_y, j  );
+		// one team for all levels, separated only by the barriers of the passes
+		#pragma omp parallel if(team) firstprivate(j)
+		for(;;)
+		{
+			if( j_end == j )
+				break;
 
-#ifdef _OPENMP
-		const int threads_segment_y = ceil_div(size_o_src_y, dwt_util_get_num_threads());
-		const int threads_segment_x = ceil_div(size_o_src_x, dwt_util_get_num_threads());
-#endif
-		const int workers_segment_y = ceil_div(size_o_src_y, dwt_util_get_num_workers());
-		const int workers_segment_x = ceil_div(size_o_src_x, dwt_util_get_num_workers());
+			const int size_o_src_x = ceil_div_pow2(size_o_big_x, min(j,   j_max_x));
+			const int size_o_src_y = ceil_div_pow2(size_o_big_y, min(j,   j_max_y));
+			const int size_o_dst_x = ceil_div_pow2(size_o_big_x, min(j-1, j_max_x));
+			const int size_o_dst_y = ceil_div_pow2(size_o_big_y, min(j-1, j_max_y));
+			const int size_i_dst_x = ceil_div_pow2(size_i_big_x, min(j-1, j_max_x));
+			const int size_i_dst_y = ceil_div_pow2(size_i_big_y, min(j-1, j_max_y));
+			// threads taking part in the passes of this level
+			const int threads = get_level_threads(size_o_dst_x, size_o_dst_y);
+
+			const int workers_segment_y = ceil_div(size_o_dst_y, dwt_util_get_num_workers());
+			const int workers_segment_x = ceil_div(size_o_dst_x, dwt_util_get_num_workers());
 
 #ifdef microblaze
-		set_data_step_s( (intptr_t)addr2_s(ptr,workers_segment_y,0,stride_x,stride_y) - (intptr_t)addr2_s(ptr,0,0,stride_x,stride_y) );
-		set_data_limit_s( addr2_s(ptr,size_o_src_y,0,stride_x,stride_y) );
+			set_data_step_s( (intptr_t)addr2_s(ptr,workers_segment_y,0,stride_x,stride_y) - (intptr_t)addr2_s(ptr,0,0,stride_x,stride_y) );
+			set_data_limit_s( addr2_s(ptr,size_o_dst_y,0,stride_x,stride_y) );
 #endif
-		#pragma omp parallel for private(temp) schedule(static, threads_segment_y)
-		for(int y = 0; y < workers_segment_y; y++)
-			dwt_cdf97_f_ex_stride_s(
-				addr2_s(ptr,y,0,stride_x,stride_y),
-				addr2_s(ptr,y,0,stride_x,stride_y),
-				addr2_s(ptr,y,size_o_dst_x,stride_x,stride_y),
-				temp + TEMP_OFFSET, // HACK: +1, FIXME: can this work under OpenMP?
-				size_i_src_x,
-				stride_y);
+#ifndef microblaze
+			const enum dwt_vert vert = get_vert_type_level(stride_x, stride_y, size_i_dst_y);
+			// tiles are worth only for images without padding exceeding a tile
+			const int tiled = (DWT_VERT_TILE == vert || DWT_VERT_TASK == vert) && j <= j_max_x && j <= j_max_y
+				&& size_o_dst_x == size_i_dst_x && size_o_dst_y == size_i_dst_y
+				&& !get_short_s(size_i_dst_x) && !get_short_s(size_i_dst_y)
+				&& max(size_i_dst_x, size_i_dst_y) > get_tile_size();
+			// the single-loop approach also needs both passes
+			const int single = (DWT_VERT_SINGLE == vert || DWT_VERT_PYRAMID == vert) && j <= j_max_x && j <= j_max_y && size_i_dst_y >= 2;
+#endif
+
+			// no horizontal pass on this level
+			if( j > j_max_x )
+			{
+			}
+			else
+#ifndef microblaze
+			// both passes are applied tile by tile
+			if( tiled )
+			{
+				dwt_cdf97_2i_tile_s(
+					ptr,
+					stride_x,
+					stride_y,
+					size_i_dst_x,
+					size_i_dst_y,
+					get_tile_size(),
+					group);
+			}
+			// both passes are fused into a single loop over rows
+			else if( single )
+			{
+				#pragma omp single
+				dwt_cdf97_2i_single_s(
+					ptr,
+					stride_x,
+					stride_y,
+					size_o_src_x,
+					size_o_src_y,
+					size_o_dst_x,
+					size_o_dst_y,
+					size_i_dst_x,
+					size_i_dst_y,
+					workspace_temp_s(workspace),
+					temp_dist,
+					group);
+			}
+			// short rows are lifted together across the rows
+			else if( get_short_s(size_i_dst_x) && size_i_dst_x >= 2 )
+			{
+				const int batch = get_short_s(size_i_dst_x);
+
+				for(int y = sched_next(workspace, threads, -1, size_o_dst_y, batch); y >= 0; y = sched_next(workspace, threads, y, size_o_dst_y, batch))
+				{
+					float *block = workspace_block_s(workspace);
+
+					dwt_cdf97_i_ex_stride_short_s(
+						addr2_s(ptr,y,0,stride_x,stride_y),
+						addr2_s(ptr,y,size_o_src_x,stride_x,stride_y),
+						addr2_s(ptr,y,0,stride_x,stride_y),
+						block,
+						size_i_dst_x,
+						stride_y,
+						min(batch, size_o_dst_y-y),
+						stride_x);
+				}
+				#pragma omp barrier
+			}
+			else
+#endif
+			{
+				for(int y = sched_next(workspace, threads, -1, workers_segment_y, group); y >= 0; y = sched_next(workspace, threads, y, workers_segment_y, group))
+					dwt_cdf97_i_ex_stride_group_s(
+						addr2_s(ptr,y,0,stride_x,stride_y),
+						addr2_s(ptr,y,size_o_src_x,stride_x,stride_y),
+						addr2_s(ptr,y,0,stride_x,stride_y),
+						TEMP_ADDR,
+						temp_dist,
+						size_i_dst_x,
+						stride_y,
+						min(group, workers_segment_y-y),
+						stride_x);
+				#pragma omp barrier
+			}
 #ifdef microblaze
-		set_data_step_s( (intptr_t)addr2_s(ptr,0,workers_segment_x,stride_x,stride_y) - (intptr_t)addr2_s(ptr,0,0,stride_x,stride_y) );
-		set_data_limit_s( addr2_s(ptr,0,size_o_src_x,stride_x,stride_y) );
+			set_data_step_s( (intptr_t)addr2_s(ptr,0,workers_segment_x,stride_x,stride_y) - (intptr_t)addr2_s(ptr,0,0,stride_x,stride_y) );
+			set_data_limit_s( addr2_s(ptr,0,size_o_dst_x,stride_x,stride_y) );
 #endif
-		#pragma omp parallel for private(temp) schedule(static, threads_segment_x)
-		for(int x = 0; x < workers_segment_x; x++)
-			dwt_cdf97_f_ex_stride_s(
-				addr2_s(ptr,0,x,stride_x,stride_y),
-				addr2_s(ptr,0,x,stride_x,stride_y),
-				addr2_s(ptr,size_o_dst_y,x,stride_x,stride_y),
-				temp + TEMP_OFFSET, // HACK: +1, FIXME: can this work under OpenMP?
-				size_i_src_y,
-				stride_x);
+			// no vertical pass on this level
+			if( j > j_max_y )
+			{
+			}
+			else
+#ifndef microblaze
+			// already done together with the horizontal pass
+			if( tiled || single )
+			{
+			}
+			// adjacent columns are lifted together, also on images not worth tiling
+			else if( (DWT_VERT_BLOCK == vert || DWT_VERT_TILE == vert || DWT_VERT_TASK == vert) && size_i_dst_y >= 2 )
+			{
+				const int cols = get_cols_s(size_i_dst_y);
 
-		if(zero_padding)
-		{
-			#pragma omp parallel for schedule(static, threads_segment_y)
-			for(int y = 0; y < size_o_src_y; y++)
-				dwt_zero_padding_f_stride_s(
-					addr2_s(ptr,y,0,stride_x,stride_y),
-					addr2_s(ptr,y,size_o_dst_x,stride_x,stride_y),
-					size_i_src_x,
+				for(int x = sched_next(workspace, threads, -1, size_o_dst_x, cols); x >= 0; x = sched_next(workspace, threads, x, size_o_dst_x, cols))
+				{
+					float *block = workspace_block_s(workspace);
+
+					dwt_cdf97_i_ex_stride_cols_s(
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,size_o_src_y,x,stride_x,stride_y),
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						block,
+						size_i_dst_y,
+						stride_x,
+						min(cols, size_o_dst_x-x));
+				}
+				#pragma omp barrier
+			}
+			// adjacent columns are transposed into rows and lifted by the horizontal kernels
+			else if( DWT_VERT_TRANSPOSE == vert && size_i_dst_y >= 2 )
+			{
+				const int transpose_dist = get_transpose_dist_s(temp_dist);
+				const int cols = get_transpose_cols_s(workspace, transpose_dist);
+
+				for(int x = sched_next(workspace, threads, -1, size_o_dst_x, cols); x >= 0; x = sched_next(workspace, threads, x, size_o_dst_x, cols))
+				{
+					dwt_cdf97_i_ex_stride_transpose_s(
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,size_o_src_y,x,stride_x,stride_y),
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						TEMP_ADDR,
+						transpose_dist,
+						size_i_dst_y,
+						stride_x,
+						min(cols, size_o_dst_x-x),
+						group);
+				}
+				#pragma omp barrier
+			}
+			// lifting steps are applied on whole rows
+			else if( DWT_VERT_ROW == vert && size_i_dst_y >= 2 )
+			{
+				// a few wide blocks per thread, whole blocks are stolen
+				const int chunk = (ceil_div(size_o_dst_x, 4 * threads) + 15) & ~15;
+
+				for(int x = sched_next(workspace, threads, -1, size_o_dst_x, chunk); x >= 0; x = sched_next(workspace, threads, x, size_o_dst_x, chunk))
+				{
+					const int cols = min(chunk, size_o_dst_x-x);
+
+					float *rows = workspace_rows_s(workspace, (size_t)floor_div2(size_i_dst_y) * cols);
+
+					dwt_cdf97_i_ex_rows_s(
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,size_o_src_y,x,stride_x,stride_y),
+						rows,
+						size_i_dst_y,
+						stride_x,
+						cols);
+				}
+				#pragma omp barrier
+			}
+			// short columns are lifted together across the columns
+			else if( get_short_s(size_i_dst_y) && size_i_dst_y >= 2 )
+			{
+				const int batch = get_short_s(size_i_dst_y);
+
+				for(int x = sched_next(workspace, threads, -1, size_o_dst_x, batch); x >= 0; x = sched_next(workspace, threads, x, size_o_dst_x, batch))
+				{
+					float *block = workspace_block_s(workspace);
+
+					dwt_cdf97_i_ex_stride_short_s(
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,size_o_src_y,x,stride_x,stride_y),
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						block,
+						size_i_dst_y,
+						stride_x,
+						min(batch, size_o_dst_x-x),
+						stride_y);
+				}
+				#pragma omp barrier
+			}
+			else
+#endif
+			{
+				for(int x = sched_next(workspace, threads, -1, workers_segment_x, group); x >= 0; x = sched_next(workspace, threads, x, workers_segment_x, group))
+					dwt_cdf97_i_ex_stride_group_s(
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						addr2_s(ptr,size_o_src_y,x,stride_x,stride_y),
+						addr2_s(ptr,0,x,stride_x,stride_y),
+						TEMP_ADDR,
+						temp_dist,
+						size_i_dst_y,
+						stride_x,
+						min(group, workers_segment_x-x),
+						stride_y);
+				#pragma omp barrier
+			}
+
+			if(zero_padding)
+				dwt_zero_padding_2i_s(
+					ptr,
+					stride_x,
+					stride_y,
 					size_o_dst_x,
-					size_o_src_x-size_o_dst_x,
-					stride_y);
-			#pragma omp parallel for schedule(static, threads_segment_x)
-			for(int x = 0; x < size_o_src_x; x++)
-				dwt_zero_padding_f_stride_s(
-					addr2_s(ptr,0,x,stride_x,stride_y),
-					addr2_s(ptr,size_o_dst_y,x,stride_x,stride_y),
-					size_i_src_y,
 					size_o_dst_y,
-					size_o_src_y-size_o_dst_y,
-					stride_x);
+					size_i_dst_x,
+					size_i_dst_y);
+
+			j--;
 		}
 
-		j++;
+		j = j_end;
 	}
 
-#undef TEMP_OFFSET
+#undef TEMP_ADDR
 #ifdef microblaze
 	free(temp);
+#else
+	release_workspace(workspace);
 #endif
 
 	FUNC_END;
 }
 
-void dwt_cdf53_2f_s(
+void dwt_cdf97_2i_s(
 	void *ptr,
 	int stride_x,
 	int stride_y,
@@ -6415,82 +16032,195 @@ void dwt_cdf53_2f_s(
 	int size_o_big_y,
 	int size_i_big_x,
 	int size_i_big_y,
-	int *j_max_ptr,
+	int j_max,
 	int decompose_one,
 	int zero_padding)
 {
 	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
 	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-	float temp[size_o_big_max];
-	if(NULL == temp)
-		abort();
+	int j = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
 
-	int j = 0;
+	if( j_max >= 0 && j_max < j )
+		j = j_max;
 
-	const int j_limit = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
+	dwt_cdf97_2i_core_s(
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j,
+		j,
+		zero_padding);
+}
 
-	if( *j_max_ptr < 0 || *j_max_ptr > j_limit )
-		*j_max_ptr = j_limit;
+/**
+ * @brief Frames of at least this many elements are transformed by all threads in batch transforms.
+ *
+ * Smaller images do not amortize the synchronization of the threads at
+ * each level, so they are rather transformed by one thread each.
+ */
+#define DWT_BATCH_LARGE (1<<20)
 
-	for(;;)
-	{
-		if( *j_max_ptr == j )
-			break;
+static
+int batch_is_large(
+	const struct dwt_image *image)
+{
+	return (long)image->size_o_big_x * image->size_o_big_y >= DWT_BATCH_LARGE;
+}
 
-		const int size_o_src_x = ceil_div_pow2(size_o_big_x, j  );
-		const int size_o_src_y = ceil_div_pow2(size_o_big_y, j  );
-		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, j+1);
-		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, j+1);
-		const int size_i_src_x = ceil_div_pow2(size_i_big_x, j  );
-		const int size_i_src_y = ceil_div_pow2(size_i_big_y, j  );
+/**
+ * @brief Largest frame of the small images of a batch.
+ */
+static
+int batch_size(
+	const struct dwt_image *image,
+	int count)
+{
+	int size = 1;
 
-		#pragma omp parallel for private(temp) schedule(static, ceil_div(size_o_src_y, omp_get_num_threads()))
-		for(int y = 0; y < size_o_src_y; y++)
-			dwt_cdf53_f_ex_stride_s(
-				addr2_s(ptr,y,0,stride_x,stride_y),
-				addr2_s(ptr,y,0,stride_x,stride_y),
-				addr2_s(ptr,y,size_o_dst_x,stride_x,stride_y),
-				temp,
-				size_i_src_x,
-				stride_y);
-		#pragma omp parallel for private(temp) schedule(static, ceil_div(size_o_src_x, omp_get_num_threads()))
-		for(int x = 0; x < size_o_src_x; x++)
-			dwt_cdf53_f_ex_stride_s(
-				addr2_s(ptr,0,x,stride_x,stride_y),
-				addr2_s(ptr,0,x,stride_x,stride_y),
-				addr2_s(ptr,size_o_dst_y,x,stride_x,stride_y),
-				temp,
-				size_i_src_y,
-				stride_x);
+	for(int i = 0; i < count; i++)
+		if( !batch_is_large(&image[i]) )
+			size = max(size, max(image[i].size_o_big_x, image[i].size_o_big_y));
 
-		if(zero_padding)
-		{
-			#pragma omp parallel for schedule(static, ceil_div(size_o_src_y, omp_get_num_threads()))
-			for(int y = 0; y < size_o_src_y; y++)
-				dwt_zero_padding_f_stride_s(
-					addr2_s(ptr,y,0,stride_x,stride_y),
-					addr2_s(ptr,y,size_o_dst_x,stride_x,stride_y),
-					size_i_src_x,
-					size_o_dst_x,
-					size_o_src_x-size_o_dst_x,
-					stride_y);
-			#pragma omp parallel for schedule(static, ceil_div(size_o_src_x, omp_get_num_threads()))
-			for(int x = 0; x < size_o_src_x; x++)
-				dwt_zero_padding_f_stride_s(
-					addr2_s(ptr,0,x,stride_x,stride_y),
-					addr2_s(ptr,size_o_dst_y,x,stride_x,stride_y),
-					size_i_src_y,
-					size_o_dst_y,
-					size_o_src_y-size_o_dst_y,
-					stride_x);
-		}
+	return size;
+}
+
+/**
+ * @brief Set up the calling thread of a batch transform to transform whole images.
+ *
+ * The transforms of the thread run in a team of one thread and use its own
+ * workspace. Returns the workspace to be freed by @ref batch_thread_finish.
+ */
+static
+struct dwt_workspace *batch_thread_init(
+	int size)
+{
+#ifdef _OPENMP
+	// affects only the regions started by this thread
+	omp_set_num_threads(1);
+#endif
+
+	struct dwt_workspace *ws;
+
+	alloc_workspace(&ws, size, size, 1);
+
+	dwt_util_thread_workspace = ws;
+
+	return ws;
+}
+
+static
+void batch_thread_finish(
+	struct dwt_workspace *ws)
+{
+	dwt_util_thread_workspace = NULL;
+
+	dwt_util_free_workspace(&ws);
+}
+
+void dwt_cdf97_2f_batch_s(
+	struct dwt_image *image,
+	int count,
+	int decompose_one,
+	int zero_padding)
+{
+	assert( count >= 0 && (NULL != image || 0 == count) );
+
+	// large images by all threads
+	for(int i = 0; i < count; i++)
+		if( batch_is_large(&image[i]) )
+			dwt_cdf97_2f_s(
+				image[i].ptr,
+				image[i].stride_x,
+				image[i].stride_y,
+				image[i].size_o_big_x,
+				image[i].size_o_big_y,
+				image[i].size_i_big_x,
+				image[i].size_i_big_y,
+				&image[i].j_max,
+				decompose_one,
+				zero_padding);
+
+	const int size = batch_size(image, count);
+
+	// small images by one thread each
+	#pragma omp parallel
+	{
+		struct dwt_workspace *ws = batch_thread_init(size);
+
+		#pragma omp for schedule(dynamic)
+		for(int i = 0; i < count; i++)
+			if( !batch_is_large(&image[i]) )
+				dwt_cdf97_2f_s(
+					image[i].ptr,
+					image[i].stride_x,
+					image[i].stride_y,
+					image[i].size_o_big_x,
+					image[i].size_o_big_y,
+					image[i].size_i_big_x,
+					image[i].size_i_big_y,
+					&image[i].j_max,
+					decompose_one,
+					zero_padding);
+
+		batch_thread_finish(ws);
+	}
+}
+
+void dwt_cdf97_2i_batch_s(
+	const struct dwt_image *image,
+	int count,
+	int decompose_one,
+	int zero_padding)
+{
+	assert( count >= 0 && (NULL != image || 0 == count) );
+
+	// large images by all threads
+	for(int i = 0; i < count; i++)
+		if( batch_is_large(&image[i]) )
+			dwt_cdf97_2i_s(
+				image[i].ptr,
+				image[i].stride_x,
+				image[i].stride_y,
+				image[i].size_o_big_x,
+				image[i].size_o_big_y,
+				image[i].size_i_big_x,
+				image[i].size_i_big_y,
+				image[i].j_max,
+				decompose_one,
+				zero_padding);
 
-		j++;
+	const int size = batch_size(image, count);
+
+	// small images by one thread each
+	#pragma omp parallel
+	{
+		struct dwt_workspace *ws = batch_thread_init(size);
+
+		#pragma omp for schedule(dynamic)
+		for(int i = 0; i < count; i++)
+			if( !batch_is_large(&image[i]) )
+				dwt_cdf97_2i_s(
+					image[i].ptr,
+					image[i].stride_x,
+					image[i].stride_y,
+					image[i].size_o_big_x,
+					image[i].size_o_big_y,
+					image[i].size_i_big_x,
+					image[i].size_i_big_y,
+					image[i].j_max,
+					decompose_one,
+					zero_padding);
+
+		batch_thread_finish(ws);
 	}
 }
 
-void dwt_cdf97_2i_d(
+void dwt_cdf97_2i_aniso_s(
 	void *ptr,
 	int stride_x,
 	int stride_y,
@@ -6498,153 +16228,154 @@ void dwt_cdf97_2i_d(
 	int size_o_big_y,
 	int size_i_big_x,
 	int size_i_big_y,
-	int j_max,
-	int decompose_one,
+	int j_max_x,
+	int j_max_y,
 	int zero_padding)
 {
-	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
-	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
-
-	double temp[size_o_big_max];
-	if(NULL == temp)
-		abort();
+	const int j_limit_x = ceil_log2(size_o_big_x);
+	const int j_limit_y = ceil_log2(size_o_big_y);
 
-	int j = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
+	dwt_cdf97_2i_core_s(
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j_max_x < 0 || j_max_x > j_limit_x ? j_limit_x : j_max_x,
+		j_max_y < 0 || j_max_y > j_limit_y ? j_limit_y : j_max_y,
+		zero_padding);
+}
 
-	if( j_max >= 0 && j_max < j )
-		j = j_max;
+void dwt_cdf97_2f_inter_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int *j_max_ptr,
+	int decompose_one)
+{
+	FUNC_BEGIN;
 
-	for(;;)
-	{
-		if(0 == j)
-			break;
+	const int j_limit = ceil_log2(decompose_one ? max(size_x, size_y) : min(size_x, size_y));
 
-		const int size_o_src_x = ceil_div_pow2(size_o_big_x, j  );
-		const int size_o_src_y = ceil_div_pow2(size_o_big_y, j  );
-		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, j-1);
-		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, j-1);
-		const int size_i_dst_x = ceil_div_pow2(size_i_big_x, j-1);
-		const int size_i_dst_y = ceil_div_pow2(size_i_big_y, j-1);
+	if( *j_max_ptr < 0 || *j_max_ptr > j_limit )
+		*j_max_ptr = j_limit;
 
-		#pragma omp parallel for private(temp) schedule(static, ceil_div(size_o_dst_y, omp_get_num_threads()))
-		for(int y = 0; y < size_o_dst_y; y++)
-			dwt_cdf97_i_ex_stride_d(
-				addr2_d(ptr,y,0,stride_x,stride_y),
-				addr2_d(ptr,y,size_o_src_x,stride_x,stride_y),
-				addr2_d(ptr,y,0,stride_x,stride_y),
-				temp,
-				size_i_dst_x,
-				stride_y);
-		#pragma omp parallel for private(temp) schedule(static, ceil_div(size_o_dst_x, omp_get_num_threads()))
-		for(int x = 0; x < size_o_dst_x; x++)
-			dwt_cdf97_i_ex_stride_d(
-				addr2_d(ptr,0,x,stride_x,stride_y),
-				addr2_d(ptr,size_o_src_y,x,stride_x,stride_y),
-				addr2_d(ptr,0,x,stride_x,stride_y),
-				temp,
-				size_i_dst_y,
-				stride_x);
+	// rows lifted together
+	const int group = get_accel_group_s();
+	// distance between temporary signals of one group, preserves alignment on 16 bytes
+	const int temp_dist = (calc_and_set_temp_size(max(size_x, size_y))+3) & ~3;
+	// one slab per thread, allocated once if set by dwt_util_set_workspace
+	struct dwt_workspace *workspace = acquire_workspace(max(size_x, size_y));
 
-		if(zero_padding)
+	// one team for all levels, separated only by the barriers of the work-sharing loops
+	#pragma omp parallel
+	for(int j = 0; j < *j_max_ptr; j++)
+	{
+		// lattice of the low-pass coefficients of the previous level
+		const int lattice_x = stride_x * (1 << j);
+		const int lattice_y = stride_y * (1 << j);
+		const int size_src_x = ceil_div_pow2(size_x, j);
+		const int size_src_y = ceil_div_pow2(size_y, j);
+
+		#pragma omp for schedule(static)
+		for(int y = 0; y < size_src_y; y += group)
 		{
-			#pragma omp parallel for schedule(static, ceil_div(size_o_dst_y, omp_get_num_threads()))
-			for(int y = 0; y < size_o_dst_y; y++)
-				dwt_zero_padding_i_stride_d(
-					addr2_d(ptr,y,0,stride_x,stride_y),
-					size_i_dst_x,
-					size_o_dst_x,
-					stride_y);
-			#pragma omp parallel for schedule(static, ceil_div(size_o_dst_x, omp_get_num_threads()))
-			for(int x = 0; x < size_o_dst_x; x++)
-				dwt_zero_padding_i_stride_d(
-					addr2_d(ptr,0,x,stride_x,stride_y),
-					size_i_dst_y,
-					size_o_dst_y,
-					stride_x);
+			dwt_cdf97_f_inter_group_s(
+				addr2_s(ptr,y,0,lattice_x,lattice_y),
+				workspace_temp_s(workspace) + 3,
+				temp_dist,
+				size_src_x,
+				lattice_y,
+				min(group, size_src_y-y),
+				lattice_x);
 		}
 
-		j--;
+		const int cols = get_cols_s(size_src_y);
+
+		#pragma omp for schedule(static)
+		for(int x = 0; x < size_src_x; x += cols)
+		{
+			dwt_cdf97_f_inter_cols_s(
+				addr2_s(ptr,0,x,lattice_x,lattice_y),
+				workspace_block_s(workspace),
+				size_src_y,
+				lattice_x,
+				min(cols, size_src_x-x),
+				lattice_y);
+		}
 	}
+
+	release_workspace(workspace);
+
+	FUNC_END;
 }
 
-void dwt_cdf53_2i_d(
+void dwt_cdf97_2i_inter_s(
 	void *ptr,
 	int stride_x,
 	int stride_y,
-	int size_o_big_x,
-	int size_o_big_y,
-	int size_i_big_x,
-	int size_i_big_y,
-	int j_max,
-	int decompose_one,
-	int zero_padding)
+	int size_x,
+	int size_y,
+	int j_max)
 {
-	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
-	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
-
-	double temp[size_o_big_max];
-	if(NULL == temp)
-		abort();
-
-	int j = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
+	FUNC_BEGIN;
 
-	if( j_max >= 0 && j_max < j )
-		j = j_max;
+	// rows lifted together
+	const int group = get_accel_group_s();
+	// distance between temporary signals of one group, preserves alignment on 16 bytes
+	const int temp_dist = (calc_and_set_temp_size(max(size_x, size_y))+3) & ~3;
+	// one slab per thread, allocated once if set by dwt_util_set_workspace
+	struct dwt_workspace *workspace = acquire_workspace(max(size_x, size_y));
 
-	for(;;)
+	// one team for all levels, separated only by the barriers of the work-sharing loops
+	#pragma omp parallel
+	for(int j = j_max-1; j >= 0; j--)
 	{
-		if(0 == j)
-			break;
+		// lattice of the low-pass coefficients of the previous level
+		const int lattice_x = stride_x * (1 << j);
+		const int lattice_y = stride_y * (1 << j);
+		const int size_src_x = ceil_div_pow2(size_x, j);
+		const int size_src_y = ceil_div_pow2(size_y, j);
 
-		const int size_o_src_x = ceil_div_pow2(size_o_big_x, j  );
-		const int size_o_src_y = ceil_div_pow2(size_o_big_y, j  );
-		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, j-1);
-		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, j-1);
-		const int size_i_dst_x = ceil_div_pow2(size_i_big_x, j-1);
-		const int size_i_dst_y = ceil_div_pow2(size_i_big_y, j-1);
-
-		#pragma omp parallel for private(temp) schedule(static, ceil_div(size_o_dst_y, omp_get_num_threads()))
-		for(int y = 0; y < size_o_dst_y; y++)
-			dwt_cdf53_i_ex_stride_d(
-				addr2_d(ptr,y,0,stride_x,stride_y),
-				addr2_d(ptr,y,size_o_src_x,stride_x,stride_y),
-				addr2_d(ptr,y,0,stride_x,stride_y),
-				temp,
-				size_i_dst_x,
-				stride_y);
-		#pragma omp parallel for private(temp) schedule(static, ceil_div(size_o_dst_x, omp_get_num_threads()))
-		for(int x = 0; x < size_o_dst_x; x++)
-			dwt_cdf53_i_ex_stride_d(
-				addr2_d(ptr,0,x,stride_x,stride_y),
-				addr2_d(ptr,size_o_src_y,x,stride_x,stride_y),
-				addr2_d(ptr,0,x,stride_x,stride_y),
-				temp,
-				size_i_dst_y,
-				stride_x);
+		const int cols = get_cols_s(size_src_y);
 
-		if(zero_padding)
+		#pragma omp for schedule(static)
+		for(int x = 0; x < size_src_x; x += cols)
 		{
-			#pragma omp parallel for schedule(static, ceil_div(size_o_dst_y, omp_get_num_threads()))
-			for(int y = 0; y < size_o_dst_y; y++)
-				dwt_zero_padding_i_stride_d(
-					addr2_d(ptr,y,0,stride_x,stride_y),
-					size_i_dst_x,
-					size_o_dst_x,
-					stride_y);
-			#pragma omp parallel for schedule(static, ceil_div(size_o_dst_x, omp_get_num_threads()))
-			for(int x = 0; x < size_o_dst_x; x++)
-				dwt_zero_padding_i_stride_d(
-					addr2_d(ptr,0,x,stride_x,stride_y),
-					size_i_dst_y,
-					size_o_dst_y,
-					stride_x);
+			dwt_cdf97_i_inter_cols_s(
+				addr2_s(ptr,0,x,lattice_x,lattice_y),
+				workspace_block_s(workspace),
+				size_src_y,
+				lattice_x,
+				min(cols, size_src_x-x),
+				lattice_y);
 		}
 
-		j--;
+		#pragma omp for schedule(static)
+		for(int y = 0; y < size_src_y; y += group)
+		{
+			dwt_cdf97_i_inter_group_s(
+				addr2_s(ptr,y,0,lattice_x,lattice_y),
+				workspace_temp_s(workspace),
+				temp_dist,
+				size_src_x,
+				lattice_y,
+				min(group, size_src_y-y),
+				lattice_x);
+		}
 	}
+
+	release_workspace(workspace);
+
+	FUNC_END;
 }
 
-void dwt_cdf97_2i_s(
+static
+void dwt_cdf53_2i_core_s(
 	void *ptr,
 	int stride_x,
 	int stride_y,
@@ -6652,106 +16383,69 @@ void dwt_cdf97_2i_s(
 	int size_o_big_y,
 	int size_i_big_x,
 	int size_i_big_y,
-	int j_max,
-	int decompose_one,
+	int j_max_x,
+	int j_max_y,
 	int zero_padding)
 {
-	FUNC_BEGIN;
-
-#ifdef microblaze
-	dwt_util_switch_op(DWT_OP_LIFT4SB);
-#endif
-	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
 	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-	// FIXME: allocate temp[max_threads][temp_size] and remove private() in omp parallel
-	// FIXME: OpenMP cannot use this in private()
-#ifdef microblaze
-	float *temp = dwt_util_allocate_vec_s(calc_and_set_temp_size(size_o_big_max));
-#else
-	// FIXME(x86) BUG: temp[] is allocated on stack! so stack overflow is caused by big sizes of temp[size]
-	float temp[calc_and_set_temp_size(size_o_big_max)];
-#endif
-	if(NULL == temp)
-		abort(); // FIXME
-
-	int j = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
+	struct dwt_workspace *workspace = acquire_workspace(size_o_big_max);
 
-	if( j_max >= 0 && j_max < j )
-		j = j_max;
+	int j = max(j_max_x, j_max_y);
 
+	// one team for all levels, separated only by the barriers of the work-sharing loops
+	#pragma omp parallel firstprivate(j)
 	for(;;)
 	{
 		if(0 == j)
 			break;
 
-		const int size_o_src_x = ceil_div_pow2(size_o_big_x, j  );
-		const int size_o_src_y = ceil_div_pow2(size_o_big_y, j  );
-		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, j-1);
-		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, j-1);
-		const int size_i_dst_x = ceil_div_pow2(size_i_big_x, j-1);
-		const int size_i_dst_y = ceil_div_pow2(size_i_big_y, j-1);
-
-#ifdef _OPENMP
-		const int threads_segment_y = ceil_div(size_o_dst_y, dwt_util_get_num_threads());
-		const int threads_segment_x = ceil_div(size_o_dst_x, dwt_util_get_num_threads());
-#endif
-		const int workers_segment_y = ceil_div(size_o_dst_y, dwt_util_get_num_workers());
-		const int workers_segment_x = ceil_div(size_o_dst_x, dwt_util_get_num_workers());
-
-#ifdef microblaze
-		set_data_step_s( (intptr_t)addr2_s(ptr,workers_segment_y,0,stride_x,stride_y) - (intptr_t)addr2_s(ptr,0,0,stride_x,stride_y) );
-		set_data_limit_s( addr2_s(ptr,size_o_dst_y,0,stride_x,stride_y) );
-#endif
-		#pragma omp parallel for private(temp) schedule(static, threads_segment_y)
-		for(int y = 0; y < workers_segment_y; y++)
-			dwt_cdf97_i_ex_stride_s(
-				addr2_s(ptr,y,0,stride_x,stride_y),
-				addr2_s(ptr,y,size_o_src_x,stride_x,stride_y),
-				addr2_s(ptr,y,0,stride_x,stride_y),
-				temp,
-				size_i_dst_x,
-				stride_y);
-#ifdef microblaze
-		set_data_step_s( (intptr_t)addr2_s(ptr,0,workers_segment_x,stride_x,stride_y) - (intptr_t)addr2_s(ptr,0,0,stride_x,stride_y) );
-		set_data_limit_s( addr2_s(ptr,0,size_o_dst_x,stride_x,stride_y) );
-#endif
-		#pragma omp parallel for private(temp) schedule(static, threads_segment_x)
-		for(int x = 0; x < workers_segment_x; x++)
-			dwt_cdf97_i_ex_stride_s(
-				addr2_s(ptr,0,x,stride_x,stride_y),
-				addr2_s(ptr,size_o_src_y,x,stride_x,stride_y),
-				addr2_s(ptr,0,x,stride_x,stride_y),
-				temp,
-				size_i_dst_y,
-				stride_x);
+		const int size_o_src_x = ceil_div_pow2(size_o_big_x, min(j,   j_max_x));
+		const int size_o_src_y = ceil_div_pow2(size_o_big_y, min(j,   j_max_y));
+		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, min(j-1, j_max_x));
+		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, min(j-1, j_max_y));
+		const int size_i_dst_x = ceil_div_pow2(size_i_big_x, min(j-1, j_max_x));
+		const int size_i_dst_y = ceil_div_pow2(size_i_big_y, min(j-1, j_max_y));
 
-		if(zero_padding)
+		if( j <= j_max_x )
 		{
-			#pragma omp parallel for schedule(static, threads_segment_y)
+			#pragma omp for schedule(static, ceil_div(size_o_dst_y, omp_get_num_threads()))
 			for(int y = 0; y < size_o_dst_y; y++)
-				dwt_zero_padding_i_stride_s(
+				dwt_cdf53_i_ex_stride_s(
+					addr2_s(ptr,y,0,stride_x,stride_y),
+					addr2_s(ptr,y,size_o_src_x,stride_x,stride_y),
 					addr2_s(ptr,y,0,stride_x,stride_y),
+					workspace_temp_s(workspace),
 					size_i_dst_x,
-					size_o_dst_x,
 					stride_y);
-			#pragma omp parallel for schedule(static, threads_segment_x)
+		}
+		if( j <= j_max_y )
+		{
+			#pragma omp for schedule(static, ceil_div(size_o_dst_x, omp_get_num_threads()))
 			for(int x = 0; x < size_o_dst_x; x++)
-				dwt_zero_padding_i_stride_s(
+				dwt_cdf53_i_ex_stride_s(
+					addr2_s(ptr,0,x,stride_x,stride_y),
+					addr2_s(ptr,size_o_src_y,x,stride_x,stride_y),
 					addr2_s(ptr,0,x,stride_x,stride_y),
+					workspace_temp_s(workspace),
 					size_i_dst_y,
-					size_o_dst_y,
 					stride_x);
 		}
 
+		if(zero_padding)
+			dwt_zero_padding_2i_s(
+				ptr,
+				stride_x,
+				stride_y,
+				size_o_dst_x,
+				size_o_dst_y,
+				size_i_dst_x,
+				size_i_dst_y);
+
 		j--;
 	}
 
-#ifdef microblaze
-	free(temp);
-#endif
-
-	FUNC_END;
+	release_workspace(workspace);
 }
 
 void dwt_cdf53_2i_s(
@@ -6769,66 +16463,50 @@ void dwt_cdf53_2i_s(
 	const int size_o_big_min = min(size_o_big_x,size_o_big_y);
 	const int size_o_big_max = max(size_o_big_x,size_o_big_y);
 
-	float temp[size_o_big_max];
-	if(NULL == temp)
-		abort();
-
 	int j = ceil_log2(decompose_one?size_o_big_max:size_o_big_min);
 
 	if( j_max >= 0 && j_max < j )
 		j = j_max;
 
-	for(;;)
-	{
-		if(0 == j)
-			break;
-
-		const int size_o_src_x = ceil_div_pow2(size_o_big_x, j  );
-		const int size_o_src_y = ceil_div_pow2(size_o_big_y, j  );
-		const int size_o_dst_x = ceil_div_pow2(size_o_big_x, j-1);
-		const int size_o_dst_y = ceil_div_pow2(size_o_big_y, j-1);
-		const int size_i_dst_x = ceil_div_pow2(size_i_big_x, j-1);
-		const int size_i_dst_y = ceil_div_pow2(size_i_big_y, j-1);
-
-		#pragma omp parallel for private(temp) schedule(static, ceil_div(size_o_dst_y, omp_get_num_threads()))
-		for(int y = 0; y < size_o_dst_y; y++)
-			dwt_cdf53_i_ex_stride_s(
-				addr2_s(ptr,y,0,stride_x,stride_y),
-				addr2_s(ptr,y,size_o_src_x,stride_x,stride_y),
-				addr2_s(ptr,y,0,stride_x,stride_y),
-				temp,
-				size_i_dst_x,
-				stride_y);
-		#pragma omp parallel for private(temp) schedule(static, ceil_div(size_o_dst_x, omp_get_num_threads()))
-		for(int x = 0; x < size_o_dst_x; x++)
-			dwt_cdf53_i_ex_stride_s(
-				addr2_s(ptr,0,x,stride_x,stride_y),
-				addr2_s(ptr,size_o_src_y,x,stride_x,stride_y),
-				addr2_s(ptr,0,x,stride_x,stride_y),
-				temp,
-				size_i_dst_y,
-				stride_x);
+	dwt_cdf53_2i_core_s(
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j,
+		j,
+		zero_padding);
+}
 
-		if(zero_padding)
-		{
-			#pragma omp parallel for schedule(static, ceil_div(size_o_dst_y, omp_get_num_threads()))
-			for(int y = 0; y < size_o_dst_y; y++)
-				dwt_zero_padding_i_stride_s(
-					addr2_s(ptr,y,0,stride_x,stride_y),
-					size_i_dst_x,
-					size_o_dst_x,
-					stride_y);
-			#pragma omp parallel for schedule(static, ceil_div(size_o_dst_x, omp_get_num_threads()))
-			for(int x = 0; x < size_o_dst_x; x++)
-				dwt_zero_padding_i_stride_s(
-					addr2_s(ptr,0,x,stride_x,stride_y),
-					size_i_dst_y,
-					size_o_dst_y,
-					stride_x);
-		}
+void dwt_cdf53_2i_aniso_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max_x,
+	int j_max_y,
+	int zero_padding)
+{
+	const int j_limit_x = ceil_log2(size_o_big_x);
+	const int j_limit_y = ceil_log2(size_o_big_y);
 
-		j--;
-	}
+	dwt_cdf53_2i_core_s(
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j_max_x < 0 || j_max_x > j_limit_x ? j_limit_x : j_max_x,
+		j_max_y < 0 || j_max_y > j_limit_y ? j_limit_y : j_max_y,
+		zero_padding);
 }
 
 int dwt_util_clock_autoselect()
@@ -7404,25 +17082,110 @@ int dwt_util_get_max_threads()
 #endif /* _OPENMP */
 }
 
-int dwt_util_get_max_workers()
-{
-#ifdef microblaze
-	return get_total_workers();
-#else /* microblaze */
-	return 1;
-#endif /* microblaze */
-}
+int dwt_util_get_max_workers()
+{
+#ifdef microblaze
+	return get_total_workers();
+#else /* microblaze */
+	return 1;
+#endif /* microblaze */
+}
+
+#ifdef _OPENMP
+/** size of a team, found by dwt_util_get_num_threads, reset by dwt_util_set_num_threads */
+static int dwt_util_global_num_threads = 0;
+#endif
+
+void dwt_util_set_num_threads(
+	int num_threads)
+{
+	assert( num_threads > 0 );
+
+#ifdef _OPENMP
+	omp_set_num_threads(num_threads);
+	dwt_util_global_num_threads = 0;
+#else
+	UNUSED(num_threads);
+#endif
+}
+
+void dwt_util_set_level_grain(
+	int elements)
+{
+	dwt_util_global_level_grain = elements;
+}
+
+int dwt_util_get_level_grain()
+{
+	return dwt_util_global_level_grain;
+}
+
+int dwt_util_calibrate_level_grain()
+{
+	const int size = 256;
+	const int stride_y = sizeof(float);
+	const int stride_x = dwt_util_get_opt_stride(size * stride_y);
+	const int type = dwt_util_clock_autoselect();
+	const int threads = dwt_util_get_num_threads();
+	const int M = 16;
+
+	void *ptr;
+	dwt_util_alloc_image(&ptr, stride_x, stride_y, size, size);
+	dwt_util_test_image_fill_s(ptr, stride_x, stride_y, size, size, 0);
+
+	// cost of one element of a level on a single thread
+	dwt_clock_t elem = 0;
+
+	dwt_util_set_num_threads(1);
+	for(int m = 0; m < M; m++)
+	{
+		int j = 1;
+
+		const dwt_clock_t start = dwt_util_get_clock(type);
+		dwt_cdf97_2f_s(ptr, stride_x, stride_y, size, size, size, size, &j, 0, 0);
+		const dwt_clock_t stop = dwt_util_get_clock(type);
+
+		if( 0 == m || stop - start < elem )
+			elem = stop - start;
+	}
+	dwt_util_set_num_threads(threads);
+
+	dwt_util_free_image(&ptr);
+
+	// cost of a barrier of the whole team
+	dwt_clock_t sync = 0;
+
+	#pragma omp parallel
+	{
+		for(int m = 0; m < M; m++)
+		{
+			dwt_clock_t start = 0;
+
+			#pragma omp barrier
+			#pragma omp master
+			start = dwt_util_get_clock(type);
+
+			for(int b = 0; b < 64; b++)
+			{
+				#pragma omp barrier
+			}
+
+			#pragma omp master
+			{
+				const dwt_clock_t stop = dwt_util_get_clock(type);
 
-void dwt_util_set_num_threads(
-	int num_threads)
-{
-	assert( num_threads > 0 );
+				if( 0 == m || stop - start < sync )
+					sync = stop - start;
+			}
+		}
+	}
 
-#ifdef _OPENMP
-	omp_set_num_threads(num_threads);
-#else
-	UNUSED(num_threads);
-#endif
+	// the work of a thread should exceed the synchronization of a level many times
+	const double grain = 32. * ((double)sync / 64) / ((double)elem / size / size);
+
+	dwt_util_set_level_grain( max(1, (int)min(grain, (double)(1<<30))) );
+
+	return dwt_util_global_level_grain;
 }
 
 void dwt_util_set_num_workers(
@@ -7440,15 +17203,24 @@ void dwt_util_set_num_workers(
 int dwt_util_get_num_threads()
 {
 #ifdef _OPENMP
-	int num_threads;
-	#pragma omp parallel
+	// the team of the transform already runs
+	if( omp_in_parallel() )
+		return omp_get_num_threads();
+
+	if( !dwt_util_global_num_threads )
 	{
-		#pragma omp master
+		int num_threads;
+		#pragma omp parallel
 		{
-			num_threads = omp_get_num_threads();
+			#pragma omp master
+			{
+				num_threads = omp_get_num_threads();
+			}
 		}
+		dwt_util_global_num_threads = num_threads;
 	}
-	return num_threads;
+
+	return dwt_util_global_num_threads;
 #else
 	return 1;
 #endif
@@ -7463,6 +17235,173 @@ int dwt_util_get_num_workers()
 #endif
 }
 
+/**
+ * @{
+ * @brief Empty kernels of acceleration type 2, measuring the overhead of the transforms.
+ */
+static
+void accel_lift_op4s_main_empty_s(float *restrict arr, int steps, float alpha, float beta, float gamma, float delta, float zeta, int scaling)
+{
+	UNUSED(arr); UNUSED(steps); UNUSED(alpha); UNUSED(beta); UNUSED(gamma); UNUSED(delta); UNUSED(zeta); UNUSED(scaling);
+}
+
+static
+void accel_lift_op4s_main_empty_d(double *restrict arr, int steps, double alpha, double beta, double gamma, double delta, double zeta, int scaling)
+{
+	UNUSED(arr); UNUSED(steps); UNUSED(alpha); UNUSED(beta); UNUSED(gamma); UNUSED(delta); UNUSED(zeta); UNUSED(scaling);
+}
+
+static
+void accel_lift_op2s_main_empty_s(float *restrict arr, int steps, float alpha, float beta, float zeta, int scaling)
+{
+	UNUSED(arr); UNUSED(steps); UNUSED(alpha); UNUSED(beta); UNUSED(zeta); UNUSED(scaling);
+}
+
+static
+void accel_lift_op2s_main_empty_d(double *restrict arr, int steps, double alpha, double beta, double zeta, int scaling)
+{
+	UNUSED(arr); UNUSED(steps); UNUSED(alpha); UNUSED(beta); UNUSED(zeta); UNUSED(scaling);
+}
+/** @} */
+
+/**
+ * @brief Detect instruction sets of the running CPU and resolve the kernels
+ * of all acceleration types.
+ *
+ * Types 1 and 3 (block-acceleration) lift single precision signals on their
+ * own, their double precision and two-step signals use the multi-loop
+ * algorithms as type 0.
+ */
+static
+void accel_table_init()
+{
+#ifdef USE_CPU_DISPATCH
+	__builtin_cpu_init();
+
+	dwt_util_global_cpu_avx = __builtin_cpu_supports("avx");
+	dwt_util_global_cpu_avx512f = __builtin_cpu_supports("avx512f");
+#endif
+
+	struct accel_kernels *table = dwt_util_global_accel_table;
+
+	for(int type = 0; type < ACCEL_TYPES; type++)
+	{
+		const struct accel_kernels none = { NULL, NULL, NULL, 1, NULL, NULL, NULL, NULL };
+
+		table[type] = none;
+	}
+
+	// no lifting at all
+	table[2].main_s = accel_lift_op4s_main_empty_s;
+	table[2].main_d = accel_lift_op4s_main_empty_d;
+	table[2].main_op2s_s = accel_lift_op2s_main_empty_s;
+	table[2].main_op2s_d = accel_lift_op2s_main_empty_d;
+
+	// double-loop algorithm
+	table[4].main_s = accel_lift_op4s_main_dl_s;
+	table[4].main_d = accel_lift_op4s_main_dl_d;
+	table[4].main_op2s_s = accel_lift_op2s_main_dl_s;
+	table[4].main_op2s_d = accel_lift_op2s_main_dl_d;
+
+	// single-loop algorithms, vectorized from type 8 on
+	for(int type = 5; type <= 13; type++)
+	{
+		table[type].main_sdl_d = accel_lift_op4s_main_sdl_ref_d;
+		table[type].main_op2s_s = accel_lift_op2s_main_sdl_ref_s;
+		table[type].main_op2s_d = accel_lift_op2s_main_dl_d;
+#ifdef __SSE__
+		if( type >= 8 )
+			table[type].main_op2s_s = accel_lift_op2s_main_sdl_sse_s;
+#endif
+#ifdef __SSE2__
+		if( type >= 8 )
+		{
+			table[type].main_sdl_d = accel_lift_op4s_main_sdl_sse2_d;
+			table[type].main_op2s_d = accel_lift_op2s_main_sdl_sse2_d;
+		}
+#endif
+#ifdef USE_AVX
+		if( type >= 10 && cpu_has_avx() )
+		{
+			table[type].main_sdl_d = accel_lift_op4s_main_sdl_avx_d;
+			table[type].main_op2s_s = accel_lift_op2s_main_sdl_avx_s;
+			table[type].main_op2s_d = accel_lift_op2s_main_sdl_avx_d;
+		}
+#endif
+	}
+
+	table[5].main_sdl_s = accel_lift_op4s_main_sdl_ref_s;
+	table[6].main_sdl_s = accel_lift_op4s_main_sdl2_ref_s;
+	table[7].main_sdl_s = accel_lift_op4s_main_sdl6_ref_s;
+
+	// even types from 8 on lift two pairs of coefficients in a step, odd ones six pairs
+	for(int type = 8; type <= 13; type++)
+	{
+#ifdef __SSE__
+		table[type].main_sdl_s = type & 1 ? accel_lift_op4s_main_sdl6_sse_s : accel_lift_op4s_main_sdl2_sse_s;
+#else
+		table[type].main_sdl_s = type & 1 ? accel_lift_op4s_main_sdl6_ref_s : accel_lift_op4s_main_sdl2_ref_s;
+#endif
+	}
+
+#ifdef USE_AVX
+	if( cpu_has_avx() )
+	{
+		table[10].main_group_s = accel_lift_op4s_main_sdl2_avx_s;
+		table[10].group_s = 2;
+		table[11].main_group_s = accel_lift_op4s_main_sdl6_avx_s;
+		table[11].group_s = 2;
+	}
+#endif
+#ifdef USE_AVX512F
+	if( cpu_has_avx512f() )
+	{
+		table[12].main_group_s = accel_lift_op4s_main_sdl2_avx512_s;
+		table[12].group_s = 4;
+		table[13].main_group_s = accel_lift_op4s_main_sdl6_avx512_s;
+		table[13].group_s = 4;
+	}
+#endif
+
+	// automatic acceleration, the best kernels of the running CPU
+#ifdef __SSE__
+	table[ACCEL_AUTO].main_sdl_s = accel_lift_op4s_main_sdl6_sse_s;
+#endif
+#ifdef USE_AVX
+	if( cpu_has_avx() )
+	{
+		table[ACCEL_AUTO].main_group_s = accel_lift_op4s_main_sdl6_avx_s;
+		table[ACCEL_AUTO].group_s = 2;
+	}
+#endif
+#ifdef USE_AVX512F
+	if( cpu_has_avx512f() )
+	{
+		table[ACCEL_AUTO].main_group_s = accel_lift_op4s_main_sdl2_avx512_s;
+		table[ACCEL_AUTO].group_s = 4;
+	}
+#endif
+
+	// NOTE: the AVX kernel is slower here due to the latency of cross-lane shuffles
+#ifdef __SSE2__
+	table[ACCEL_AUTO].main_sdl_d = accel_lift_op4s_main_sdl_sse2_d;
+#endif
+
+#ifdef __SSE__
+	table[ACCEL_AUTO].main_op2s_s = accel_lift_op2s_main_sdl_sse_s;
+#endif
+#ifdef __SSE2__
+	table[ACCEL_AUTO].main_op2s_d = accel_lift_op2s_main_sdl_sse2_d;
+#endif
+#ifdef USE_AVX
+	if( cpu_has_avx() )
+	{
+		table[ACCEL_AUTO].main_op2s_s = accel_lift_op2s_main_sdl_avx_s;
+		table[ACCEL_AUTO].main_op2s_d = accel_lift_op2s_main_sdl_avx_d;
+	}
+#endif
+}
+
 void dwt_util_init()
 {
 	FUNC_BEGIN;
@@ -7486,6 +17425,10 @@ void dwt_util_init()
 	}
 
 	dwt_util_set_accel(1);
+#else
+	accel_table_init();
+
+	dwt_util_set_accel(ACCEL_AUTO);
 #endif /* microblaze */
 
 	FUNC_END;
@@ -7671,6 +17614,29 @@ void dwt_util_set_accel(
 	set_accel_type(accel_type);
 }
 
+void dwt_util_set_vert(
+	enum dwt_vert vert_type)
+{
+	dwt_util_global_vert_type = vert_type;
+}
+
+void dwt_util_set_sched(
+	enum dwt_sched sched_type)
+{
+	dwt_util_global_sched = sched_type;
+}
+
+enum dwt_sched dwt_util_get_sched()
+{
+	return dwt_util_global_sched;
+}
+
+void dwt_util_set_tile(
+	int size)
+{
+	dwt_util_global_tile_size = size;
+}
+
 #define iszero(x) (fpclassify(x) == FP_ZERO)
 
 int dwt_util_is_normal_or_zero_i(const float *a)
@@ -8163,6 +18129,39 @@ void dwt_util_subband(
 	void **dst_ptr,
 	int *dst_size_x,
 	int *dst_size_y)
+{
+	dwt_util_subband_aniso(
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j_max,
+		j_max,
+		j_max,
+		band,
+		dst_ptr,
+		dst_size_x,
+		dst_size_y);
+}
+
+void dwt_util_subband_aniso(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j,
+	int j_max_x,
+	int j_max_y,
+	enum dwt_subbands band,
+	void **dst_ptr,
+	int *dst_size_x,
+	int *dst_size_y)
 {
 	assert( ptr != NULL && size_i_big_x >= 0 && size_i_big_y >= 0 && size_o_big_x >= 0 && size_o_big_y >= 0 );
 
@@ -8173,105 +18172,493 @@ void dwt_util_subband(
 	int outer_x = size_o_big_x;
 	int outer_y = size_o_big_y;
 
-	for(int j = 1; j <= j_max; j++)
+	for(int k = 1; k <= j; k++)
 	{
-		inner_H_x = floor_div2(inner_L_x);
-		inner_H_y = floor_div2(inner_L_y);
-		inner_L_x = ceil_div2 (inner_L_x);
-		inner_L_y = ceil_div2 (inner_L_y);
-		outer_x   = ceil_div2 (outer_x);
-		outer_y   = ceil_div2 (outer_y);
+		// the high-pass part is empty on levels without the pass
+		inner_H_x = k > j_max_x ? 0 : floor_div2(inner_L_x);
+		inner_H_y = k > j_max_y ? 0 : floor_div2(inner_L_y);
+		inner_L_x = k > j_max_x ? inner_L_x : ceil_div2(inner_L_x);
+		inner_L_y = k > j_max_y ? inner_L_y : ceil_div2(inner_L_y);
+		outer_x   = k > j_max_x ? outer_x   : ceil_div2(outer_x);
+		outer_y   = k > j_max_y ? outer_y   : ceil_div2(outer_y);
 	}
 
 	switch(band)
 	{
-		case DWT_LL:
-			*dst_ptr = addr2(ptr,
-				0, 0,
-				stride_x, stride_y);
-			*dst_size_x = inner_L_x;
-			*dst_size_y = inner_L_y;
-			break;
-		case DWT_HL:
-			*dst_ptr = addr2(ptr,
-				0, outer_x,
-				stride_x, stride_y);
-			*dst_size_x = inner_H_x;
-			*dst_size_y = inner_L_y;
+		case DWT_LL:
+			*dst_ptr = addr2(ptr,
+				0, 0,
+				stride_x, stride_y);
+			*dst_size_x = inner_L_x;
+			*dst_size_y = inner_L_y;
+			break;
+		case DWT_HL:
+			*dst_ptr = addr2(ptr,
+				0, outer_x,
+				stride_x, stride_y);
+			*dst_size_x = inner_H_x;
+			*dst_size_y = inner_L_y;
+			break;
+		case DWT_LH:
+			*dst_ptr = addr2(ptr,
+				outer_y, 0,
+				stride_x, stride_y);
+			*dst_size_x = inner_L_x;
+			*dst_size_y = inner_H_y;
+			break;
+		case DWT_HH:
+			*dst_ptr = addr2(ptr,
+				outer_y, outer_x,
+				stride_x, stride_y);
+			*dst_size_x = inner_H_x;
+			*dst_size_y = inner_H_y;
+			break;
+	}
+}
+
+void dwt_util_subband_s(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max,
+	enum dwt_subbands band,
+	void **dst_ptr,
+	int *dst_size_x,
+	int *dst_size_y)
+{
+	dwt_util_subband(
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j_max,
+		band,
+		dst_ptr,
+		dst_size_x,
+		dst_size_y);
+}
+
+void dwt_util_subband_d(
+	void *ptr,
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max,
+	enum dwt_subbands band,
+	void **dst_ptr,
+	int *dst_size_x,
+	int *dst_size_y)
+{
+	dwt_util_subband(
+		ptr,
+		stride_x,
+		stride_y,
+		size_o_big_x,
+		size_o_big_y,
+		size_i_big_x,
+		size_i_big_y,
+		j_max,
+		band,
+		dst_ptr,
+		dst_size_x,
+		dst_size_y);
+}
+
+/**
+ * @brief Subband of the given layout, its elements are @p elem bytes wide.
+ */
+static
+void dwt_util_subband_layout(
+	void *ptr,
+	enum dwt_layout layout,
+	int elem,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int j,
+	int j_max,
+	enum dwt_subbands band,
+	void **dst_ptr,
+	int *dst_size_x,
+	int *dst_size_y,
+	int *dst_stride_x,
+	int *dst_stride_y)
+{
+	assert( ptr != NULL && size_x >= 0 && size_y >= 0 && j >= 0 && j <= j_max );
+
+	// subbands of the level j
+	const int size_L_x = ceil_div_pow2(size_x, j);
+	const int size_L_y = ceil_div_pow2(size_y, j);
+	const int size_H_x = j ? floor_div2(ceil_div_pow2(size_x, j-1)) : 0;
+	const int size_H_y = j ? floor_div2(ceil_div_pow2(size_y, j-1)) : 0;
+
+	*dst_size_x = DWT_HL == band || DWT_HH == band ? size_H_x : size_L_x;
+	*dst_size_y = DWT_LH == band || DWT_HH == band ? size_H_y : size_L_y;
+
+	switch(layout)
+	{
+		case DWT_LAYOUT_MALLAT:
+			dwt_util_subband(
+				ptr,
+				stride_x,
+				stride_y,
+				size_x,
+				size_y,
+				size_x,
+				size_y,
+				j,
+				band,
+				dst_ptr,
+				dst_size_x,
+				dst_size_y);
+			*dst_stride_x = stride_x;
+			*dst_stride_y = stride_y;
 			break;
-		case DWT_LH:
+		case DWT_LAYOUT_INTERLEAVED:
+		{
+			// the high-pass coefficients lie between the low-pass ones of the level j
+			const int half = j ? 1 << (j-1) : 0;
+
 			*dst_ptr = addr2(ptr,
-				outer_y, 0,
+				DWT_LH == band || DWT_HH == band ? half : 0,
+				DWT_HL == band || DWT_HH == band ? half : 0,
 				stride_x, stride_y);
-			*dst_size_x = inner_L_x;
-			*dst_size_y = inner_H_y;
+			*dst_stride_x = stride_x * (1 << j);
+			*dst_stride_y = stride_y * (1 << j);
 			break;
-		case DWT_HH:
-			*dst_ptr = addr2(ptr,
-				outer_y, outer_x,
-				stride_x, stride_y);
-			*dst_size_x = inner_H_x;
-			*dst_size_y = inner_H_y;
+		}
+		case DWT_LAYOUT_PACKED:
+		{
+			// the LL subband of the deepest level comes first
+			size_t offset = (size_t)ceil_div_pow2(size_x, j_max) * ceil_div_pow2(size_y, j_max);
+
+			for(int k = j_max; k > j; k--)
+			{
+				const int size_L_k_x = ceil_div_pow2(size_x, k);
+				const int size_L_k_y = ceil_div_pow2(size_y, k);
+				const int size_H_k_x = floor_div2(ceil_div_pow2(size_x, k-1));
+				const int size_H_k_y = floor_div2(ceil_div_pow2(size_y, k-1));
+
+				offset += (size_t)size_H_k_x * size_L_k_y + (size_t)size_L_k_x * size_H_k_y + (size_t)size_H_k_x * size_H_k_y;
+			}
+
+			switch(band)
+			{
+				case DWT_LL:
+					// only the LL subband of the deepest level is stored
+					offset = 0;
+					if( j != j_max )
+						*dst_size_x = *dst_size_y = 0;
+					break;
+				case DWT_HL:
+					break;
+				case DWT_LH:
+					offset += (size_t)size_H_x * size_L_y;
+					break;
+				case DWT_HH:
+					offset += (size_t)size_H_x * size_L_y + (size_t)size_L_x * size_H_y;
+					break;
+			}
+
+			*dst_ptr = (char *)ptr + offset * elem;
+			*dst_stride_x = *dst_size_x * elem;
+			*dst_stride_y = elem;
 			break;
+		}
 	}
 }
 
-void dwt_util_subband_s(
+void dwt_util_subband_layout_s(
 	void *ptr,
+	enum dwt_layout layout,
 	int stride_x,
 	int stride_y,
-	int size_o_big_x,
-	int size_o_big_y,
-	int size_i_big_x,
-	int size_i_big_y,
+	int size_x,
+	int size_y,
+	int j,
 	int j_max,
 	enum dwt_subbands band,
 	void **dst_ptr,
 	int *dst_size_x,
-	int *dst_size_y)
+	int *dst_size_y,
+	int *dst_stride_x,
+	int *dst_stride_y)
 {
-	dwt_util_subband(
+	dwt_util_subband_layout(
 		ptr,
+		layout,
+		sizeof(float),
 		stride_x,
 		stride_y,
-		size_o_big_x,
-		size_o_big_y,
-		size_i_big_x,
-		size_i_big_y,
+		size_x,
+		size_y,
+		j,
 		j_max,
 		band,
 		dst_ptr,
 		dst_size_x,
-		dst_size_y);
+		dst_size_y,
+		dst_stride_x,
+		dst_stride_y);
 }
 
-void dwt_util_subband_d(
+void dwt_util_subband_layout_d(
 	void *ptr,
+	enum dwt_layout layout,
 	int stride_x,
 	int stride_y,
-	int size_o_big_x,
-	int size_o_big_y,
-	int size_i_big_x,
-	int size_i_big_y,
+	int size_x,
+	int size_y,
+	int j,
 	int j_max,
 	enum dwt_subbands band,
 	void **dst_ptr,
 	int *dst_size_x,
-	int *dst_size_y)
+	int *dst_size_y,
+	int *dst_stride_x,
+	int *dst_stride_y)
 {
-	dwt_util_subband(
+	dwt_util_subband_layout(
 		ptr,
+		layout,
+		sizeof(double),
 		stride_x,
 		stride_y,
-		size_o_big_x,
-		size_o_big_y,
-		size_i_big_x,
-		size_i_big_y,
+		size_x,
+		size_y,
+		j,
 		j_max,
 		band,
 		dst_ptr,
 		dst_size_x,
-		dst_size_y);
+		dst_size_y,
+		dst_stride_x,
+		dst_stride_y);
+}
+
+/**
+ * @brief Address of the coefficient at (@p y, @p x) of the Mallat layout in the given layout.
+ */
+static
+void *dwt_util_addr_coeff_layout(
+	void *ptr,
+	enum dwt_layout layout,
+	int elem,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int j_max,
+	int y,
+	int x)
+{
+	enum dwt_subbands band = DWT_LL;
+	int j = j_max;
+
+	// find the finest level the coefficient does not belong to its LL subband
+	for(int k = 1; k <= j_max; k++)
+	{
+		const int size_L_x = ceil_div_pow2(size_x, k);
+		const int size_L_y = ceil_div_pow2(size_y, k);
+
+		if( x >= size_L_x || y >= size_L_y )
+		{
+			band = y < size_L_y ? DWT_HL : ( x < size_L_x ? DWT_LH : DWT_HH );
+			x -= x >= size_L_x ? size_L_x : 0;
+			y -= y >= size_L_y ? size_L_y : 0;
+			j = k;
+			break;
+		}
+	}
+
+	void *band_ptr;
+	int band_size_x, band_size_y, band_stride_x, band_stride_y;
+
+	dwt_util_subband_layout(
+		ptr,
+		layout,
+		elem,
+		stride_x,
+		stride_y,
+		size_x,
+		size_y,
+		j,
+		j_max,
+		band,
+		&band_ptr,
+		&band_size_x,
+		&band_size_y,
+		&band_stride_x,
+		&band_stride_y);
+
+	return addr2(band_ptr, y, x, band_stride_x, band_stride_y);
+}
+
+float *dwt_util_addr_coeff_layout_s(
+	void *ptr,
+	enum dwt_layout layout,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int j_max,
+	int y,
+	int x)
+{
+	return (float *)dwt_util_addr_coeff_layout(
+		ptr,
+		layout,
+		sizeof(float),
+		stride_x,
+		stride_y,
+		size_x,
+		size_y,
+		j_max,
+		y,
+		x);
+}
+
+double *dwt_util_addr_coeff_layout_d(
+	void *ptr,
+	enum dwt_layout layout,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int j_max,
+	int y,
+	int x)
+{
+	return (double *)dwt_util_addr_coeff_layout(
+		ptr,
+		layout,
+		sizeof(double),
+		stride_x,
+		stride_y,
+		size_x,
+		size_y,
+		j_max,
+		y,
+		x);
+}
+
+static
+void dwt_util_convert_band_s(
+	const void *src,
+	enum dwt_layout src_layout,
+	void *dst,
+	enum dwt_layout dst_layout,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int j,
+	int j_max,
+	enum dwt_subbands band)
+{
+	void *src_band, *dst_band;
+	int size_band_x, size_band_y, src_stride_x, src_stride_y, dst_stride_x, dst_stride_y;
+
+	dwt_util_subband_layout_s((void *)src, src_layout, stride_x, stride_y, size_x, size_y, j, j_max, band,
+		&src_band, &size_band_x, &size_band_y, &src_stride_x, &src_stride_y);
+	dwt_util_subband_layout_s(dst, dst_layout, stride_x, stride_y, size_x, size_y, j, j_max, band,
+		&dst_band, &size_band_x, &size_band_y, &dst_stride_x, &dst_stride_y);
+
+	for(int y = 0; y < size_band_y; y++)
+		dwt_util_memcpy_stride_s(
+			addr2_s(dst_band,y,0,dst_stride_x,dst_stride_y),
+			dst_stride_y,
+			addr2_const_s(src_band,y,0,src_stride_x,src_stride_y),
+			src_stride_y,
+			size_band_x);
+}
+
+void dwt_util_convert_layout_s(
+	const void *src,
+	enum dwt_layout src_layout,
+	void *dst,
+	enum dwt_layout dst_layout,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int j_max)
+{
+	assert( src != NULL && dst != NULL && src != dst );
+
+	dwt_util_convert_band_s(src, src_layout, dst, dst_layout, stride_x, stride_y, size_x, size_y, j_max, j_max, DWT_LL);
+
+	for(int j = j_max; j > 0; j--)
+	{
+		dwt_util_convert_band_s(src, src_layout, dst, dst_layout, stride_x, stride_y, size_x, size_y, j, j_max, DWT_HL);
+		dwt_util_convert_band_s(src, src_layout, dst, dst_layout, stride_x, stride_y, size_x, size_y, j, j_max, DWT_LH);
+		dwt_util_convert_band_s(src, src_layout, dst, dst_layout, stride_x, stride_y, size_x, size_y, j, j_max, DWT_HH);
+	}
+}
+
+static
+void dwt_util_convert_band_d(
+	const void *src,
+	enum dwt_layout src_layout,
+	void *dst,
+	enum dwt_layout dst_layout,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int j,
+	int j_max,
+	enum dwt_subbands band)
+{
+	void *src_band, *dst_band;
+	int size_band_x, size_band_y, src_stride_x, src_stride_y, dst_stride_x, dst_stride_y;
+
+	dwt_util_subband_layout_d((void *)src, src_layout, stride_x, stride_y, size_x, size_y, j, j_max, band,
+		&src_band, &size_band_x, &size_band_y, &src_stride_x, &src_stride_y);
+	dwt_util_subband_layout_d(dst, dst_layout, stride_x, stride_y, size_x, size_y, j, j_max, band,
+		&dst_band, &size_band_x, &size_band_y, &dst_stride_x, &dst_stride_y);
+
+	for(int y = 0; y < size_band_y; y++)
+		dwt_util_memcpy_stride_d(
+			addr2_d(dst_band,y,0,dst_stride_x,dst_stride_y),
+			dst_stride_y,
+			addr2_const_d(src_band,y,0,src_stride_x,src_stride_y),
+			src_stride_y,
+			size_band_x);
+}
+
+void dwt_util_convert_layout_d(
+	const void *src,
+	enum dwt_layout src_layout,
+	void *dst,
+	enum dwt_layout dst_layout,
+	int stride_x,
+	int stride_y,
+	int size_x,
+	int size_y,
+	int j_max)
+{
+	assert( src != NULL && dst != NULL && src != dst );
+
+	dwt_util_convert_band_d(src, src_layout, dst, dst_layout, stride_x, stride_y, size_x, size_y, j_max, j_max, DWT_LL);
+
+	for(int j = j_max; j > 0; j--)
+	{
+		dwt_util_convert_band_d(src, src_layout, dst, dst_layout, stride_x, stride_y, size_x, size_y, j, j_max, DWT_HL);
+		dwt_util_convert_band_d(src, src_layout, dst, dst_layout, stride_x, stride_y, size_x, size_y, j, j_max, DWT_LH);
+		dwt_util_convert_band_d(src, src_layout, dst, dst_layout, stride_x, stride_y, size_x, size_y, j, j_max, DWT_HH);
+	}
 }
 
 /**
@@ -8500,6 +18887,100 @@ void dwt_util_perf_cdf97_2_s(
 	FUNC_END;
 }
 
+void dwt_util_perf_cdf97_2_batch_s(
+	int stride_x,
+	int stride_y,
+	int size_o_big_x,
+	int size_o_big_y,
+	int size_i_big_x,
+	int size_i_big_y,
+	int j_max,
+	int decompose_one,
+	int zero_padding,
+	int M,
+	int N,
+	int clock_type,
+	float *fwd_secs,
+	float *inv_secs)
+{
+	FUNC_BEGIN;
+
+	assert( M > 0 && N > 0 && fwd_secs && inv_secs );
+
+	assert( size_o_big_x > 0 && size_o_big_y > 0 && size_i_big_x > 0 && size_i_big_y > 0 );
+
+	// M images of the batch
+	struct dwt_image image[M];
+
+	// allocate M images
+	for(int m = 0; m < M; m++)
+	{
+		image[m].stride_x = stride_x;
+		image[m].stride_y = stride_y;
+		image[m].size_o_big_x = size_o_big_x;
+		image[m].size_o_big_y = size_o_big_y;
+		image[m].size_i_big_x = size_i_big_x;
+		image[m].size_i_big_y = size_i_big_y;
+		image[m].j_max = j_max;
+
+		// allocate
+		dwt_util_alloc_image(
+			&image[m].ptr,
+			stride_x,
+			stride_y,
+			size_o_big_x,
+			size_o_big_y);
+
+		// fill with test pattern
+		dwt_util_test_image_fill_s(
+			image[m].ptr,
+			stride_x,
+			stride_y,
+			size_i_big_x,
+			size_i_big_y,
+			0);
+	}
+
+	*fwd_secs = +INFINITY;
+	*inv_secs = +INFINITY;
+
+	// perform N test loops, select minimum
+	for(int n = 0; n < N; n++)
+	{
+		// start timer
+		const dwt_clock_t time_fwd_start = dwt_util_get_clock(clock_type);
+		// perform M fwd transforms
+		dwt_cdf97_2f_batch_s(image, M, decompose_one, zero_padding);
+		// stop timer
+		const dwt_clock_t time_fwd_stop = dwt_util_get_clock(clock_type);
+		// calc avg
+		const float time_fwd_secs = (float)(time_fwd_stop - time_fwd_start) / M / dwt_util_get_frequency(clock_type);
+		// select min
+		if( time_fwd_secs < *fwd_secs )
+			*fwd_secs = time_fwd_secs;
+
+		// start timer
+		const dwt_clock_t time_inv_start = dwt_util_get_clock(clock_type);
+		// perform M inv transforms
+		dwt_cdf97_2i_batch_s(image, M, decompose_one, zero_padding);
+		// stop timer
+		const dwt_clock_t time_inv_stop = dwt_util_get_clock(clock_type);
+		// calc avg
+		const float time_inv_secs = (float)(time_inv_stop - time_inv_start) / M / dwt_util_get_frequency(clock_type);
+		// select min
+		if( time_inv_secs < *inv_secs )
+			*inv_secs = time_inv_secs;
+	}
+
+	// free M images
+	for(int m = 0; m < M; m++)
+	{
+		dwt_util_free_image(&image[m].ptr);
+	}
+
+	FUNC_END;
+}
+
 void dwt_util_perf_cdf97_2_d(
 	int stride_x,
 	int stride_y,
@@ -465,6 +465,79 @@ void dwt_cdf97_2f_d(
 	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
 );
 
+/**
+ * @brief Forward image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, out-of-place version.
+ *
+ * The nested image is read from @p src, the transform is stored into @p ptr.
+ * The copy is fused into the horizontal pass of the first decomposition
+ * level, so @p src is not modified and it does not need to be copied in
+ * advance. The unused area of the outer frame in @p ptr is filled only when
+ * @p zero_padding is set.
+ *
+ * This function works with double precision floating point numbers (i.e. double data type).
+ */
+void dwt_cdf97_2f_ex_d(
+	const void *src,	///< pointer to beginning of source image data
+	int src_stride_x,	///< difference between rows of source image (in bytes)
+	void *ptr,		///< pointer to beginning of transform data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns of both images (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int *j_max_ptr,		///< pointer to the number of intended decomposition levels (scales), the number of achieved decomposition levels will be stored also here
+	int decompose_one,	///< should be row or column of size one pixel decomposed? zero value if not
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
+/**
+ * @brief Forward image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, anisotropic in-place version.
+ *
+ * The rows are decomposed into @p j_max_x_ptr levels and the columns into
+ * @p j_max_y_ptr levels. Each level lifts both the rows and the columns
+ * until one of the depths is reached. Later levels lift only the low-pass
+ * part along the remaining axis, so @p j_max_y_ptr equal to zero gives a
+ * horizontal-only transform of all rows. Use @ref dwt_util_subband_aniso to
+ * locate the subbands.
+ *
+ * This function works with double precision floating point numbers (i.e. double data type).
+ */
+void dwt_cdf97_2f_aniso_d(
+	void *ptr,		///< pointer to beginning of image data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int *j_max_x_ptr,	///< pointer to the number of intended horizontal decomposition levels, the number of achieved levels will be stored also here
+	int *j_max_y_ptr,	///< pointer to the number of intended vertical decomposition levels, the number of achieved levels will be stored also here
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
+/**
+ * @brief Forward image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, interleaved in-place version.
+ *
+ * The coefficients are not split into the subbands, they stay at the
+ * positions where the lifting scheme computes them (see
+ * @ref DWT_LAYOUT_INTERLEAVED), so no deinterleaving copies are made. Use
+ * @ref dwt_util_subband_layout_s to locate the subbands or
+ * @ref dwt_util_convert_layout_s to get the Mallat layout of
+ * @ref dwt_cdf97_2f_s. The image has no outer frame.
+ *
+ * This function works with single precision floating point numbers (i.e. float data type).
+ */
+void dwt_cdf97_2f_inter_s(
+	void *ptr,		///< pointer to beginning of image data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_x,		///< width of image (in elements)
+	int size_y,		///< height of image (in elements)
+	int *j_max_ptr,		///< pointer to the number of intended decomposition levels (scales), the number of achieved decomposition levels will be stored also here
+	int decompose_one	///< should be row or column of size one pixel decomposed? zero value if not
+);
+
 /**
  * @brief Forward image fast wavelet transform using CDF 5/3 wavelet and lifting scheme, in-place version.
  *
@@ -483,6 +556,57 @@ void dwt_cdf53_2f_d(
 	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
 );
 
+/**
+ * @brief Forward image fast wavelet transform using CDF 5/3 wavelet and lifting scheme, out-of-place version.
+ *
+ * The nested image is read from @p src, the transform is stored into @p ptr.
+ * The copy is fused into the horizontal pass of the first decomposition
+ * level, so @p src is not modified and it does not need to be copied in
+ * advance. The unused area of the outer frame in @p ptr is filled only when
+ * @p zero_padding is set.
+ *
+ * This function works with double precision floating point numbers (i.e. double data type).
+ */
+void dwt_cdf53_2f_ex_d(
+	const void *src,	///< pointer to beginning of source image data
+	int src_stride_x,	///< difference between rows of source image (in bytes)
+	void *ptr,		///< pointer to beginning of transform data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns of both images (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int *j_max_ptr,		///< pointer to the number of intended decomposition levels (scales), the number of achieved decomposition levels will be stored also here
+	int decompose_one,	///< should be row or column of size one pixel decomposed? zero value if not
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
+/**
+ * @brief Forward image fast wavelet transform using CDF 5/3 wavelet and lifting scheme, anisotropic in-place version.
+ *
+ * The rows are decomposed into @p j_max_x_ptr levels and the columns into
+ * @p j_max_y_ptr levels. Each level lifts both the rows and the columns
+ * until one of the depths is reached. Later levels lift only the low-pass
+ * part along the remaining axis, so @p j_max_y_ptr equal to zero gives a
+ * horizontal-only transform of all rows. Use @ref dwt_util_subband_aniso to
+ * locate the subbands.
+ *
+ * This function works with double precision floating point numbers (i.e. double data type).
+ */
+void dwt_cdf53_2f_aniso_d(
+	void *ptr,		///< pointer to beginning of image data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int *j_max_x_ptr,	///< pointer to the number of intended horizontal decomposition levels, the number of achieved levels will be stored also here
+	int *j_max_y_ptr,	///< pointer to the number of intended vertical decomposition levels, the number of achieved levels will be stored also here
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
 /**
  * @brief Forward image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, in-place version.
  *
@@ -501,6 +625,59 @@ void dwt_cdf97_2f_s(
 	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
 );
 
+/**
+ * @brief Forward image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, out-of-place version.
+ *
+ * The nested image is read from @p src, the transform is stored into @p ptr.
+ * The copy is fused into the horizontal pass of the first decomposition
+ * level, so @p src is not modified and it does not need to be copied in
+ * advance. The unused area of the outer frame in @p ptr is filled only when
+ * @p zero_padding is set.
+ * The single-loop and tiled strategies (see @ref dwt_util_set_vert) copy
+ * the nested image first.
+ *
+ * This function works with single precision floating point numbers (i.e. float data type).
+ */
+void dwt_cdf97_2f_ex_s(
+	const void *src,	///< pointer to beginning of source image data
+	int src_stride_x,	///< difference between rows of source image (in bytes)
+	void *ptr,		///< pointer to beginning of transform data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns of both images (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int *j_max_ptr,		///< pointer to the number of intended decomposition levels (scales), the number of achieved decomposition levels will be stored also here
+	int decompose_one,	///< should be row or column of size one pixel decomposed? zero value if not
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
+/**
+ * @brief Forward image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, anisotropic in-place version.
+ *
+ * The rows are decomposed into @p j_max_x_ptr levels and the columns into
+ * @p j_max_y_ptr levels. Each level lifts both the rows and the columns
+ * until one of the depths is reached. Later levels lift only the low-pass
+ * part along the remaining axis, so @p j_max_y_ptr equal to zero gives a
+ * horizontal-only transform of all rows. Use @ref dwt_util_subband_aniso to
+ * locate the subbands.
+ *
+ * This function works with single precision floating point numbers (i.e. float data type).
+ */
+void dwt_cdf97_2f_aniso_s(
+	void *ptr,		///< pointer to beginning of image data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int *j_max_x_ptr,	///< pointer to the number of intended horizontal decomposition levels, the number of achieved levels will be stored also here
+	int *j_max_y_ptr,	///< pointer to the number of intended vertical decomposition levels, the number of achieved levels will be stored also here
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
 /**
  * @brief Forward image fast wavelet transform using CDF 5/3 wavelet and lifting scheme, in-place version.
  *
@@ -519,6 +696,117 @@ void dwt_cdf53_2f_s(
 	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
 );
 
+/**
+ * @brief Forward image fast wavelet transform using CDF 5/3 wavelet and lifting scheme, out-of-place version.
+ *
+ * The nested image is read from @p src, the transform is stored into @p ptr.
+ * The copy is fused into the horizontal pass of the first decomposition
+ * level, so @p src is not modified and it does not need to be copied in
+ * advance. The unused area of the outer frame in @p ptr is filled only when
+ * @p zero_padding is set.
+ *
+ * This function works with single precision floating point numbers (i.e. float data type).
+ */
+void dwt_cdf53_2f_ex_s(
+	const void *src,	///< pointer to beginning of source image data
+	int src_stride_x,	///< difference between rows of source image (in bytes)
+	void *ptr,		///< pointer to beginning of transform data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns of both images (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int *j_max_ptr,		///< pointer to the number of intended decomposition levels (scales), the number of achieved decomposition levels will be stored also here
+	int decompose_one,	///< should be row or column of size one pixel decomposed? zero value if not
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
+/**
+ * @brief Forward image fast wavelet transform using CDF 5/3 wavelet and lifting scheme, anisotropic in-place version.
+ *
+ * The rows are decomposed into @p j_max_x_ptr levels and the columns into
+ * @p j_max_y_ptr levels. Each level lifts both the rows and the columns
+ * until one of the depths is reached. Later levels lift only the low-pass
+ * part along the remaining axis, so @p j_max_y_ptr equal to zero gives a
+ * horizontal-only transform of all rows. Use @ref dwt_util_subband_aniso to
+ * locate the subbands.
+ *
+ * This function works with single precision floating point numbers (i.e. float data type).
+ */
+void dwt_cdf53_2f_aniso_s(
+	void *ptr,		///< pointer to beginning of image data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int *j_max_x_ptr,	///< pointer to the number of intended horizontal decomposition levels, the number of achieved levels will be stored also here
+	int *j_max_y_ptr,	///< pointer to the number of intended vertical decomposition levels, the number of achieved levels will be stored also here
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
+/**
+ * @brief State of the line-based forward image transform using CDF 9/7 wavelet.
+ *
+ * See @ref dwt_cdf97_2f_line_init_s.
+ */
+struct dwt_cdf97_2f_line_s;
+
+/**
+ * @brief Start the line-based forward image fast wavelet transform using CDF 9/7 wavelet and lifting scheme.
+ *
+ * The rows of the image are pushed one by one using @ref dwt_cdf97_2f_line_push_row_s.
+ * The coefficients are available using @ref dwt_cdf97_2f_line_pull_rows_s as
+ * soon as they are final, i.e. a few rows after the rows they depend on.
+ * Only sixteen rows per decomposition level are kept. The result is the same
+ * as from @ref dwt_cdf97_2f_s using the single-loop strategy with no padding.
+ *
+ * This function works with single precision floating point numbers (i.e. float data type).
+ *
+ * @returns the state to be released by @ref dwt_cdf97_2f_line_finish_s
+ */
+struct dwt_cdf97_2f_line_s *dwt_cdf97_2f_line_init_s(
+	int size_x,		///< width of the image (in elements)
+	int size_y,		///< height of the image (in elements)
+	int *j_max_ptr,		///< pointer to the number of intended decomposition levels (scales), the number of achieved decomposition levels will be stored also here
+	int decompose_one	///< should be row or column of size one pixel decomposed? zero value if not
+);
+
+/**
+ * @brief Push the next row of the image into the line-based transform.
+ *
+ * Exactly @e size_y rows have to be pushed, pushing more rows is invalid.
+ */
+void dwt_cdf97_2f_line_push_row_s(
+	struct dwt_cdf97_2f_line_s *line,	///< state of the transform
+	const float *row			///< contiguous row of @e size_x elements
+);
+
+/**
+ * @brief Pull the next finished row of coefficients from the line-based transform.
+ *
+ * The coefficients are those of the row @p y starting at the column @p x
+ * in the layout of @ref dwt_cdf97_2f_s. Call repeatedly until zero is
+ * returned. All rows are finished after the last row of the image is pushed.
+ *
+ * @returns the number of coefficients stored into @p row, zero if no row is finished
+ */
+int dwt_cdf97_2f_line_pull_rows_s(
+	struct dwt_cdf97_2f_line_s *line,	///< state of the transform
+	float *row,				///< output of up to @e size_x elements
+	int *y,					///< row of the coefficients
+	int *x					///< column of the first coefficient
+);
+
+/**
+ * @brief Release the state of the line-based transform including rows not pulled.
+ */
+void dwt_cdf97_2f_line_finish_s(
+	struct dwt_cdf97_2f_line_s *line	///< state of the transform
+);
+
 /**
  * @brief Inverse image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, in-place version.
  *
@@ -537,6 +825,42 @@ void dwt_cdf97_2i_d(
 	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
 );
 
+/**
+ * @brief Inverse image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, anisotropic in-place version.
+ *
+ * Counterpart of @ref dwt_cdf97_2f_aniso_d.
+ *
+ * This function works with double precision floating point numbers (i.e. double data type).
+ */
+void dwt_cdf97_2i_aniso_d(
+	void *ptr,		///< pointer to beginning of image data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int j_max_x,		///< the number of horizontal decomposition levels
+	int j_max_y,		///< the number of vertical decomposition levels
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
+/**
+ * @brief Inverse image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, interleaved in-place version.
+ *
+ * Counterpart of @ref dwt_cdf97_2f_inter_s.
+ *
+ * This function works with single precision floating point numbers (i.e. float data type).
+ */
+void dwt_cdf97_2i_inter_s(
+	void *ptr,		///< pointer to beginning of image data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_x,		///< width of image (in elements)
+	int size_y,		///< height of image (in elements)
+	int j_max		///< the number of achieved decomposition levels (scales)
+);
+
 /**
  * @brief Inverse image fast wavelet transform using CDF 5/3 wavelet and lifting scheme, in-place version.
  *
@@ -555,6 +879,26 @@ void dwt_cdf53_2i_d(
 	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
 );
 
+/**
+ * @brief Inverse image fast wavelet transform using CDF 5/3 wavelet and lifting scheme, anisotropic in-place version.
+ *
+ * Counterpart of @ref dwt_cdf53_2f_aniso_d.
+ *
+ * This function works with double precision floating point numbers (i.e. double data type).
+ */
+void dwt_cdf53_2i_aniso_d(
+	void *ptr,		///< pointer to beginning of image data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int j_max_x,		///< the number of horizontal decomposition levels
+	int j_max_y,		///< the number of vertical decomposition levels
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
 /**
  * @brief Inverse image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, in-place version.
  *
@@ -573,6 +917,74 @@ void dwt_cdf97_2i_s(
 	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
 );
 
+/**
+ * @brief Inverse image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, anisotropic in-place version.
+ *
+ * Counterpart of @ref dwt_cdf97_2f_aniso_s.
+ *
+ * This function works with single precision floating point numbers (i.e. float data type).
+ */
+void dwt_cdf97_2i_aniso_s(
+	void *ptr,		///< pointer to beginning of image data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int j_max_x,		///< the number of horizontal decomposition levels
+	int j_max_y,		///< the number of vertical decomposition levels
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
+/**
+ * @brief Image of a batch transform.
+ */
+struct dwt_image
+{
+	void *ptr;		///< pointer to beginning of image data
+	int stride_x;		///< difference between rows (in bytes)
+	int stride_y;		///< difference between columns (in bytes)
+	int size_o_big_x;	///< width of outer image frame (in elements)
+	int size_o_big_y;	///< height of outer image frame (in elements)
+	int size_i_big_x;	///< width of nested image (in elements)
+	int size_i_big_y;	///< height of nested image (in elements)
+	int j_max;		///< the number of intended decomposition levels (scales), the number of achieved decomposition levels will be stored also here by the forward transform
+};
+
+/**
+ * @brief Forward image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, batch of independent images.
+ *
+ * Small images are distributed among the threads, each of them is
+ * transformed by a single thread. Images of at least 2^20 elements
+ * (including the outer frame) are transformed one after another by all
+ * threads as by @ref dwt_cdf97_2f_s. Each thread uses a workspace of its
+ * own, the one set by @ref dwt_util_set_workspace is used only for the
+ * large images.
+ *
+ * This function works with single precision floating point numbers (i.e. float data type).
+ */
+void dwt_cdf97_2f_batch_s(
+	struct dwt_image *image,	///< array of images
+	int count,		///< number of images
+	int decompose_one,	///< should be row or column of size one pixel decomposed? zero value if not
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
+/**
+ * @brief Inverse image fast wavelet transform using CDF 9/7 wavelet and lifting scheme, batch of independent images.
+ *
+ * Counterpart of @ref dwt_cdf97_2f_batch_s.
+ *
+ * This function works with single precision floating point numbers (i.e. float data type).
+ */
+void dwt_cdf97_2i_batch_s(
+	const struct dwt_image *image,	///< array of images
+	int count,		///< number of images
+	int decompose_one,	///< should be row or column of size one pixel decomposed? zero value if not
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
 /**
  * @brief Inverse image fast wavelet transform using CDF 5/3 wavelet and lifting scheme, in-place version.
  *
@@ -591,6 +1003,26 @@ void dwt_cdf53_2i_s(
 	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
 );
 
+/**
+ * @brief Inverse image fast wavelet transform using CDF 5/3 wavelet and lifting scheme, anisotropic in-place version.
+ *
+ * Counterpart of @ref dwt_cdf53_2f_aniso_s.
+ *
+ * This function works with single precision floating point numbers (i.e. float data type).
+ */
+void dwt_cdf53_2i_aniso_s(
+	void *ptr,		///< pointer to beginning of image data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int j_max_x,		///< the number of horizontal decomposition levels
+	int j_max_y,		///< the number of vertical decomposition levels
+	int zero_padding	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+);
+
 /**
  * @}
  */
@@ -672,6 +1104,52 @@ void dwt_util_free_image(
 	void **pptr		///< pointer to data that will be released
 );
 
+/**
+ * @brief Workspace of the 2-D transforms.
+ *
+ * Temporary buffers used by the 2-D transforms, one slab per thread.
+ */
+struct dwt_workspace;
+
+/**
+ * @brief Allocate workspace.
+ *
+ * Allocates workspace for 2-D transforms of images up to given sizes and
+ * for up to @ref dwt_util_get_max_threads threads.
+ */
+void dwt_util_alloc_workspace(
+	struct dwt_workspace **pws,	///< place pointer to newly allocated workspace here
+	int size_x,		///< the largest width of outer image frame (in elements)
+	int size_y		///< the largest height of outer image frame (in elements)
+);
+
+/**
+ * @brief Free workspace.
+ *
+ * Frees workspace allocated by @ref dwt_util_alloc_workspace.
+ */
+void dwt_util_free_workspace(
+	struct dwt_workspace **pws	///< pointer to workspace that will be released
+);
+
+/**
+ * @brief Set workspace used by the 2-D transforms.
+ *
+ * The workspace is reused by all subsequent 2-D transforms, so that they do
+ * not allocate their temporary buffers. Transforms of images larger than the
+ * workspace (or called with more threads) allocate a temporary workspace of
+ * their own. NULL (default) unsets the workspace.
+ *
+ * @warning The workspace is used by one transform at a time. Transforms
+ * called concurrently from several application threads allocate a temporary
+ * workspace while it is in use.
+ *
+ * @warning experimental
+ */
+void dwt_util_set_workspace(
+	struct dwt_workspace *ws	///< workspace allocated by @ref dwt_util_alloc_workspace
+);
+
 /**
  * @brief Compare two images.
  *
@@ -806,6 +1284,8 @@ int dwt_util_get_max_workers();
  * @brief Wrapper to @p omp_set_num_threads function.
  *
  * Sets the number of threads that will be used in parallel region.
+ * Each 2-D transform runs all its levels in a single team of this size,
+ * the threads of which are kept by the OpenMP runtime between the calls.
  *
  * @warning experimental
  */
@@ -813,6 +1293,40 @@ void dwt_util_set_num_threads(
 	int num_threads		///< the number of threads
 );
 
+/**
+ * @brief Set the number of elements of a level of 2-D CDF 9/7 transform per thread.
+ *
+ * A level of @f$ N @f$ elements is transformed by at most @f$ N / elements @f$
+ * threads of the team. The deepest levels, too small to pay for the
+ * synchronization of the team, are transformed by a single thread without
+ * entering the team at all. Zero or a negative value uses all threads on
+ * all levels.
+ *
+ * @warning experimental
+ */
+void dwt_util_set_level_grain(
+	int elements		///< the number of elements per thread
+);
+
+/**
+ * @brief Get the number of elements of a level per thread in use.
+ *
+ * @warning experimental
+ */
+int dwt_util_get_level_grain();
+
+/**
+ * @brief Calibrate the number of elements of a level per thread.
+ *
+ * Measures the cost of an element of a level on one thread and the cost
+ * of a barrier of the team of @ref dwt_util_set_num_threads, sets the
+ * number of elements per thread by @ref dwt_util_set_level_grain and
+ * returns it. Call again after changing the number of threads.
+ *
+ * @warning experimental
+ */
+int dwt_util_calibrate_level_grain();
+
 /**
  * @brief Set the number of active workers.
  */
@@ -825,7 +1339,9 @@ void dwt_util_set_num_workers(
  *
  * On all platforms, select from one several loop algorithms.
  * On UTIA ASVP/EdkDSP platform, enable block-acceleration using workers.
- * On x86 architecture, enable SIMD acceleration using SSE instruction set.
+ * On x86 architecture, enable SIMD acceleration using SSE, AVX or AVX-512 instruction set.
+ * With GCC or Clang on x86, the AVX and AVX-512 algorithms are always compiled in and used when
+ * the running CPU supports them, otherwise they fall back to their SSE counterparts.
  *
  * @param[in] accel_type Means
  *   @li 0 for CPU multi-loop implementation,
@@ -837,16 +1353,104 @@ void dwt_util_set_num_workers(
  *   @li 6 for CPU shifted double-loop SIMD algorithm (2 iterations merged),
  *   @li 7 for CPU shifted double-loop SIMD algorithm (6 iterations merged),
  *   @li 8 for CPU shifted double-loop SIMD algorithm (2 iterations merged, SSE implementation, x86 platform),
- *   @li 9 for CPU shifted double-loop SIMD algorithm (6 iterations merged, SSE implementation, x86 platform).
- *
- * @note This function currently affects only single precision floating point number functions.
+ *   @li 9 for CPU shifted double-loop SIMD algorithm (6 iterations merged, SSE implementation, x86 platform),
+ *   @li 10 for CPU shifted double-loop SIMD algorithm (2 iterations merged, AVX implementation, two rows/columns at once, x86 platform),
+ *   @li 11 for CPU shifted double-loop SIMD algorithm (6 iterations merged, AVX implementation, two rows/columns at once, x86 platform),
+ *   @li 12 for CPU shifted double-loop SIMD algorithm (2 iterations merged, AVX-512 implementation, four rows/columns at once, x86 platform),
+ *   @li 13 for CPU shifted double-loop SIMD algorithm (6 iterations merged, AVX-512 implementation, four rows/columns at once, x86 platform),
+ *   @li 14 for the best of the above algorithms supported by the running CPU (selected by @ref dwt_util_init, default);
+ *          in the vertical pass of 2-D CDF 9/7 transform, up to 16 adjacent columns are lifted at once
+ *          (see @ref dwt_util_set_vert).
+ *
+ * @note The double precision CDF 9/7 functions use the nearest available counterpart of the selected
+ * algorithm (multi-loop instead of BCE, a single shifted double-loop kernel for 5-7, its SSE2 implementation
+ * for 8-9 and its AVX implementation for 10-13). The CDF 5/3 functions use a two-step shifted double-loop
+ * algorithm in the same way (multi-loop instead of BCE, scalar implementations for 4-7, SSE implementation
+ * for 8-9 and AVX implementation for 10-13), in both single and double precision.
+ * Other functions are not affected.
  * @warning experimental
  */
 void dwt_util_set_accel(
 	int accel_type);
 
+/**
+ * @brief Strategy of the vertical pass of 2-D CDF 9/7 transform.
+ *
+ * @warning experimental
+ */
+enum dwt_vert
+{
+	DWT_VERT_AUTO,		///< block strategy with the automatic acceleration, column strategy otherwise, transposed columns if they span more than 256 KiB (default)
+	DWT_VERT_COLUMN,	///< each column is copied into temporary buffer and lifted using the selected acceleration
+	DWT_VERT_BLOCK,		///< blocks of up to 16 adjacent columns are copied into temporary buffer and lifted at once
+	DWT_VERT_ROW,		///< lifting steps are applied in place on whole image rows, followed by permutation of rows
+	DWT_VERT_SINGLE,	///< single-loop approach, each row is lifted vertically right after its horizontal transform (single thread)
+	DWT_VERT_TILE,		///< both passes are applied on tiles with halo fitting into the L2 cache (see @ref dwt_util_set_tile)
+	DWT_VERT_PYRAMID,	///< single-loop approach over all levels, low-pass rows are fed into the next level as soon as they are final (forward transform without padding, single-loop approach otherwise)
+	DWT_VERT_TRANSPOSE,	///< blocks of up to 16 adjacent columns are transposed into temporary rows, lifted by the horizontal kernels and transposed back
+	DWT_VERT_TASK		///< tiles of all levels form a graph, each tile is started as soon as the tiles producing its input are finished, without barriers between passes and levels (forward transform without padding, tiled strategy otherwise)
+};
+
+/**
+ * @brief Set strategy of the vertical pass of 2-D CDF 9/7 transform.
+ *
+ * All strategies except the column one require adjacent columns to be
+ * contiguous in memory (@p stride_y equal to the size of an element),
+ * otherwise the column strategy is used.
+ *
+ * @warning experimental
+ */
+void dwt_util_set_vert(
+	enum dwt_vert vert_type);
+
+/**
+ * @brief Scheduler distributing rows and columns of 2-D CDF 9/7 transform among threads.
+ *
+ * @warning experimental
+ */
+enum dwt_sched
+{
+	DWT_SCHED_STATIC,	///< each thread processes a contiguous range of rows (columns) of the same size (default)
+	DWT_SCHED_STEAL		///< each thread starts with the same range, a thread running out of rows (columns) steals a half of those left to another thread
+};
+
+/**
+ * @brief Set scheduler of the passes of 2-D CDF 9/7 transform.
+ *
+ * The work-stealing scheduler balances passes whose rows (columns) differ
+ * in cost, e.g. due to padding, or threads running at different speeds,
+ * e.g. hyper-threads sharing a core.
+ *
+ * @warning experimental
+ */
+void dwt_util_set_sched(
+	enum dwt_sched sched_type);
+
+/**
+ * @brief Get scheduler of the passes of 2-D CDF 9/7 transform in use.
+ *
+ * @warning experimental
+ */
+enum dwt_sched dwt_util_get_sched();
+
+/**
+ * @brief Set size of tiles in the tiled strategy of 2-D CDF 9/7 transform.
+ *
+ * The tiled strategy gives the same results as the block strategy. It is
+ * used on images whose size is not padded and exceeds the size of a tile,
+ * other images are processed using the block strategy. Zero (default)
+ * selects the size according to the size of the L2 cache.
+ *
+ * @warning experimental
+ */
+void dwt_util_set_tile(
+	int size);
+
 /**
  * @brief Initialize workers in UTIA ASVP platform.
+ *
+ * On other platforms, detect the instruction sets supported by the running CPU
+ * and select the automatic acceleration (see @ref dwt_util_set_accel).
  */
 void dwt_util_init();
 
@@ -901,6 +1505,9 @@ int dwt_util_get_thread_num();
 /**
  * @brief Wrapper to @p omp_get_num_threads function.
  *
+ * Outside a parallel region, the size of a team is found only once and
+ * cached until @ref dwt_util_set_num_threads is called.
+ *
  * @warning experimental
  */
 int dwt_util_get_num_threads();
@@ -1128,6 +1735,15 @@ enum dwt_subbands {
 	DWT_HH		///< subband filtered by HP filter horizontally and vertically
 };
 
+/**
+ * @brief Arrangement of the transform coefficients in memory.
+ */
+enum dwt_layout {
+	DWT_LAYOUT_MALLAT,	///< subbands of a level are quadrants of the LL subband of the previous level, produced by @ref dwt_cdf97_2f_s and others
+	DWT_LAYOUT_INTERLEAVED,	///< coefficients stay at the positions of the lifting scheme, i.e. the subbands of the level j are lattices with the step 2^j, produced by @ref dwt_cdf97_2f_inter_s
+	DWT_LAYOUT_PACKED	///< subbands are stored densely one after another starting with the LL subband of the deepest level, followed by HL, LH and HH of each level from the deepest one
+};
+
 /**
  * @brief Gets pointer to and sizes of the selected subband (LL, HL, LH or HH).
  */
@@ -1182,6 +1798,118 @@ void dwt_util_subband(
 	int *dst_size_y		///< here will be stored height of subband
 );
 
+/**
+ * @brief Gets pointer to and sizes of the selected subband (LL, HL, LH or HH) of anisotropic transform.
+ *
+ * See @ref dwt_cdf97_2f_aniso_s. The HL and HH subbands of levels beyond
+ * @p j_max_x are empty, so are the LH and HH subbands of levels beyond
+ * @p j_max_y.
+ */
+void dwt_util_subband_aniso(
+	void *ptr,		///< pointer to beginning of image data
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int j,			///< the decomposition level of interest
+	int j_max_x,		///< the number of horizontal decomposition levels
+	int j_max_y,		///< the number of vertical decomposition levels
+	enum dwt_subbands band,	///< subband of interest (LL, HL, LH, HH)
+	void **dst_ptr,		///< here will be stored pointer to beginning of subband data
+	int *dst_size_x,	///< here will be stored width of subband
+	int *dst_size_y		///< here will be stored height of subband
+);
+
+/**
+ * @brief Gets pointer to, sizes and strides of the selected subband of transform stored in the given layout.
+ *
+ * The coefficients of the subband are addressed by @ref dwt_util_addr_coeff_s
+ * using the returned pointer and strides. The @p stride_x and @p stride_y
+ * describe the whole image in the Mallat and interleaved layouts, they are
+ * ignored in the packed layout. In the packed layout, only the LL subband of
+ * the level @p j_max is stored.
+ */
+void dwt_util_subband_layout_s(
+	void *ptr,		///< pointer to beginning of transform data
+	enum dwt_layout layout,	///< layout of the transform
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_x,		///< width of image (in elements)
+	int size_y,		///< height of image (in elements)
+	int j,			///< the decomposition level of interest
+	int j_max,		///< the number of decomposition levels of the transform
+	enum dwt_subbands band,	///< subband of interest (LL, HL, LH, HH)
+	void **dst_ptr,		///< here will be stored pointer to beginning of subband data
+	int *dst_size_x,	///< here will be stored width of subband
+	int *dst_size_y,	///< here will be stored height of subband
+	int *dst_stride_x,	///< here will be stored difference between rows of subband (in bytes)
+	int *dst_stride_y	///< here will be stored difference between columns of subband (in bytes)
+);
+
+/**
+ * @brief Gets pointer to, sizes and strides of the selected subband of transform stored in the given layout.
+ *
+ * The coefficients of the subband are addressed by @ref dwt_util_addr_coeff_d
+ * using the returned pointer and strides. The @p stride_x and @p stride_y
+ * describe the whole image in the Mallat and interleaved layouts, they are
+ * ignored in the packed layout. In the packed layout, only the LL subband of
+ * the level @p j_max is stored.
+ */
+void dwt_util_subband_layout_d(
+	void *ptr,		///< pointer to beginning of transform data
+	enum dwt_layout layout,	///< layout of the transform
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_x,		///< width of image (in elements)
+	int size_y,		///< height of image (in elements)
+	int j,			///< the decomposition level of interest
+	int j_max,		///< the number of decomposition levels of the transform
+	enum dwt_subbands band,	///< subband of interest (LL, HL, LH, HH)
+	void **dst_ptr,		///< here will be stored pointer to beginning of subband data
+	int *dst_size_x,	///< here will be stored width of subband
+	int *dst_size_y,	///< here will be stored height of subband
+	int *dst_stride_x,	///< here will be stored difference between rows of subband (in bytes)
+	int *dst_stride_y	///< here will be stored difference between columns of subband (in bytes)
+);
+
+/**
+ * @brief Convert transform from one layout into another.
+ *
+ * The @p src and @p dst cannot overlap. See @ref dwt_util_subband_layout_s
+ * for the meaning of @p stride_x and @p stride_y.
+ */
+void dwt_util_convert_layout_s(
+	const void *src,		///< transform in the layout @p src_layout
+	enum dwt_layout src_layout,	///< layout of @p src
+	void *dst,			///< here will be stored the transform in the layout @p dst_layout
+	enum dwt_layout dst_layout,	///< layout of @p dst
+	int stride_x,			///< difference between rows (in bytes)
+	int stride_y,			///< difference between columns (in bytes)
+	int size_x,			///< width of image (in elements)
+	int size_y,			///< height of image (in elements)
+	int j_max			///< the number of decomposition levels of the transform
+);
+
+/**
+ * @brief Convert transform from one layout into another.
+ *
+ * The @p src and @p dst cannot overlap. See @ref dwt_util_subband_layout_d
+ * for the meaning of @p stride_x and @p stride_y.
+ */
+void dwt_util_convert_layout_d(
+	const void *src,		///< transform in the layout @p src_layout
+	enum dwt_layout src_layout,	///< layout of @p src
+	void *dst,			///< here will be stored the transform in the layout @p dst_layout
+	enum dwt_layout dst_layout,	///< layout of @p dst
+	int stride_x,			///< difference between rows (in bytes)
+	int stride_y,			///< difference between columns (in bytes)
+	int size_x,			///< width of image (in elements)
+	int size_y,			///< height of image (in elements)
+	int j_max			///< the number of decomposition levels of the transform
+);
+
 /**
  * @brief Compute address of given transform coefficient or image pixel.
  * 
@@ -1221,6 +1949,44 @@ void *dwt_util_addr_coeff(
 	int stride_y		///< difference between columns (in bytes)
 );
 
+/**
+ * @brief Compute address of transform coefficient stored in the given layout.
+ *
+ * The coordinates are those of the coefficient in the Mallat layout.
+ *
+ * @warning This function is slow; use @ref dwt_util_subband_layout_s to traverse whole subbands.
+ */
+float *dwt_util_addr_coeff_layout_s(
+	void *ptr,		///< pointer to beginning of transform data
+	enum dwt_layout layout,	///< layout of the transform
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_x,		///< width of image (in elements)
+	int size_y,		///< height of image (in elements)
+	int j_max,		///< the number of decomposition levels of the transform
+	int y,			///< y-coordinate in the Mallat layout
+	int x			///< x-coordinate in the Mallat layout
+);
+
+/**
+ * @brief Compute address of transform coefficient stored in the given layout.
+ *
+ * The coordinates are those of the coefficient in the Mallat layout.
+ *
+ * @warning This function is slow; use @ref dwt_util_subband_layout_d to traverse whole subbands.
+ */
+double *dwt_util_addr_coeff_layout_d(
+	void *ptr,		///< pointer to beginning of transform data
+	enum dwt_layout layout,	///< layout of the transform
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_x,		///< width of image (in elements)
+	int size_y,		///< height of image (in elements)
+	int j_max,		///< the number of decomposition levels of the transform
+	int y,			///< y-coordinate in the Mallat layout
+	int x			///< x-coordinate in the Mallat layout
+);
+
 /**
  * @brief Convert transform to viewable format.
  */
@@ -1267,6 +2033,32 @@ void dwt_util_perf_cdf97_2_s(
 	float *inv_secs		///< store resulting time for inverse transform here
 );
 
+/**
+ * @brief Performance test of 2-D DWT with CDF 9/7 wavelet, batch version.
+ *
+ * The M images of a test loop are transformed at once using
+ * @ref dwt_cdf97_2f_batch_s and @ref dwt_cdf97_2i_batch_s. The resulting
+ * times are per image as in @ref dwt_util_perf_cdf97_2_s.
+ *
+ * @warning experimental
+ */
+void dwt_util_perf_cdf97_2_batch_s(
+	int stride_x,		///< difference between rows (in bytes)
+	int stride_y,		///< difference between columns (in bytes)
+	int size_o_big_x,	///< width of outer image frame (in elements)
+	int size_o_big_y,	///< height of outer image frame (in elements)
+	int size_i_big_x,	///< width of nested image (in elements)
+	int size_i_big_y,	///< height of nested image (in elements)
+	int j_max,		///< the number of intended decomposition levels (scales)
+	int decompose_one,	///< should be row or column of size one pixel decomposed? zero value if not
+	int zero_padding,	///< fill padding in channels with zeros? zero value if not, should be non zero only for sparse decomposition
+	int M,			///< one test loop consists of transform of M images
+	int N,			///< number of test loops performed
+	int clock_type,		///< timer type
+	float *fwd_secs,	///< store resulting time for forward transform here
+	float *inv_secs		///< store resulting time for inverse transform here
+);
+
 /**
  * @brief Performance test of 2-D DWT with CDF 9/7 wavelet.
  *
@@ -0,0 +1,676 @@
+/**
+ * @file
+ * @author David Barina <ibarina@fit.vutbr.cz>
+ * @brief Compile-time generator of lifting scheme kernels.
+ *
+ * A lifting scheme is described as a list of symmetric lifting steps and a
+ * scaling constant. From this description, the templates below instantiate
+ * fully unrolled shifted-loop kernels (scalar and SIMD) of one level of the
+ * forward and the inverse transform.
+ */
+#ifndef LIFTING_H
+#define LIFTING_H
+
+#ifdef __cplusplus
+
+#ifdef __SSE__
+	#include <xmmintrin.h>
+#endif
+#ifdef __SSE2__
+	#include <emmintrin.h>
+#endif
+#ifdef __AVX__
+	#include <immintrin.h>
+#endif
+
+/**
+ * @defgroup cpp_lifting C++ lifting scheme generator
+ * @{
+ **/
+
+namespace dwt
+{
+
+namespace lifting
+{
+
+/**
+ * @brief Marks unused template arguments.
+ */
+struct nil {};
+
+/**
+ * @brief Lifting coefficient equal to @p Num / @p Den.
+ */
+template<int Num, int Den = 1>
+struct ratio
+{
+	static double value() { return (double)Num / Den; }
+};
+
+/**
+ * @brief Lifting coefficient opposite to @p C.
+ */
+template<class C>
+struct neg
+{
+	static double value() { return -C::value(); }
+};
+
+/**
+ * @brief Square root of two, the scaling constant of several biorthogonal wavelets.
+ */
+struct sqrt2
+{
+	static double value() { return 1.41421356237309504880; }
+};
+
+/**
+ * @brief Symmetric lifting step.
+ *
+ * The step updates each sample of one parity by adding the pair of nearest
+ * samples of the other parity weighted by @p C0. When @p C1 is given, the
+ * pair of samples three positions away is added as well, weighted by @p C1.
+ */
+template<class C0, class C1 = nil>
+struct step
+{
+	typedef C0 c0; ///< weight of the nearest pair
+	typedef C1 c1; ///< weight of the second nearest pair
+
+	enum { taps = 2 }; ///< number of weighted pairs
+};
+
+/**
+ * @brief Symmetric lifting step with a single pair of taps.
+ */
+template<class C0>
+struct step<C0, nil>
+{
+	typedef C0 c0;
+	typedef nil c1;
+
+	enum { taps = 1 };
+};
+
+/**
+ * @brief Ordered list of up to six lifting steps.
+ *
+ * The first step of the forward transform updates odd samples, the next one
+ * even samples and so on.
+ */
+template<class S0, class S1, class S2 = nil, class S3 = nil, class S4 = nil, class S5 = nil>
+struct steps {};
+
+/**
+ * @brief Lifting scheme given by its @p Steps and the scaling constant @p Zeta.
+ *
+ * The forward transform multiplies the low-pass coefficients by @p Zeta and
+ * the high-pass ones by its reciprocal after the last step.
+ */
+template<class Steps, class Zeta>
+struct scheme
+{
+	typedef Steps steps_type;
+	typedef Zeta zeta_type;
+};
+
+/**
+ * @brief CDF 9/7 wavelet, same constants as in the C interface.
+ */
+struct cdf97
+{
+	struct alpha { static double value() { return -1.58613434342059; } };
+	struct beta  { static double value() { return -0.0529801185729; } };
+	struct gamma { static double value() { return +0.8829110755309; } };
+	struct delta { static double value() { return +0.4435068520439; } };
+	struct zeta  { static double value() { return +1.1496043988602; } };
+
+	typedef scheme<steps< step<alpha>, step<beta>, step<gamma>, step<delta> >, zeta> type;
+};
+
+/**
+ * @brief CDF 5/3 wavelet, same constants as in the C interface.
+ */
+struct cdf53
+{
+	typedef scheme<steps< step< ratio<-1,2> >, step< ratio<1,4> > >, sqrt2> type;
+};
+
+/**
+ * @brief 13/7 wavelet built on the Deslauriers-Dubuc interpolating predictor.
+ */
+struct dd137
+{
+	typedef scheme<steps< step< ratio<-9,16>, ratio<1,16> >, step< ratio<9,32>, ratio<-1,32> > >, sqrt2> type;
+};
+
+/**
+ * @}
+ */
+
+namespace detail
+{
+
+template<class C>
+struct weight
+{
+	static double value() { return C::value(); }
+};
+
+template<>
+struct weight<nil>
+{
+	static double value() { return 0.; }
+};
+
+template<class S>
+struct is_nil
+{
+	enum { value = 0 };
+};
+
+template<>
+struct is_nil<nil>
+{
+	enum { value = 1 };
+};
+
+template<class Steps, int K>
+struct step_at;
+
+template<class S0, class S1, class S2, class S3, class S4, class S5>
+struct step_at<steps<S0, S1, S2, S3, S4, S5>, 0> { typedef S0 type; };
+
+template<class S0, class S1, class S2, class S3, class S4, class S5>
+struct step_at<steps<S0, S1, S2, S3, S4, S5>, 1> { typedef S1 type; };
+
+template<class S0, class S1, class S2, class S3, class S4, class S5>
+struct step_at<steps<S0, S1, S2, S3, S4, S5>, 2> { typedef S2 type; };
+
+template<class S0, class S1, class S2, class S3, class S4, class S5>
+struct step_at<steps<S0, S1, S2, S3, S4, S5>, 3> { typedef S3 type; };
+
+template<class S0, class S1, class S2, class S3, class S4, class S5>
+struct step_at<steps<S0, S1, S2, S3, S4, S5>, 4> { typedef S4 type; };
+
+template<class S0, class S1, class S2, class S3, class S4, class S5>
+struct step_at<steps<S0, S1, S2, S3, S4, S5>, 5> { typedef S5 type; };
+
+template<class Steps>
+struct step_count;
+
+template<class S0, class S1, class S2, class S3, class S4, class S5>
+struct step_count<steps<S0, S1, S2, S3, S4, S5> >
+{
+	enum { value = 6 - is_nil<S2>::value - is_nil<S3>::value - is_nil<S4>::value - is_nil<S5>::value };
+};
+
+/**
+ * Steps of the scheme in the order of their application. The inverse
+ * transform applies the forward steps backwards with opposite weights.
+ */
+template<class Scheme, bool Inverse>
+struct sequence
+{
+	typedef typename Scheme::steps_type steps_type;
+	typedef typename Scheme::zeta_type zeta_type;
+
+	enum { n = step_count<steps_type>::value };
+
+	template<int K>
+	struct at
+	{
+		typedef typename step_at<steps_type, Inverse ? n-1-K : K>::type type;
+
+		enum {
+			parity = Inverse ? (n-K)&1 : (K+1)&1, ///< parity of updated samples
+			reach = 2*type::taps-1 ///< distance of the farthest tap
+		};
+
+		static double c0() { return (Inverse ? -1. : +1.) * weight<typename type::c0>::value(); }
+		static double c1() { return (Inverse ? -1. : +1.) * weight<typename type::c1>::value(); }
+	};
+};
+
+template<int A, int B>
+struct max
+{
+	enum { value = A > B ? A : B };
+};
+
+/**
+ * Position of the first sample updated by the step @p K in the main loop
+ * processing @p V pairs per iteration. The step @p K lags behind the step
+ * @p K-1 enough not to read samples which are not ready yet or which were
+ * already overwritten by the step @p K+1. Two more iterations of lag keep
+ * the unaligned loads away from the vectors just stored by the previous
+ * step, which the store forwarding cannot serve. The last step is placed
+ * right of its farthest left tap.
+ */
+template<class Seq, int V, int K, bool Last = (K == Seq::n-1)>
+struct position
+{
+	enum { value = position<Seq, V, K+1>::value + max<Seq::template at<K>::reach, Seq::template at<K+1>::reach>::value + 4*V };
+};
+
+template<class Seq, int V, int K>
+struct position<Seq, V, K, true>
+{
+	enum { value = Seq::template at<K>::reach + 1 + Seq::template at<K>::parity };
+};
+
+/**
+ * Layout of the shifted loop: the forward transform scales the samples
+ * starting at @c scale right behind the last step, the inverse transform
+ * descales the samples starting at @c descale right before they are read by
+ * the first step.
+ */
+template<class Seq, int V>
+struct layout
+{
+	enum {
+		scale = position<Seq, V, Seq::n-1>::value - Seq::template at<Seq::n-1>::reach - 1,
+		descale = position<Seq, V, 0>::value + Seq::template at<0>::reach - 1
+	};
+};
+
+/**
+ * Vector of @p V elements of the type @p T.
+ */
+template<typename T, int V>
+struct vec;
+
+template<typename T>
+struct vec<T, 1>
+{
+	typedef T type;
+
+	static type load(const T *p) { return *p; }
+	static void store(T *p, type a) { *p = a; }
+	static type set1(T a) { return a; }
+	static type add(type a, type b) { return a + b; }
+	static type mul(type a, type b) { return a * b; }
+};
+
+#ifdef __SSE__
+template<>
+struct vec<float, 4>
+{
+	typedef __m128 type;
+
+	static type load(const float *p) { return _mm_loadu_ps(p); }
+	static void store(float *p, type a) { _mm_storeu_ps(p, a); }
+	static type set1(float a) { return _mm_set1_ps(a); }
+	static type add(type a, type b) { return _mm_add_ps(a, b); }
+	static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+};
+#endif
+
+#ifdef __SSE2__
+template<>
+struct vec<double, 2>
+{
+	typedef __m128d type;
+
+	static type load(const double *p) { return _mm_loadu_pd(p); }
+	static void store(double *p, type a) { _mm_storeu_pd(p, a); }
+	static type set1(double a) { return _mm_set1_pd(a); }
+	static type add(type a, type b) { return _mm_add_pd(a, b); }
+	static type mul(type a, type b) { return _mm_mul_pd(a, b); }
+};
+#endif
+
+#ifdef __AVX__
+template<>
+struct vec<float, 8>
+{
+	typedef __m256 type;
+
+	static type load(const float *p) { return _mm256_loadu_ps(p); }
+	static void store(float *p, type a) { _mm256_storeu_ps(p, a); }
+	static type set1(float a) { return _mm256_set1_ps(a); }
+	static type add(type a, type b) { return _mm256_add_ps(a, b); }
+	static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+};
+
+template<>
+struct vec<double, 4>
+{
+	typedef __m256d type;
+
+	static type load(const double *p) { return _mm256_loadu_pd(p); }
+	static void store(double *p, type a) { _mm256_storeu_pd(p, a); }
+	static type set1(double a) { return _mm256_set1_pd(a); }
+	static type add(type a, type b) { return _mm256_add_pd(a, b); }
+	static type mul(type a, type b) { return _mm256_mul_pd(a, b); }
+};
+#endif
+
+/**
+ * Sample @p x of the signal split into the even part @p L and the odd part @p H.
+ */
+template<typename T>
+inline T &sample(T *L, T *H, int x)
+{
+	return (x & 1) ? H[x>>1] : L[x>>1];
+}
+
+/**
+ * Symmetric extension of the signal of length @p N (at least 2).
+ */
+inline int mirror(int x, int N)
+{
+	for(;;)
+	{
+		if( x < 0 )
+			x = -x;
+		else if( x >= N )
+			x = 2*(N-1) - x;
+		else
+			return x;
+	}
+}
+
+/**
+ * Step @p K on the samples in the range [@p begin, @p end) at the borders
+ * of the signal.
+ */
+template<class Seq, int K, typename T>
+struct border_step
+{
+	typedef typename Seq::template at<K> step_type;
+
+	static void apply(T *L, T *H, int N, int begin, int end)
+	{
+		const T c0 = (T)step_type::c0();
+		const T c1 = (T)step_type::c1();
+
+		if( begin < 0 )
+			begin = 0;
+		if( end > N )
+			end = N;
+		if( (begin & 1) != step_type::parity )
+			begin++;
+
+		for(int x = begin; x < end; x += 2)
+		{
+			T a = sample(L, H, x);
+
+			a += c0 * ( sample(L, H, mirror(x-1, N)) + sample(L, H, mirror(x+1, N)) );
+			if( 2 == step_type::type::taps )
+				a += c1 * ( sample(L, H, mirror(x-3, N)) + sample(L, H, mirror(x+3, N)) );
+
+			sample(L, H, x) = a;
+		}
+	}
+};
+
+/**
+ * All the steps at the left border (@p prolog) or at the right border
+ * behind @p s iterations of the main loop.
+ */
+template<class Seq, typename T, int V, int K = 0, bool End = (K == Seq::n)>
+struct border_steps
+{
+	static void prolog(T *L, T *H, int N)
+	{
+		border_step<Seq, K, T>::apply(L, H, N, 0, position<Seq, V, K>::value);
+		border_steps<Seq, T, V, K+1>::prolog(L, H, N);
+	}
+
+	static void epilog(T *L, T *H, int N, int s)
+	{
+		border_step<Seq, K, T>::apply(L, H, N, position<Seq, V, K>::value + 2*s, N);
+		border_steps<Seq, T, V, K+1>::epilog(L, H, N, s);
+	}
+};
+
+template<class Seq, typename T, int V, int K>
+struct border_steps<Seq, T, V, K, true>
+{
+	static void prolog(T *, T *, int) {}
+	static void epilog(T *, T *, int, int) {}
+};
+
+/**
+ * Step @p K on @p V samples in the @p s-th iteration of the main loop.
+ */
+template<class Seq, int K, typename T, int V>
+struct main_step
+{
+	typedef typename Seq::template at<K> step_type;
+	typedef vec<T, V> v;
+
+	enum {
+		parity = step_type::parity,
+		index = (position<Seq, V, K>::value - parity) / 2,
+		right = parity, ///< offset of the nearest right tap in the other part
+		left = parity - 1 ///< offset of the nearest left tap in the other part
+	};
+
+	static void apply(T *L, T *H, int s)
+	{
+		T *dst = parity ? H : L;
+		const T *src = parity ? L : H;
+		const int i = index + s;
+
+		typename v::type a = v::load(dst + i);
+
+		a = v::add(a, v::mul(v::set1((T)step_type::c0()),
+			v::add(v::load(src + i + left), v::load(src + i + right))));
+		if( 2 == step_type::type::taps )
+			a = v::add(a, v::mul(v::set1((T)step_type::c1()),
+				v::add(v::load(src + i + left - 1), v::load(src + i + right + 1))));
+
+		v::store(dst + i, a);
+	}
+};
+
+/**
+ * All the steps of one iteration of the main loop, fully unrolled.
+ */
+template<class Seq, typename T, int V, int K = 0, bool End = (K == Seq::n)>
+struct main_steps
+{
+	static void apply(T *L, T *H, int s)
+	{
+		main_step<Seq, K, T, V>::apply(L, H, s);
+		main_steps<Seq, T, V, K+1>::apply(L, H, s);
+	}
+};
+
+template<class Seq, typename T, int V, int K>
+struct main_steps<Seq, T, V, K, true>
+{
+	static void apply(T *, T *, int) {}
+};
+
+/**
+ * Multiplies the samples in the range [@p begin, @p end) by @p zl (even)
+ * and @p zh (odd).
+ */
+template<typename T>
+inline void scale_range(T *L, T *H, int N, int begin, int end, T zl, T zh)
+{
+	if( begin < 0 )
+		begin = 0;
+	if( end > N )
+		end = N;
+
+	for(int x = begin; x < end; x++)
+		sample(L, H, x) *= (x & 1) ? zh : zl;
+}
+
+/**
+ * Multiplies 2*@p V samples starting at the sample @p x by @p zl (even)
+ * and @p zh (odd).
+ */
+template<typename T, int V>
+inline void scale_block(T *L, T *H, int x, typename vec<T, V>::type zl, typename vec<T, V>::type zh)
+{
+	typedef vec<T, V> v;
+
+	T *l = L + (x+1)/2;
+	T *h = H + x/2;
+
+	v::store(l, v::mul(v::load(l), zl));
+	v::store(h, v::mul(v::load(h), zh));
+}
+
+/**
+ * One level of the transform of the signal of length @p N split into the
+ * even samples @p L and the odd samples @p H.
+ */
+template<class Seq, bool Inverse, typename T, int V>
+inline void run(T *L, T *H, int N)
+{
+	typedef vec<T, V> v;
+	typedef layout<Seq, V> lay;
+
+	const T zeta = (T)Seq::zeta_type::value();
+	const T zl = Inverse ? 1/zeta : zeta;
+	const T zh = Inverse ? zeta : 1/zeta;
+
+	if( N < 2 )
+	{
+		if( 1 == N )
+			L[0] *= zl;
+		return;
+	}
+
+	const typename v::type vzl = v::set1(zl);
+	const typename v::type vzh = v::set1(zh);
+
+	if( Inverse )
+		scale_range(L, H, N, 0, lay::descale, zl, zh);
+
+	border_steps<Seq, T, V>::prolog(L, H, N);
+
+	if( !Inverse )
+		scale_range(L, H, N, 0, lay::scale, zl, zh);
+
+	int s = 0;
+
+	// the first step reads the farthest sample, exactly the last descaled one
+	for(; lay::descale + 2*(s+V) <= N; s += V)
+	{
+		if( Inverse )
+			scale_block<T, V>(L, H, lay::descale + 2*s, vzl, vzh);
+
+		main_steps<Seq, T, V>::apply(L, H, s);
+
+		if( !Inverse )
+			scale_block<T, V>(L, H, lay::scale + 2*s, vzl, vzh);
+	}
+
+	if( Inverse )
+		scale_range(L, H, N, lay::descale + 2*s, N, zl, zh);
+
+	border_steps<Seq, T, V>::epilog(L, H, N, s);
+
+	if( !Inverse )
+		scale_range(L, H, N, lay::scale + 2*s, N, zl, zh);
+}
+
+} // namespace detail
+
+/**
+ * @addtogroup cpp_lifting
+ * @{
+ */
+
+/**
+ * @brief Widest vector of the type @p T available at compile time.
+ */
+template<typename T>
+struct lanes
+{
+	enum { value = 1 };
+};
+
+#if defined(__AVX__)
+template<> struct lanes<float> { enum { value = 8 }; };
+template<> struct lanes<double> { enum { value = 4 }; };
+#elif defined(__SSE2__)
+template<> struct lanes<float> { enum { value = 4 }; };
+template<> struct lanes<double> { enum { value = 2 }; };
+#elif defined(__SSE__)
+template<> struct lanes<float> { enum { value = 4 }; };
+#endif
+
+/**
+ * @brief One level of the transform using the lifting scheme @p Scheme.
+ *
+ * The signal is processed in place, split into the even (low-pass) part and
+ * the odd (high-pass) part. The main loop processes @p V adjacent pairs of
+ * samples at once; use @p V = 1 for the scalar kernel.
+ *
+ * @code
+ * typedef dwt::lifting::transform<dwt::lifting::cdf97::type, float> cdf97;
+ *
+ * dwt::lifting::split(x, l, h, N);
+ * cdf97::forward(l, h, N);
+ * @endcode
+ */
+template<class Scheme, typename T, int V = lanes<T>::value>
+struct transform
+{
+	/**
+	 * @brief Forward transform of @p N samples, (N+1)/2 in @p L and N/2 in @p H.
+	 */
+	static void forward(T *L, T *H, int N)
+	{
+		detail::run<detail::sequence<Scheme, false>, false, T, V>(L, H, N);
+	}
+
+	/**
+	 * @brief Inverse transform of @p N samples, (N+1)/2 in @p L and N/2 in @p H.
+	 */
+	static void inverse(T *L, T *H, int N)
+	{
+		detail::run<detail::sequence<Scheme, true>, true, T, V>(L, H, N);
+	}
+};
+
+/**
+ * @brief Split @p N samples of the signal @p x into even samples @p L and odd samples @p H.
+ */
+template<typename T>
+inline void split(const T *x, T *L, T *H, int N)
+{
+	for(int i = 0; i+1 < N; i += 2)
+	{
+		L[i/2] = x[i];
+		H[i/2] = x[i+1];
+	}
+	if( N & 1 )
+		L[N/2] = x[N-1];
+}
+
+/**
+ * @brief Merge even samples @p L and odd samples @p H into @p N samples of the signal @p x.
+ */
+template<typename T>
+inline void merge(T *x, const T *L, const T *H, int N)
+{
+	for(int i = 0; i+1 < N; i += 2)
+	{
+		x[i] = L[i/2];
+		x[i+1] = H[i/2];
+	}
+	if( N & 1 )
+		x[N-1] = L[N/2];
+}
+
+/**
+ * @}
+ */
+
+} // namespace lifting
+
+} // namespace dwt
+
+#endif
+
+#endif